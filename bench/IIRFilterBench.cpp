@@ -51,4 +51,40 @@ static void ChowIIR (benchmark::State& state)
 }
 BENCHMARK (ChowIIR)->MinTime (5);
 
+static void ChowIIRBlockParallel (benchmark::State& state)
+{
+    chowdsp::BlockParallelFilterWrapper<chowdsp::SecondOrderLPF<float>> filter;
+    filter.calcCoefs (100.0f, 1.0f, 48000.0f);
+    filter.prepare (1);
+    for (auto _ : state)
+    {
+        for (int i = 0; i < numSecondOrderSections; ++i)
+            filter.processBlock (audioBuffer);
+    }
+}
+BENCHMARK (ChowIIRBlockParallel)->MinTime (5);
+
+static void ChowSOSFilter (benchmark::State& state)
+{
+    chowdsp::ButterworthFilter<2 * numSecondOrderSections> filter;
+    filter.calcCoefs (100.0f, 1.0f / juce::MathConstants<float>::sqrt2, 48000.0f);
+    filter.prepare (1);
+    for (auto _ : state)
+        filter.processBlock (audioBuffer);
+}
+BENCHMARK (ChowSOSFilter)->MinTime (5);
+
+static void ChowPipelinedSOSFilter (benchmark::State& state)
+{
+    chowdsp::ButterworthFilter<2 * numSecondOrderSections> prototypeFilter;
+    prototypeFilter.calcCoefs (100.0f, 1.0f / juce::MathConstants<float>::sqrt2, 48000.0f);
+
+    chowdsp::PipelinedSOSFilter<float> filter;
+    filter.prepare (1, 2 * numSecondOrderSections);
+    filter.setCoefs (prototypeFilter);
+    for (auto _ : state)
+        filter.processBlock (audioBuffer);
+}
+BENCHMARK (ChowPipelinedSOSFilter)->MinTime (5);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <chowdsp_plugin_state/chowdsp_plugin_state.h>
+
+namespace
+{
+constexpr int numFloatParams = 400;
+constexpr int numChoiceParams = 50;
+constexpr int numBoolParams = 50;
+
+struct BenchParams : chowdsp::ParamHolder
+{
+    BenchParams()
+    {
+        for (int i = 0; i < numFloatParams; ++i)
+            floatParams.emplace_back (juce::ParameterID { "float_param_" + juce::String (i), 100 }, "Float Param " + juce::String (i), 0.5f);
+
+        for (int i = 0; i < numChoiceParams; ++i)
+            choiceParams.emplace_back ("choice_param_" + juce::String (i), "Choice Param " + juce::String (i), juce::StringArray { "One", "Two", "Three" }, 1);
+
+        for (int i = 0; i < numBoolParams; ++i)
+            boolParams.emplace_back ("bool_param_" + juce::String (i), "Bool Param " + juce::String (i), i % 2 == 0);
+
+        add (floatParams, choiceParams, boolParams);
+    }
+
+    std::vector<chowdsp::PercentParameter::Ptr> floatParams;
+    std::vector<chowdsp::ChoiceParameter::Ptr> choiceParams;
+    std::vector<chowdsp::BoolParameter::Ptr> boolParams;
+};
+
+struct BenchNonParams : chowdsp::NonParamState
+{
+    BenchNonParams()
+    {
+        addStateValues ({ &editorWidth, &editorHeight, &presetName });
+    }
+
+    chowdsp::StateValue<int> editorWidth { "editor_width", 300 };
+    chowdsp::StateValue<int> editorHeight { "editor_height", 500 };
+    chowdsp::StateValue<juce::String> presetName { "preset_name", "Default Preset" };
+};
+
+template <typename Serializer>
+using BenchState = chowdsp::PluginStateImpl<BenchParams, BenchNonParams, Serializer>;
+
+template <typename Serializer>
+void randomiseState (BenchState<Serializer>& state)
+{
+    juce::Random rand { 0x1234 };
+    state.params.doForAllParameters ([&rand] (juce::RangedAudioParameter& param, size_t)
+                                     { param.setValueNotifyingHost (rand.nextFloat()); });
+}
+} // namespace
+
+template <typename Serializer>
+static void stateSave (benchmark::State& state)
+{
+    BenchState<Serializer> pluginState;
+    randomiseState (pluginState);
+
+    juce::MemoryBlock block;
+    for (auto _ : state)
+    {
+        block.reset();
+        pluginState.serialize (block);
+        benchmark::DoNotOptimize (block.getData());
+    }
+
+    state.counters["bytes"] = (double) block.getSize();
+}
+BENCHMARK_TEMPLATE (stateSave, chowdsp::JSONSerializer)->MinTime (1);
+BENCHMARK_TEMPLATE (stateSave, chowdsp::BinarySerializer)->MinTime (1);
+
+template <typename Serializer>
+static void stateLoad (benchmark::State& state)
+{
+    juce::MemoryBlock block;
+    {
+        BenchState<Serializer> pluginState;
+        randomiseState (pluginState);
+        pluginState.serialize (block);
+    }
+
+    // PluginStateImpl::deserialize() defers to the message thread, so we call the deserializer directly here
+    BenchState<Serializer> pluginState;
+    for (auto _ : state)
+        chowdsp::Serialization::deserialize<Serializer> (block, pluginState);
+
+    state.counters["bytes"] = (double) block.getSize();
+}
+BENCHMARK_TEMPLATE (stateLoad, chowdsp::JSONSerializer)->MinTime (1);
+BENCHMARK_TEMPLATE (stateLoad, chowdsp::BinarySerializer)->MinTime (1);
+
+template <typename Serializer>
+static void largeDataSave (benchmark::State& state)
+{
+    const auto wavetables = makeWavetables();
+
+    juce::MemoryBlock block;
+    for (auto _ : state)
+    {
+        block.reset();
+        chowdsp::Serialization::serialize<Serializer> (wavetables, block);
+        benchmark::DoNotOptimize (block.getData());
+    }
+
+    state.counters["bytes"] = (double) block.getSize();
+}
+BENCHMARK_TEMPLATE (largeDataSave, chowdsp::JSONSerializer)->MinTime (1);
+BENCHMARK_TEMPLATE (largeDataSave, chowdsp::BinarySerializer)->MinTime (1);
+
+template <typename Serializer>
+static void largeDataLoad (benchmark::State& state)
+{
+    juce::MemoryBlock block;
+    chowdsp::Serialization::serialize<Serializer> (makeWavetables(), block);
+
+    std::vector<Wavetable> wavetables;
+    for (auto _ : state)
+    {
+        chowdsp::Serialization::deserialize<Serializer> (block, wavetables);
+        benchmark::DoNotOptimize (wavetables.data());
+    }
+
+    state.counters["bytes"] = (double) block.getSize();
+}
+BENCHMARK_TEMPLATE (largeDataLoad, chowdsp::JSONSerializer)->MinTime (1);
+BENCHMARK_TEMPLATE (largeDataLoad, chowdsp::BinarySerializer)->MinTime (1);
+
+BENCHMARK_MAIN();
@@ -26,6 +26,7 @@ function(setup_example_plugin target code)
         PRIVATE
             juce::juce_audio_utils
             chowdsp_plugin_base
+            chowdsp_plugin_utils
             chowdsp_clap_extensions
         PUBLIC
             juce::juce_recommended_config_flags
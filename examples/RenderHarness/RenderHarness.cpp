@@ -0,0 +1,171 @@
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <chowdsp_plugin_utils/chowdsp_plugin_utils.h>
+#include <iostream>
+
+// Command-line app for rendering audio through one of the example plugins offline,
+// and reporting the plugin's throughput and output checksum. The app is linked with
+// the plugin's shared code, which creates the plugin with createPluginFilter().
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+namespace
+{
+void printUsage()
+{
+    std::cout << "Usage: <plugin>_Render [options]\n"
+              << "Options:\n"
+              << "  --input <file>             Audio file to render (default: generated noise)\n"
+              << "  --length <seconds>         Length of the generated noise (default: 60)\n"
+              << "  --sample-rate <Hz>         Sample rate of the generated noise (default: 48000)\n"
+              << "  --channels <n>             Number of channels to render (default: 2, or the input file channels)\n"
+              << "  --block-sizes <n,n,...>    Block sizes to render with (default: 512)\n"
+              << "  --channels-per-group <n>   Renders groups of n channels with separate plugin instances, in parallel\n"
+              << "  --threads <n>              Number of threads to use for rendering channel groups (default: one per CPU)\n"
+              << "  --chain <n>                Renders through a chain of n plugin instances, with each on its own thread\n"
+              << "  --output <file>            Writes the output from the first block size to a file\n"
+              << "  --expect-checksum <hex>    Fails if the output checksum doesn't match\n"
+              << "  --min-rtf <x>              Fails if the real-time factor is less than x\n";
+}
+
+juce::AudioBuffer<float> createNoiseSignal (int numChannels, int numSamples)
+{
+    // use a fixed seed, so that the checksums are reproducible
+    juce::Random rand { 0x1234 };
+    juce::AudioBuffer<float> buffer { numChannels, numSamples };
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        auto* data = buffer.getWritePointer (ch);
+        for (int n = 0; n < numSamples; ++n)
+            data[n] = 0.5f * (rand.nextFloat() * 2.0f - 1.0f);
+    }
+
+    return buffer;
+}
+
+std::vector<int> parseBlockSizes (const juce::String& blockSizesString)
+{
+    juce::StringArray tokens;
+    tokens.addTokens (blockSizesString, ",", {});
+
+    std::vector<int> blockSizes;
+    for (const auto& token : tokens)
+        if (const auto blockSize = token.trim().getIntValue(); blockSize > 0)
+            blockSizes.push_back (blockSize);
+
+    return blockSizes;
+}
+} // namespace
+
+int main (int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    juce::ArgumentList args { argc, argv };
+
+    if (args.containsOption ("--help|-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    const auto blockSizes = parseBlockSizes (args.containsOption ("--block-sizes") ? args.getValueForOption ("--block-sizes") : "512");
+    auto numChannels = args.containsOption ("--channels") ? args.getValueForOption ("--channels").getIntValue() : 2;
+    if (numChannels <= 0 || blockSizes.empty())
+    {
+        printUsage();
+        return 1;
+    }
+
+    juce::AudioBuffer<float> input;
+    double sampleRate = 48000.0;
+    if (args.containsOption ("--input"))
+    {
+        const auto inputFile = juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--input"));
+        if (inputFile.existsAsFile())
+            std::tie (input, sampleRate) = chowdsp::AudioFileSaveLoadHelper {}.loadFile (inputFile);
+
+        if (input.getNumSamples() == 0)
+        {
+            std::cerr << "Unable to load audio file: " << inputFile.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        if (! args.containsOption ("--channels"))
+            numChannels = input.getNumChannels();
+    }
+    else
+    {
+        sampleRate = args.containsOption ("--sample-rate") ? args.getValueForOption ("--sample-rate").getDoubleValue() : 48000.0;
+        const auto lengthSeconds = args.containsOption ("--length") ? args.getValueForOption ("--length").getDoubleValue() : 60.0;
+        input = createNoiseSignal (numChannels, (int) (lengthSeconds * sampleRate));
+    }
+
+    const auto channelsPerGroup = args.containsOption ("--channels-per-group") ? args.getValueForOption ("--channels-per-group").getIntValue() : 0;
+    const auto numThreads = args.containsOption ("--threads") ? args.getValueForOption ("--threads").getIntValue() : 0;
+    const auto chainLength = args.containsOption ("--chain") ? juce::jmax (1, args.getValueForOption ("--chain").getIntValue()) : 1;
+    const auto createPlugin = []
+    { return std::unique_ptr<juce::AudioProcessor> { createPluginFilter() }; };
+    const auto pluginName = createPlugin()->getName();
+
+    int exitCode = 0;
+    for (auto [index, blockSize] : chowdsp::enumerate (blockSizes))
+    {
+        // use new plugin instances for each render, so they all start from the same state
+        const chowdsp::OfflineRender::Params renderParams { sampleRate, blockSize };
+        chowdsp::OfflineRender::Results results;
+        if (channelsPerGroup > 0)
+        {
+            results = chowdsp::OfflineRender::renderChannelGroups (createPlugin, input, channelsPerGroup, renderParams, numThreads);
+        }
+        else
+        {
+            std::vector<std::unique_ptr<juce::AudioProcessor>> plugins;
+            std::vector<juce::AudioProcessor*> stages;
+            for (int i = 0; i < chainLength; ++i)
+            {
+                stages.push_back (plugins.emplace_back (createPlugin()).get());
+                if (! chowdsp::OfflineRender::setMainBusChannels (*stages.back(), numChannels))
+                    std::cout << "Warning: " << pluginName << " does not support " << numChannels << " channels!" << std::endl;
+            }
+
+            if (stages.size() == 1)
+                results = chowdsp::OfflineRender::render (*stages.front(), input, renderParams);
+            else
+                results = chowdsp::OfflineRender::renderChain (stages, input, renderParams);
+        }
+
+        std::cout << pluginName << ":\n"
+                  << results.toString() << "\n"
+                  << std::endl;
+
+        if (index == 0 && args.containsOption ("--output"))
+        {
+            const auto outputFile = juce::File::getCurrentWorkingDirectory().getChildFile (args.getValueForOption ("--output"));
+            if (! chowdsp::AudioFileSaveLoadHelper {}.saveBufferToFile (outputFile, results.output, sampleRate))
+            {
+                std::cerr << "Unable to write audio file: " << outputFile.getFullPathName() << std::endl;
+                exitCode = 1;
+            }
+        }
+
+        if (args.containsOption ("--expect-checksum"))
+        {
+            const auto expectedChecksum = (uint64_t) args.getValueForOption ("--expect-checksum").getHexValue64();
+            if (results.checksum != expectedChecksum)
+            {
+                std::cerr << "Checksum mismatch for block size " << blockSize << "!" << std::endl;
+                exitCode = 1;
+            }
+        }
+
+        if (args.containsOption ("--min-rtf"))
+        {
+            const auto minRealTimeFactor = args.getValueForOption ("--min-rtf").getDoubleValue();
+            if (results.realTimeFactor < minRealTimeFactor)
+            {
+                std::cerr << "Real-time factor for block size " << blockSize << " is below " << minRealTimeFactor << "!" << std::endl;
+                exitCode = 1;
+            }
+        }
+    }
+
+    return exitCode;
+}
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+namespace chowdsp
+{
+/**
+ * Collects timing measurements from profiling zones.
+ *
+ * Profiling zones are marked with the `CHOWDSP_PROFILE_ZONE()` macro, which
+ * measures the time from where the macro is placed until the end of the
+ * enclosing scope. For example:
+ * @code
+ * void MyProcessor::process (const BufferView<float>& buffer)
+ * {
+ *     CHOWDSP_PROFILE_ZONE ("MyProcessor::process");
+ *     ...
+ * }
+ * @endcode
+ *
+ * Unless `CHOWDSP_ENABLE_PROFILING` is enabled, the macro expands to
+ * nothing, so the zones don't cost anything.
+ *
+ * While recording, each zone measurement is pushed into a lock-free buffer
+ * for the current thread, without allocating any memory. The measurements
+ * should be collected on another thread, usually with a `ProfilingSession`.
+ *
+ * The thread buffers are allocated the first time that recording starts.
+ * Each thread claims a buffer the first time it records a measurement, and
+ * returns it when the thread exits, so that it can be re-used by other threads.
+ */
+class Profiler
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /** A profiling zone. One of these is created at compile-time for each `CHOWDSP_PROFILE_ZONE()`. */
+    struct Zone
+    {
+        const char* name;
+        const char* file;
+        int line;
+    };
+
+    /** A single measurement from a profiling zone. */
+    struct Record
+    {
+        const Zone* zone = nullptr;
+        Clock::rep startTicks = 0;
+        Clock::rep endTicks = 0;
+    };
+
+    /** The maximum number of threads that can record measurements at the same time. */
+    static constexpr size_t maxNumThreads = 32;
+
+    /** The number of measurements that each thread can store before they must be collected. */
+    static constexpr size_t threadBufferSize = 8192;
+
+    /** Single-producer/single-consumer buffer of measurements from one thread. */
+    class ThreadBuffer
+    {
+    public:
+        ThreadBuffer() = default;
+
+        /** Producer: pushes a measurement into the buffer, or drops it if the buffer is full. */
+        void push (const Record& record) noexcept
+        {
+            const auto writeIdx = writeIndex.load (std::memory_order_relaxed);
+            if (writeIdx - readIndex.load (std::memory_order_acquire) >= threadBufferSize)
+            {
+                numDroppedRecords.fetch_add (1, std::memory_order_relaxed);
+                return;
+            }
+
+            records[writeIdx % threadBufferSize] = record;
+            writeIndex.store (writeIdx + 1, std::memory_order_release);
+        }
+
+        /** Consumer: calls the callback for each measurement in the buffer, and removes them from the buffer. */
+        template <typename Callback>
+        void popAll (Callback&& callback)
+        {
+            const auto writeIdx = writeIndex.load (std::memory_order_acquire);
+            auto readIdx = readIndex.load (std::memory_order_relaxed);
+            for (; readIdx < writeIdx; ++readIdx)
+                callback (records[readIdx % threadBufferSize]);
+            readIndex.store (readIdx, std::memory_order_release);
+        }
+
+        /** Returns the number of measurements that were dropped because the buffer was full. */
+        [[nodiscard]] uint64_t getNumDroppedRecords() const noexcept { return numDroppedRecords.load (std::memory_order_relaxed); }
+
+    private:
+        std::array<Record, threadBufferSize> records {};
+        alignas (64) std::atomic<uint64_t> writeIndex { 0 };
+        alignas (64) std::atomic<uint64_t> readIndex { 0 };
+        std::atomic<uint64_t> numDroppedRecords { 0 };
+    };
+
+    /** Returns the global profiler. */
+    static Profiler& getInstance()
+    {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    /**
+     * Starts or stops recording measurements. The thread buffers are allocated the
+     * first time that recording starts, so this should not be called from the audio thread.
+     */
+    void setRecording (bool shouldRecord)
+    {
+        if (shouldRecord && threadBuffers.load (std::memory_order_relaxed) == nullptr)
+        {
+            threadBuffersStorage = std::make_unique<ThreadBuffer[]> (maxNumThreads);
+            threadBuffers.store (threadBuffersStorage.get(), std::memory_order_release);
+        }
+
+        recording.store (shouldRecord, std::memory_order_release);
+    }
+
+    /** Returns true if the profiler is currently recording. */
+    [[nodiscard]] bool isRecording() const noexcept { return recording.load (std::memory_order_relaxed); }
+
+    /**
+     * Returns the buffer for the current thread, or nullptr if the buffers have not
+     * been allocated, or too many threads are already recording measurements.
+     */
+    ThreadBuffer* getBufferForCurrentThread() noexcept
+    {
+        thread_local ThreadBufferHandle handle;
+        if (handle.buffer == nullptr)
+            handle.claim (*this);
+        return handle.buffer;
+    }
+
+    /**
+     * Consumer: calls the callback with (threadIndex, record) for each measurement
+     * that has been recorded since the last call, on any thread. This should only
+     * be called from one thread at a time.
+     */
+    template <typename Callback>
+    void collectRecords (Callback&& callback)
+    {
+        auto* buffers = threadBuffers.load (std::memory_order_acquire);
+        if (buffers == nullptr)
+            return;
+
+        // buffers that aren't currently claimed may still have measurements from a thread that has exited
+        for (size_t threadIndex = 0; threadIndex < maxNumThreads; ++threadIndex)
+            buffers[threadIndex].popAll ([&callback, threadIndex] (const Record& record)
+                                         { callback (threadIndex, record); });
+    }
+
+    /**
+     * Returns the total number of measurements that have been dropped, because a
+     * thread buffer was full, or because no thread buffer was available.
+     */
+    [[nodiscard]] uint64_t getNumDroppedRecords() const noexcept
+    {
+        auto numDropped = numRecordsWithoutBuffer.load (std::memory_order_relaxed);
+        if (auto* buffers = threadBuffers.load (std::memory_order_acquire))
+        {
+            for (size_t threadIndex = 0; threadIndex < maxNumThreads; ++threadIndex)
+                numDropped += buffers[threadIndex].getNumDroppedRecords();
+        }
+        return numDropped;
+    }
+
+    /** Converts clock ticks to microseconds. */
+    static constexpr double ticksToMicroseconds (Clock::rep ticks) noexcept
+    {
+        return (double) ticks * 1.0e6 * (double) Clock::period::num / (double) Clock::period::den;
+    }
+
+    /** Measures the time spent in a profiling zone. Use `CHOWDSP_PROFILE_ZONE()` rather than using this class directly. */
+    class ScopedZone
+    {
+    public:
+        explicit ScopedZone (const Zone& zoneToMeasure) noexcept
+        {
+            if (! getInstance().isRecording())
+                return;
+
+            zone = &zoneToMeasure;
+            startTicks = Clock::now().time_since_epoch().count();
+        }
+
+        ~ScopedZone() noexcept
+        {
+            if (zone == nullptr)
+                return;
+
+            const auto endTicks = Clock::now().time_since_epoch().count();
+            auto& profiler = getInstance();
+            if (auto* buffer = profiler.getBufferForCurrentThread())
+                buffer->push ({ zone, startTicks, endTicks });
+            else
+                profiler.numRecordsWithoutBuffer.fetch_add (1, std::memory_order_relaxed);
+        }
+
+    private:
+        const Zone* zone = nullptr;
+        Clock::rep startTicks = 0;
+
+        ScopedZone (const ScopedZone&) = delete;
+        ScopedZone& operator= (const ScopedZone&) = delete;
+    };
+
+private:
+    Profiler() = default;
+
+    /** Claims a thread buffer for the current thread, and returns it to the profiler when the thread exits. */
+    struct ThreadBufferHandle
+    {
+        ThreadBufferHandle() = default;
+
+        ~ThreadBufferHandle()
+        {
+            if (buffer != nullptr)
+                profiler->claimedThreadBuffers.fetch_and (~(SlotMask (1) << slot), std::memory_order_release);
+        }
+
+        void claim (Profiler& owner) noexcept
+        {
+            auto* buffers = owner.threadBuffers.load (std::memory_order_acquire);
+            if (buffers == nullptr)
+                return;
+
+            auto claimedSlots = owner.claimedThreadBuffers.load (std::memory_order_relaxed);
+            while (true)
+            {
+                if (claimedSlots == ~SlotMask (0))
+                    return; // too many threads!
+
+                size_t freeSlot = 0;
+                while ((claimedSlots & (SlotMask (1) << freeSlot)) != 0)
+                    ++freeSlot;
+
+                if (owner.claimedThreadBuffers.compare_exchange_weak (claimedSlots, claimedSlots | (SlotMask (1) << freeSlot), std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    profiler = &owner;
+                    slot = freeSlot;
+                    buffer = &buffers[freeSlot];
+                    return;
+                }
+            }
+        }
+
+        Profiler* profiler = nullptr;
+        size_t slot = 0;
+        ThreadBuffer* buffer = nullptr;
+
+        ThreadBufferHandle (const ThreadBufferHandle&) = delete;
+        ThreadBufferHandle& operator= (const ThreadBufferHandle&) = delete;
+    };
+
+    using SlotMask = uint32_t; // one bit for each thread buffer, set while the buffer is claimed by a thread
+    static_assert (maxNumThreads == 8 * sizeof (SlotMask), "Each thread buffer needs one bit in the slot mask!");
+
+    std::unique_ptr<ThreadBuffer[]> threadBuffersStorage;
+    std::atomic<ThreadBuffer*> threadBuffers { nullptr };
+    std::atomic<SlotMask> claimedThreadBuffers { 0 };
+    std::atomic<uint64_t> numRecordsWithoutBuffer { 0 };
+    std::atomic_bool recording { false };
+};
+} // namespace chowdsp
+
+#ifndef DOXYGEN
+#define CHOWDSP_PROFILING_JOIN_HELPER(a, b) a##b
+#define CHOWDSP_PROFILING_JOIN(a, b) CHOWDSP_PROFILING_JOIN_HELPER (a, b)
+#endif
+
+#if CHOWDSP_ENABLE_PROFILING
+/** Measures the time from this point until the end of the enclosing scope, and reports it to the chowdsp::Profiler. */
+#define CHOWDSP_PROFILE_ZONE(zoneName)                                                                                                          \
+    static constexpr chowdsp::Profiler::Zone CHOWDSP_PROFILING_JOIN (chowdspProfilingZone_, __LINE__) { zoneName, __FILE__, __LINE__ }; \
+    const chowdsp::Profiler::ScopedZone CHOWDSP_PROFILING_JOIN (chowdspScopedProfilingZone_, __LINE__) { CHOWDSP_PROFILING_JOIN (chowdspProfilingZone_, __LINE__) }
+#else
+#define CHOWDSP_PROFILE_ZONE(zoneName)
+#endif
@@ -20,6 +20,14 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #pragma once
 
+/** Config: CHOWDSP_ENABLE_PROFILING
+            Enables profiling zones marked with CHOWDSP_PROFILE_ZONE(). When this
+            flag is disabled, the profiling zones are compiled out entirely.
+*/
+#ifndef CHOWDSP_ENABLE_PROFILING
+#define CHOWDSP_ENABLE_PROFILING 0
+#endif
+
 // STL includes
 #include <algorithm>
 #include <array>
@@ -83,4 +91,5 @@ namespace experimental
 
 #include "Functional/chowdsp_Bindings.h"
 #include "Memory/chowdsp_MemoryAliasing.h"
+#include "Profiling/chowdsp_Profiler.h"
 #include "Types/chowdsp_TypeTraits.h"
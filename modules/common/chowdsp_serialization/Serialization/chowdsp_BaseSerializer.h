@@ -51,6 +51,7 @@ namespace serialization_detail
  */
 class BaseSerializer
 {
+protected:
     template <typename Serializer>
     using SerialType = typename Serializer::SerializedType;
 
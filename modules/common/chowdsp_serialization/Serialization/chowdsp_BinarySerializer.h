@@ -0,0 +1,996 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Serializer which serializes data into a compact binary format.
+ *
+ * Each element is stored as a one-byte type tag, followed by the element data.
+ * Numbers are stored as little-endian fixed-size values, strings are stored as
+ * a length-prefixed UTF-8 string, and arrays store their number of children and
+ * the total size of their children, followed by the children themselves. The
+ * serialized data begins with a "magic number" and a format version.
+ *
+ * Deserialization reads the data in place, without building any intermediate
+ * tree structure. When deserializing from a MemoryBlock or from binary data,
+ * the deserialized elements refer directly to the original data, so the data
+ * must outlive those elements.
+ *
+ * Objects serialized via chowdsp::Serialization are streamed directly into
+ * (and out of) the binary data, so large aggregates and containers can be
+ * serialized without building a tree of elements.
+ */
+class BinarySerializer : public BaseSerializer
+{
+    enum class Tag : uint8_t
+    {
+        Array = 0,
+        Bool,
+        Int32,
+        Int64,
+        Float32,
+        Float64,
+        String,
+    };
+
+    struct View
+    {
+        const std::byte* data = nullptr;
+        size_t size = 0;
+    };
+
+public:
+    static constexpr uint32_t magicNumber = 0x53424843; // "CHBS"
+    static constexpr uint16_t formatVersion = 1;
+
+    /** A serialized element, which either owns its data, or refers to some existing data. */
+    class Element
+    {
+    public:
+        Element() = default;
+
+    private:
+        friend class BinarySerializer;
+
+        enum class Storage
+        {
+            Building, /**< Element that is still being built */
+            External, /**< Element that refers to some data that it doesn't own */
+            Flattened, /**< Element that owns its (flattened) data */
+        };
+
+        Storage storage = Storage::Building;
+        Tag tag = Tag::Array;
+        std::vector<std::byte> payload {};
+        uint32_t numChildren = 0;
+
+        View externalView {};
+        mutable std::vector<std::byte> flattened {};
+        mutable bool flattenedIsUpToDate = false;
+
+        // children are usually accessed in order, so we remember where the last child was found
+        mutable int cursorIndex = 0;
+        mutable size_t cursorOffset = 0;
+    };
+
+    using SerializedType = Element;
+    using DeserializedType = const Element&;
+
+    static juce::String toString (const Element& serial)
+    {
+        const auto view = getView (serial);
+        return juce::Base64::toBase64 (view.data, view.size);
+    }
+
+    static void toMemoryBlock (const Element& serial, juce::MemoryBlock& block)
+    {
+        const auto view = getView (serial);
+        const auto startOffset = block.getSize();
+        block.setSize (startOffset + fileHeaderSize + view.size);
+
+        auto* dest = static_cast<std::byte*> (block.getData()) + startOffset;
+        dest = writeInt (dest, magicNumber);
+        dest = writeInt (dest, formatVersion);
+        std::copy (view.data, view.data + view.size, dest);
+    }
+
+    static void toFile (const Element& serial, const juce::File& file)
+    {
+        juce::MemoryBlock block;
+        toMemoryBlock (serial, block);
+        if (! file.replaceWithData (block.getData(), block.getSize()))
+            jassertfalse; // unable to write to file!
+    }
+
+    static SerializedType fromFile (const juce::File& file)
+    {
+        juce::MemoryBlock block;
+        if (! file.loadFileAsData (block))
+        {
+            jassertfalse; // unable to load file!
+            return {};
+        }
+
+        const auto view = getElementViewFromData (block.getData(), block.getSize());
+        if (view.data == nullptr)
+            return {};
+
+        Element element;
+        element.storage = Element::Storage::Flattened;
+        element.flattened.assign (view.data, view.data + view.size);
+        element.flattenedIsUpToDate = true;
+        return element;
+    }
+
+    /** Note that the returned element refers to the data in the memory block, and so must not outlive it! */
+    static SerializedType fromMemoryBlock (const juce::MemoryBlock& block)
+    {
+        return fromBinaryData (block.getData(), (int) block.getSize());
+    }
+
+    /** Note that the returned element refers to the binary data, and so must not outlive it! */
+    static SerializedType fromBinaryData (const void* data, int dataSize)
+    {
+        const auto view = getElementViewFromData (data, (size_t) juce::jmax (0, dataSize));
+        if (view.data == nullptr)
+            return {};
+
+        return createExternalElement (view);
+    }
+
+    static auto createBaseElement()
+    {
+        return Element {};
+    }
+
+    static void addChildElement (Element& parent, Element&& newChild)
+    {
+        auto* dest = prepareNewChild (parent, getFlattenedSize (newChild));
+        writeFlattened (newChild, dest);
+    }
+
+    /** Adds a string directly to the parent element, without creating a new element for it. */
+    static void addChildElement (Element& parent, const juce::String& x)
+    {
+        addStringChild (parent, x.toRawUTF8(), x.getNumBytesAsUTF8());
+    }
+
+    /** Adds a string directly to the parent element, without creating a new element for it. */
+    static void addChildElement (Element& parent, std::string_view x)
+    {
+        addStringChild (parent, x.data(), x.size());
+    }
+
+    /** Adds a string directly to the parent element, without creating a new element for it. */
+    static void addChildElement (Element& parent, const std::string& x)
+    {
+        addStringChild (parent, x.data(), x.size());
+    }
+
+    /** Adds a number directly to the parent element, without creating a new element for it. */
+    template <typename T>
+    static std::enable_if_t<std::is_arithmetic_v<T>, void> addChildElement (Element& parent, T x)
+    {
+        auto* dest = prepareNewChild (parent, sizeof (Tag) + ArithmeticTraits<T>::size);
+        dest = writeInt (dest, (uint8_t) ArithmeticTraits<T>::tag);
+        writeArithmetic (dest, x);
+    }
+
+    static Element getChildElement (const Element& parent, int index)
+    {
+        ElementInfo info;
+        if (! parseElement (getView (parent), info) || info.tag != Tag::Array || ! juce::isPositiveAndBelow (index, info.numChildren))
+        {
+            jassertfalse;
+            return {};
+        }
+
+        if (index < parent.cursorIndex)
+        {
+            parent.cursorIndex = 0;
+            parent.cursorOffset = 0;
+        }
+
+        ElementInfo childInfo;
+        while (true)
+        {
+            const View childView { info.payload.data + parent.cursorOffset, info.payload.size - parent.cursorOffset };
+            if (! parseElement (childView, childInfo))
+            {
+                jassertfalse; // data is corrupted!
+                parent.cursorIndex = 0;
+                parent.cursorOffset = 0;
+                return {};
+            }
+
+            if (parent.cursorIndex == index)
+                return createExternalElement ({ childView.data, childInfo.size });
+
+            parent.cursorOffset += childInfo.size;
+            parent.cursorIndex++;
+        }
+    }
+
+    static int getNumChildElements (const Element& serial)
+    {
+        ElementInfo info;
+        if (! parseElement (getView (serial), info) || info.tag != Tag::Array)
+        {
+            jassertfalse;
+            return 0;
+        }
+
+        return (int) info.numChildren;
+    }
+
+    template <typename T>
+    static Element serializeArithmeticType (T x)
+    {
+        Element element;
+        element.tag = ArithmeticTraits<T>::tag;
+        element.payload.resize (ArithmeticTraits<T>::size);
+        writeArithmetic (element.payload.data(), x);
+        return element;
+    }
+
+    template <typename T>
+    static T deserializeArithmeticType (const Element& serial)
+    {
+        return readArithmetic<T> (getView (serial));
+    }
+
+    template <typename T>
+    static Element serializeString (const T& x)
+    {
+        Element element;
+        element.tag = Tag::String;
+        if constexpr (std::is_same_v<T, juce::String>)
+        {
+            const auto* stringData = reinterpret_cast<const std::byte*> (x.toRawUTF8());
+            element.payload.assign (stringData, stringData + x.getNumBytesAsUTF8());
+        }
+        else
+        {
+            const auto* stringData = reinterpret_cast<const std::byte*> (x.data());
+            element.payload.assign (stringData, stringData + x.size());
+        }
+        return element;
+    }
+
+    template <typename T>
+    static T deserializeString (const Element& serial)
+    {
+        return readString<T> (getView (serial));
+    }
+
+    /**
+     * Serializes an object straight into a pre-sized buffer.
+     *
+     * Numbers, strings, containers, and reflected aggregates are written directly
+     * into the output buffer, without creating an intermediate element for each field.
+     * The layout of aggregates with only fixed-size fields is computed at compile-time.
+     * Types with custom serialization are still serialized via their own serialize() method.
+     */
+    template <typename Serializer, typename T>
+    static Element serialize (const T& object)
+    {
+        StreamContext context;
+        const auto size = getStreamedSize (object, context);
+
+        Element element;
+        element.storage = Element::Storage::Flattened;
+        element.flattened.resize (size);
+        [[maybe_unused]] const auto* end = writeStreamed (object, element.flattened.data(), context);
+        jassert (end == element.flattened.data() + size);
+        element.flattenedIsUpToDate = true;
+        return element;
+    }
+
+    /** Deserializes an object by reading straight from the serialized data, without creating an intermediate element for each field. */
+    template <typename Serializer, typename T>
+    static void deserialize (const Element& serial, T& object)
+    {
+        readStreamed (getView (serial), object);
+    }
+
+private:
+    BinarySerializer() = default; // static use only
+
+    static constexpr size_t fileHeaderSize = sizeof (magicNumber) + sizeof (formatVersion);
+
+    struct ElementInfo
+    {
+        Tag tag = Tag::Array;
+        View payload {}; // for arrays, this is the data for all the children
+        size_t size = 0; // total size of the element, including the tag
+        int numChildren = 0;
+    };
+
+    template <typename T, typename = void>
+    struct ArithmeticTraits
+    {
+        static constexpr auto tag = sizeof (T) <= sizeof (int32_t) ? Tag::Int32 : Tag::Int64;
+        static constexpr size_t size = sizeof (T) <= sizeof (int32_t) ? sizeof (int32_t) : sizeof (int64_t);
+    };
+
+    template <typename T>
+    struct ArithmeticTraits<T, std::enable_if_t<std::is_same_v<T, bool>>>
+    {
+        static constexpr auto tag = Tag::Bool;
+        static constexpr size_t size = sizeof (uint8_t);
+    };
+
+    template <typename T>
+    struct ArithmeticTraits<T, std::enable_if_t<std::is_floating_point_v<T>>>
+    {
+        static constexpr auto tag = sizeof (T) <= sizeof (float) ? Tag::Float32 : Tag::Float64;
+        static constexpr size_t size = sizeof (T) <= sizeof (float) ? sizeof (float) : sizeof (double);
+    };
+
+    template <typename To, typename From>
+    static To bitCast (From x) noexcept
+    {
+        static_assert (sizeof (To) == sizeof (From));
+        To y;
+        std::memcpy (&y, &x, sizeof (To));
+        return y;
+    }
+
+    template <typename IntType>
+    static std::byte* writeInt (std::byte* dest, IntType x) noexcept
+    {
+        if constexpr (sizeof (IntType) > 1)
+            x = juce::ByteOrder::swapIfBigEndian (x);
+        std::memcpy (dest, &x, sizeof (IntType));
+        return dest + sizeof (IntType);
+    }
+
+    template <typename IntType>
+    static IntType readInt (const std::byte* src) noexcept
+    {
+        IntType x;
+        std::memcpy (&x, src, sizeof (IntType));
+        if constexpr (sizeof (IntType) > 1)
+            x = juce::ByteOrder::swapIfBigEndian (x);
+        return x;
+    }
+
+    static constexpr size_t getVarIntSize (size_t x) noexcept
+    {
+        size_t numBytes = 1;
+        for (; x >= 0x80; x >>= 7)
+            ++numBytes;
+        return numBytes;
+    }
+
+    static std::byte* writeVarInt (std::byte* dest, size_t x) noexcept
+    {
+        for (; x >= 0x80; x >>= 7)
+            *dest++ = std::byte ((x & 0x7f) | 0x80);
+        *dest++ = std::byte (x);
+        return dest;
+    }
+
+    static bool readVarInt (const std::byte*& src, const std::byte* end, size_t& x) noexcept
+    {
+        x = 0;
+        for (int shift = 0; shift < 32; shift += 7)
+        {
+            if (src >= end)
+                return false;
+
+            const auto byte = (size_t) *src++;
+            x |= (byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0)
+                return true;
+        }
+        return false;
+    }
+
+    template <typename T>
+    static void writeArithmetic (std::byte* dest, T x) noexcept
+    {
+        if constexpr (ArithmeticTraits<T>::tag == Tag::Bool)
+            writeInt (dest, (uint8_t) (x ? 1 : 0));
+        else if constexpr (ArithmeticTraits<T>::tag == Tag::Int32)
+            writeInt (dest, (uint32_t) (int32_t) x);
+        else if constexpr (ArithmeticTraits<T>::tag == Tag::Int64)
+            writeInt (dest, (uint64_t) (int64_t) x);
+        else if constexpr (ArithmeticTraits<T>::tag == Tag::Float32)
+            writeInt (dest, bitCast<uint32_t> ((float) x));
+        else
+            writeInt (dest, bitCast<uint64_t> ((double) x));
+    }
+
+    /** Reads the tag and size of the element at the start of the view, returning false if the data is invalid. */
+    static bool parseElement (View view, ElementInfo& info) noexcept
+    {
+        if (view.data == nullptr || view.size < sizeof (Tag))
+            return false;
+
+        const auto* ptr = view.data + sizeof (Tag);
+        const auto* end = view.data + view.size;
+        size_t payloadSize = 0;
+
+        info.tag = (Tag) readInt<uint8_t> (view.data);
+        info.numChildren = 0;
+        switch (info.tag)
+        {
+            case Tag::Bool:
+                payloadSize = sizeof (uint8_t);
+                break;
+            case Tag::Int32:
+            case Tag::Float32:
+                payloadSize = sizeof (uint32_t);
+                break;
+            case Tag::Int64:
+            case Tag::Float64:
+                payloadSize = sizeof (uint64_t);
+                break;
+            case Tag::String:
+                if (! readVarInt (ptr, end, payloadSize))
+                    return false;
+                break;
+            case Tag::Array:
+            {
+                size_t numChildren = 0;
+                if (! readVarInt (ptr, end, numChildren) || ! readVarInt (ptr, end, payloadSize))
+                    return false;
+
+                // each child takes at least one byte, so any more children than that means the data is corrupted
+                if (numChildren > payloadSize || numChildren > (size_t) std::numeric_limits<int>::max())
+                    return false;
+                info.numChildren = (int) numChildren;
+                break;
+            }
+            default:
+                return false;
+        }
+
+        if (payloadSize > (size_t) (end - ptr))
+            return false;
+
+        info.payload = { ptr, payloadSize };
+        info.size = (size_t) (ptr - view.data) + payloadSize;
+        return true;
+    }
+
+    template <typename T>
+    static T readArithmetic (View view) noexcept
+    {
+        ElementInfo info;
+        if (! parseElement (view, info))
+        {
+            jassertfalse;
+            return T {};
+        }
+
+        switch (info.tag)
+        {
+            case Tag::Bool:
+                return static_cast<T> (readInt<uint8_t> (info.payload.data) != 0);
+            case Tag::Int32:
+                return static_cast<T> ((int32_t) readInt<uint32_t> (info.payload.data));
+            case Tag::Int64:
+                return static_cast<T> ((int64_t) readInt<uint64_t> (info.payload.data));
+            case Tag::Float32:
+                return static_cast<T> (bitCast<float> (readInt<uint32_t> (info.payload.data)));
+            case Tag::Float64:
+                return static_cast<T> (bitCast<double> (readInt<uint64_t> (info.payload.data)));
+            case Tag::Array:
+            case Tag::String:
+            default:
+                jassertfalse; // element is not a number!
+                return T {};
+        }
+    }
+
+    template <typename T>
+    static T readString (View view)
+    {
+        ElementInfo info;
+        if (! parseElement (view, info) || info.tag != Tag::String)
+        {
+            jassertfalse;
+            return T {};
+        }
+
+        const auto* stringData = reinterpret_cast<const char*> (info.payload.data);
+        if constexpr (std::is_same_v<T, juce::String>)
+            return juce::String::fromUTF8 (stringData, (int) info.payload.size);
+        else
+            return T { stringData, info.payload.size };
+    }
+
+    static Element createExternalElement (View view)
+    {
+        Element element;
+        element.storage = Element::Storage::External;
+        element.externalView = view;
+        return element;
+    }
+
+    static View getElementViewFromData (const void* data, size_t dataSize)
+    {
+        const auto* bytes = static_cast<const std::byte*> (data);
+        if (bytes == nullptr
+            || dataSize < fileHeaderSize
+            || readInt<uint32_t> (bytes) != magicNumber
+            || readInt<uint16_t> (bytes + sizeof (magicNumber)) > formatVersion)
+        {
+            jassertfalse; // unable to load from data!
+            return {};
+        }
+
+        const View view { bytes + fileHeaderSize, dataSize - fileHeaderSize };
+        ElementInfo info;
+        if (! parseElement (view, info))
+        {
+            jassertfalse; // data is corrupted!
+            return {};
+        }
+
+        return { view.data, info.size };
+    }
+
+    static size_t getFlattenedSize (const Element& element) noexcept
+    {
+        if (element.storage != Element::Storage::Building)
+            return getView (element).size;
+
+        auto size = sizeof (Tag) + element.payload.size();
+        if (element.tag == Tag::String)
+            size += getVarIntSize (element.payload.size());
+        else if (element.tag == Tag::Array)
+            size += getVarIntSize (element.numChildren) + getVarIntSize (element.payload.size());
+        return size;
+    }
+
+    static std::byte* writeFlattened (const Element& element, std::byte* dest) noexcept
+    {
+        if (element.storage != Element::Storage::Building)
+        {
+            const auto view = getView (element);
+            return std::copy (view.data, view.data + view.size, dest);
+        }
+
+        dest = writeInt (dest, (uint8_t) element.tag);
+        if (element.tag == Tag::String)
+        {
+            dest = writeVarInt (dest, element.payload.size());
+        }
+        else if (element.tag == Tag::Array)
+        {
+            dest = writeVarInt (dest, element.numChildren);
+            dest = writeVarInt (dest, element.payload.size());
+        }
+        return std::copy (element.payload.begin(), element.payload.end(), dest);
+    }
+
+    static View getView (const Element& element)
+    {
+        if (element.storage == Element::Storage::External)
+            return element.externalView;
+
+        if (element.storage == Element::Storage::Building && ! element.flattenedIsUpToDate)
+        {
+            element.flattened.resize (getFlattenedSize (element));
+            writeFlattened (element, element.flattened.data());
+            element.flattenedIsUpToDate = true;
+        }
+
+        return { element.flattened.data(), element.flattened.size() };
+    }
+
+    static std::byte* prepareNewChild (Element& parent, size_t childSize)
+    {
+        jassert (parent.storage == Element::Storage::Building && parent.tag == Tag::Array); // can only add children to a new array element!
+
+        const auto childOffset = parent.payload.size();
+        parent.payload.resize (childOffset + childSize);
+        parent.numChildren++;
+        parent.flattenedIsUpToDate = false;
+        parent.cursorIndex = 0;
+        parent.cursorOffset = 0;
+        return parent.payload.data() + childOffset;
+    }
+
+    static void addStringChild (Element& parent, const char* stringData, size_t numBytes)
+    {
+        auto* dest = prepareNewChild (parent, sizeof (Tag) + getVarIntSize (numBytes) + numBytes);
+        dest = writeInt (dest, (uint8_t) Tag::String);
+        dest = writeVarInt (dest, numBytes);
+        std::copy (reinterpret_cast<const std::byte*> (stringData), reinterpret_cast<const std::byte*> (stringData) + numBytes, dest);
+    }
+
+    //==============================================================================
+    // Streaming serialization
+
+    template <typename T>
+    struct IsStdArray : std::false_type
+    {
+    };
+
+    template <typename T, size_t N>
+    struct IsStdArray<std::array<T, N>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct IsStdVector : std::false_type
+    {
+    };
+
+    template <typename T, typename Alloc>
+    struct IsStdVector<std::vector<T, Alloc>> : std::true_type
+    {
+    };
+
+    template <typename T>
+    static constexpr auto IsReflectedAggregate = IsNotDirectlySerializable<T> && ! HasCustomSerialization<T>;
+
+    static constexpr size_t notFixedSize = std::numeric_limits<size_t>::max();
+
+    /** State that is shared between the sizing and writing passes, in the order that the elements are visited. */
+    struct StreamContext
+    {
+        std::vector<size_t> arrayPayloadSizes {};
+        size_t nextArrayPayloadSize = 0;
+
+        std::vector<Element> customElements {};
+        size_t nextCustomElement = 0;
+    };
+
+    static constexpr size_t getArrayHeaderSize (size_t numChildren, size_t payloadSize) noexcept
+    {
+        return sizeof (Tag) + getVarIntSize (numChildren) + getVarIntSize (payloadSize);
+    }
+
+    static std::byte* writeArrayHeader (std::byte* dest, size_t numChildren, size_t payloadSize) noexcept
+    {
+        dest = writeInt (dest, (uint8_t) Tag::Array);
+        dest = writeVarInt (dest, numChildren);
+        return writeVarInt (dest, payloadSize);
+    }
+
+    template <typename T, size_t... Is>
+    static constexpr size_t getFixedAggregatePayloadSize (std::index_sequence<Is...>)
+    {
+        constexpr size_t fieldSizes[] = { getFixedStreamedSize<pfr::tuple_element_t<Is, T>>()..., 0 };
+
+        size_t payloadSize = 0;
+        for (size_t i = 0; i < sizeof...(Is); ++i)
+        {
+            if (fieldSizes[i] == notFixedSize)
+                return notFixedSize;
+            payloadSize += fieldSizes[i];
+        }
+        return payloadSize;
+    }
+
+    /** Returns the number of children for an array-like type with a compile-time layout. */
+    template <typename T>
+    static constexpr size_t getNumFixedChildren()
+    {
+        if constexpr (IsStdArray<T>::value)
+            return std::tuple_size_v<T>;
+#if JUCE_MODULE_AVAILABLE_juce_graphics
+        else if constexpr (IsPoint<T>)
+            return 2;
+#endif
+        else
+            return pfr::tuple_size_v<T>;
+    }
+
+    /** Returns the payload size of a type whose size is known at compile-time, or notFixedSize. */
+    template <typename T>
+    static constexpr size_t getFixedPayloadSize()
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            return ArithmeticTraits<T>::size;
+        }
+        else if constexpr (IsStdArray<T>::value)
+        {
+            constexpr auto elementSize = getFixedStreamedSize<typename T::value_type>();
+            return elementSize == notFixedSize ? notFixedSize : std::tuple_size_v<T> * elementSize;
+        }
+#if JUCE_MODULE_AVAILABLE_juce_graphics
+        else if constexpr (IsPoint<T>)
+        {
+            return 2 * getFixedStreamedSize<decltype (T::x)>();
+        }
+#endif
+        else if constexpr (IsReflectedAggregate<T>)
+        {
+            return getFixedAggregatePayloadSize<T> (std::make_index_sequence<pfr::tuple_size_v<T>> {});
+        }
+        else
+        {
+            return notFixedSize;
+        }
+    }
+
+    /** Returns the serialized size of a type whose size is known at compile-time, or notFixedSize. */
+    template <typename T>
+    static constexpr size_t getFixedStreamedSize()
+    {
+        constexpr auto payloadSize = getFixedPayloadSize<T>();
+        if constexpr (payloadSize == notFixedSize)
+            return notFixedSize;
+        else if constexpr (std::is_arithmetic_v<T>)
+            return sizeof (Tag) + payloadSize;
+        else
+            return getArrayHeaderSize (getNumFixedChildren<T>(), payloadSize) + payloadSize;
+    }
+
+    template <typename T>
+    static size_t getStreamedSize (const T& object, StreamContext& context)
+    {
+        if constexpr (getFixedStreamedSize<T>() != notFixedSize)
+        {
+            return getFixedStreamedSize<T>();
+        }
+        else if constexpr (IsString<T>)
+        {
+            const auto numBytes = getNumStringBytes (object);
+            return sizeof (Tag) + getVarIntSize (numBytes) + numBytes;
+        }
+        else if constexpr (HasCustomSerialization<T>)
+        {
+            context.customElements.push_back (T::template serialize<BinarySerializer> (object));
+            return getFlattenedSize (context.customElements.back());
+        }
+        else
+        {
+            // the payload size is filled in once the children have been sized
+            const auto payloadSizeIndex = context.arrayPayloadSizes.size();
+            context.arrayPayloadSizes.push_back (0);
+
+            size_t payloadSize = 0;
+            size_t numChildren = 0;
+            if constexpr (TypeTraits::IsMapLike<T>)
+            {
+                for (const auto& [key, value] : object)
+                    payloadSize += getStreamedSize (key, context) + getStreamedSize (value, context);
+                numChildren = 2 * (size_t) std::size (object);
+            }
+            else if constexpr (TypeTraits::IsIterable<T>)
+            {
+                using ElementType = std::decay_t<decltype (*std::begin (object))>;
+                numChildren = (size_t) std::distance (std::begin (object), std::end (object));
+                if constexpr (getFixedStreamedSize<ElementType>() != notFixedSize)
+                {
+                    payloadSize = numChildren * getFixedStreamedSize<ElementType>();
+                }
+                else
+                {
+                    for (const auto& value : object)
+                        payloadSize += getStreamedSize (value, context);
+                }
+            }
+            else
+            {
+                static_assert (IsReflectedAggregate<T>, "Type cannot be serialized!");
+                pfr::for_each_field (object, [&payloadSize, &context] (const auto& field)
+                                     { payloadSize += getStreamedSize (field, context); });
+                numChildren = pfr::tuple_size_v<T>;
+            }
+
+            context.arrayPayloadSizes[payloadSizeIndex] = payloadSize;
+            return getArrayHeaderSize (numChildren, payloadSize) + payloadSize;
+        }
+    }
+
+    template <typename T>
+    static std::byte* writeStreamed (const T& object, std::byte* dest, StreamContext& context)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            dest = writeInt (dest, (uint8_t) ArithmeticTraits<T>::tag);
+            writeArithmetic (dest, object);
+            return dest + ArithmeticTraits<T>::size;
+        }
+        else if constexpr (IsString<T>)
+        {
+            const auto numBytes = getNumStringBytes (object);
+            const auto* stringData = reinterpret_cast<const std::byte*> (getStringData (object));
+            dest = writeInt (dest, (uint8_t) Tag::String);
+            dest = writeVarInt (dest, numBytes);
+            return std::copy (stringData, stringData + numBytes, dest);
+        }
+        else if constexpr (HasCustomSerialization<T>)
+        {
+            return writeFlattened (context.customElements[context.nextCustomElement++], dest);
+        }
+        else
+        {
+            size_t payloadSize;
+            if constexpr (getFixedPayloadSize<T>() != notFixedSize)
+                payloadSize = getFixedPayloadSize<T>();
+            else
+                payloadSize = context.arrayPayloadSizes[context.nextArrayPayloadSize++];
+
+            if constexpr (TypeTraits::IsMapLike<T>)
+            {
+                dest = writeArrayHeader (dest, 2 * (size_t) std::size (object), payloadSize);
+                for (const auto& [key, value] : object)
+                {
+                    dest = writeStreamed (key, dest, context);
+                    dest = writeStreamed (value, dest, context);
+                }
+            }
+#if JUCE_MODULE_AVAILABLE_juce_graphics
+            else if constexpr (IsPoint<T>)
+            {
+                dest = writeArrayHeader (dest, 2, payloadSize);
+                dest = writeStreamed (object.x, dest, context);
+                dest = writeStreamed (object.y, dest, context);
+            }
+#endif
+            else if constexpr (TypeTraits::IsIterable<T>)
+            {
+                dest = writeArrayHeader (dest, (size_t) std::distance (std::begin (object), std::end (object)), payloadSize);
+                for (const auto& value : object)
+                    dest = writeStreamed (value, dest, context);
+            }
+            else
+            {
+                dest = writeArrayHeader (dest, pfr::tuple_size_v<T>, payloadSize);
+                pfr::for_each_field (object, [&dest, &context] (const auto& field)
+                                     { dest = writeStreamed (field, dest, context); });
+            }
+
+            return dest;
+        }
+    }
+
+    template <typename T>
+    static size_t getNumStringBytes (const T& x)
+    {
+        if constexpr (std::is_same_v<T, juce::String>)
+            return x.getNumBytesAsUTF8();
+        else
+            return x.size();
+    }
+
+    template <typename T>
+    static const char* getStringData (const T& x)
+    {
+        if constexpr (std::is_same_v<T, juce::String>)
+            return x.toRawUTF8();
+        else
+            return x.data();
+    }
+
+    /** Iterates over the children of an array element, in order. */
+    struct ChildReader
+    {
+        explicit ChildReader (View arrayView)
+        {
+            ElementInfo info;
+            if (parseElement (arrayView, info) && info.tag == Tag::Array)
+            {
+                children = info.payload;
+                numChildren = info.numChildren;
+            }
+        }
+
+        View next() noexcept
+        {
+            ElementInfo info;
+            if (childIndex >= numChildren || ! parseElement ({ children.data + offset, children.size - offset }, info))
+                return {};
+
+            const View child { children.data + offset, info.size };
+            offset += info.size;
+            childIndex++;
+            return child;
+        }
+
+        View children {};
+        size_t offset = 0;
+        int numChildren = 0;
+        int childIndex = 0;
+    };
+
+    /** Resets an object to its "empty" state, when it can't be found in the serialized data. */
+    template <typename T>
+    static void resetStreamed (T& object)
+    {
+        if constexpr (std::is_arithmetic_v<T> || IsString<T> || TypeTraits::IsMapLike<T>)
+            object = T {};
+        else if constexpr (IsStdArray<T>::value)
+            std::fill (object.begin(), object.end(), typename T::value_type {});
+        else if constexpr (IsStdVector<T>::value)
+            object.clear();
+        else if constexpr (IsReflectedAggregate<T> && ! HasCustomDeserialization<T>)
+            pfr::for_each_field (object, [] (auto& field)
+                                 { resetStreamed (field); });
+    }
+
+    template <typename T>
+    static void readStreamed (View view, T& object)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            object = readArithmetic<T> (view);
+        }
+        else if constexpr (IsString<T>)
+        {
+            object = readString<T> (view);
+        }
+        else if constexpr (HasCustomDeserialization<T>)
+        {
+            T::template deserialize<BinarySerializer> (createExternalElement (view), object);
+        }
+#if JUCE_MODULE_AVAILABLE_juce_graphics
+        else if constexpr (IsPoint<T>)
+        {
+            ChildReader reader { view };
+            if (reader.numChildren != 2)
+            {
+                jassertfalse; // the serialized data is not a point!
+                object = T {};
+                return;
+            }
+
+            readStreamed (reader.next(), object.x);
+            readStreamed (reader.next(), object.y);
+        }
+#endif
+        else if constexpr (TypeTraits::IsMapLike<T>)
+        {
+            ChildReader reader { view };
+            if (reader.numChildren % 2 != 0)
+            {
+                jassertfalse; // map-like data structure was not properly serialized!
+                return;
+            }
+
+            object.clear();
+            for (int i = 0; i < reader.numChildren; i += 2)
+            {
+                typename T::key_type key {};
+                typename T::mapped_type value {};
+                readStreamed (reader.next(), key);
+                readStreamed (reader.next(), value);
+                object.emplace (std::move (key), std::move (value));
+            }
+        }
+        else if constexpr (IsStdArray<T>::value)
+        {
+            ChildReader reader { view };
+            if (reader.numChildren != (int) std::tuple_size_v<T>)
+            {
+                jassertfalse; // the serialized data has the wrong number of elements for this array!
+                resetStreamed (object);
+                return;
+            }
+
+            for (auto& value : object)
+                readStreamed (reader.next(), value);
+        }
+        else if constexpr (IsStdVector<T>::value)
+        {
+            ChildReader reader { view };
+            object.resize ((size_t) reader.numChildren);
+            for (auto& value : object)
+                readStreamed (reader.next(), value);
+        }
+        else
+        {
+            static_assert (IsReflectedAggregate<T>, "Type cannot be deserialized!");
+
+            ChildReader reader { view };
+            pfr::for_each_field (object, [&reader] (auto& field)
+                                 {
+                                     if (reader.childIndex < reader.numChildren)
+                                         readStreamed (reader.next(), field);
+                                     else
+                                         resetStreamed (field);
+                                 });
+        }
+    }
+};
+} // namespace chowdsp
@@ -7,7 +7,7 @@ BEGIN_JUCE_MODULE_DECLARATION
    vendor:        Chowdhury DSP
    version:       2.0.0
    name:          ChowDSP Serialization Utilities
-   description:   Utility methods for serializing data structures into XML, JSON, or some other format
+   description:   Utility methods for serializing data structures into XML, JSON, binary, or some other format
    dependencies:  juce_core, chowdsp_core, chowdsp_json, chowdsp_reflection
 
    website:       https://ccrma.stanford.edu/~jatin/chowdsp
@@ -30,3 +30,4 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "Serialization/chowdsp_Serialization.h"
 #include "Serialization/chowdsp_JSONSerializer.h"
 #include "Serialization/chowdsp_XMLSerializer.h"
+#include "Serialization/chowdsp_BinarySerializer.h"
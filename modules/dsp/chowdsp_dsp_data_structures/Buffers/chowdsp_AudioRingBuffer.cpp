@@ -0,0 +1,152 @@
+#include "chowdsp_AudioRingBuffer.h"
+
+namespace chowdsp
+{
+template <typename SampleType>
+AudioRingBuffer<SampleType>::AudioRingBuffer (int numChannels, int newCapacity, OverrunPolicy overrunPolicy, int maxContiguousReadSize)
+{
+    prepare (numChannels, newCapacity, overrunPolicy, maxContiguousReadSize);
+}
+
+template <typename SampleType>
+void AudioRingBuffer<SampleType>::prepare (int numChannels, int newCapacity, OverrunPolicy overrunPolicy, int maxContiguousReadSize)
+{
+    jassert (newCapacity > 0);
+    jassert (maxContiguousReadSize <= newCapacity); // contiguous regions can't be larger than the buffer!
+    capacity = newCapacity;
+    mirrorSize = juce::jlimit (0, capacity, maxContiguousReadSize);
+    buffer.setMaxSize (numChannels, capacity + mirrorSize);
+    policy = overrunPolicy;
+    reset();
+}
+
+template <typename SampleType>
+void AudioRingBuffer<SampleType>::reset()
+{
+    buffer.clear();
+    writePosition.store (0);
+    pendingWritePosition.store (0);
+    readPosition.store (0);
+    numLostSamples.store (0);
+}
+
+template <typename SampleType>
+int AudioRingBuffer<SampleType>::push (const BufferView<const SampleType>& data) noexcept
+{
+    jassert (data.getNumChannels() == getNumChannels());
+
+    const auto numSamples = (int64_t) data.getNumSamples();
+    if (capacity == 0 || numSamples == 0)
+        return 0;
+
+    auto writePos = writePosition.load (std::memory_order_relaxed);
+    int64_t samplesToWrite;
+    int64_t srcStartSample = 0;
+    if (policy == OverrunPolicy::DropNewest)
+    {
+        const auto numFreeSamples = (int64_t) capacity - (writePos - readPosition.load (std::memory_order_acquire));
+        samplesToWrite = juce::jmin (numSamples, numFreeSamples);
+        if (samplesToWrite < numSamples)
+            numLostSamples.fetch_add (numSamples - samplesToWrite, std::memory_order_relaxed);
+    }
+    else
+    {
+        // if the block is larger than the whole buffer, only the end of the block is kept
+        samplesToWrite = juce::jmin (numSamples, (int64_t) capacity);
+        srcStartSample = numSamples - samplesToWrite;
+        writePos += srcStartSample;
+    }
+
+    if (samplesToWrite == 0)
+        return 0;
+
+    // Let the consumer know which samples are about to be overwritten, before touching
+    // the data. The release fence keeps the data writes from being reordered before this
+    // store, so a consumer that sees any of the new data will also see this position.
+    pendingWritePosition.store (writePos + samplesToWrite, std::memory_order_relaxed);
+    std::atomic_thread_fence (std::memory_order_release);
+
+    const auto startIndex = (int) (writePos % capacity);
+    const auto samplesTillEnd = juce::jmin ((int) samplesToWrite, capacity - startIndex);
+    const auto numChannels = juce::jmin (data.getNumChannels(), getNumChannels());
+    BufferMath::copyBufferData (data, buffer, (int) srcStartSample, startIndex, samplesTillEnd, 0, numChannels);
+    BufferMath::copyBufferData (data, buffer, (int) srcStartSample + samplesTillEnd, 0, (int) samplesToWrite - samplesTillEnd, 0, numChannels);
+
+    // mirror any samples that were written to the start of the buffer past the end of the buffer
+    if (startIndex < mirrorSize)
+        BufferMath::copyBufferData (data, buffer, (int) srcStartSample, capacity + startIndex, juce::jmin (samplesTillEnd, mirrorSize - startIndex), 0, numChannels);
+    BufferMath::copyBufferData (data, buffer, (int) srcStartSample + samplesTillEnd, capacity, juce::jmin ((int) samplesToWrite - samplesTillEnd, mirrorSize), 0, numChannels);
+
+    writePosition.store (writePos + samplesToWrite, std::memory_order_release);
+    return (int) samplesToWrite;
+}
+
+template <typename SampleType>
+int AudioRingBuffer<SampleType>::getNumSamplesAvailable() const noexcept
+{
+    const auto numUnreadSamples = writePosition.load (std::memory_order_acquire) - readPosition.load (std::memory_order_relaxed);
+    return (int) juce::jmin (numUnreadSamples, (int64_t) getCapacity());
+}
+
+template <typename SampleType>
+typename AudioRingBuffer<SampleType>::ReadRegion AudioRingBuffer<SampleType>::getReadRegion (int numSamples) noexcept
+{
+    const auto writePos = writePosition.load (std::memory_order_acquire);
+    auto readPos = readPosition.load (std::memory_order_relaxed);
+
+    // skip over any data that has already been overwritten
+    if (const auto numOverwrittenSamples = writePos - readPos - (int64_t) getCapacity(); numOverwrittenSamples > 0)
+    {
+        numLostSamples.fetch_add (numOverwrittenSamples, std::memory_order_relaxed);
+        readPos += numOverwrittenSamples;
+        readPosition.store (readPos, std::memory_order_release);
+    }
+
+    return getRegion (readPos, (int) juce::jmin ((int64_t) numSamples, writePos - readPos));
+}
+
+template <typename SampleType>
+void AudioRingBuffer<SampleType>::finishedReading (int numSamples) noexcept
+{
+    const auto readPos = readPosition.load (std::memory_order_relaxed);
+    const auto newReadPos = juce::jmin (readPos + (int64_t) numSamples, writePosition.load (std::memory_order_acquire));
+    readPosition.store (newReadPos, std::memory_order_release);
+}
+
+template <typename SampleType>
+typename AudioRingBuffer<SampleType>::ReadRegion AudioRingBuffer<SampleType>::getLatestRegion (int numSamples) const noexcept
+{
+    jassert (numSamples <= getCapacity()); // can't read more samples than the buffer can hold!
+    numSamples = juce::jmin (numSamples, getCapacity());
+    return getRegion (writePosition.load (std::memory_order_acquire) - numSamples, numSamples);
+}
+
+template <typename SampleType>
+bool AudioRingBuffer<SampleType>::isRegionValid (const ReadRegion& region) const noexcept
+{
+    // Seqlock-style check: the acquire fence pairs with the release fence in push(), so if the
+    // consumer has read any data from a push that is in progress, then the pending write position
+    // from that push (or a later one) will be visible here.
+    std::atomic_thread_fence (std::memory_order_acquire);
+    return pendingWritePosition.load (std::memory_order_relaxed) - region.startPosition <= (int64_t) capacity;
+}
+
+template <typename SampleType>
+typename AudioRingBuffer<SampleType>::ReadRegion AudioRingBuffer<SampleType>::getRegion (int64_t startPosition, int numSamples) const noexcept
+{
+    if (capacity == 0 || numSamples <= 0)
+        return { { buffer, 0, 0 }, { buffer, 0, 0 }, startPosition };
+
+    // positions before the start of the buffer (i.e. silence) wrap around to the end of the buffer
+    const auto startIndex = (int) (((startPosition % capacity) + capacity) % capacity);
+    const auto samplesTillEnd = numSamples <= mirrorSize ? numSamples : juce::jmin (numSamples, capacity - startIndex);
+    return {
+        { buffer, startIndex, samplesTillEnd },
+        { buffer, 0, numSamples - samplesTillEnd },
+        startPosition,
+    };
+}
+
+template class AudioRingBuffer<float>;
+template class AudioRingBuffer<double>;
+} // namespace chowdsp
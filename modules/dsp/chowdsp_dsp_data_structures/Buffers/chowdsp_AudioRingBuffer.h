@@ -0,0 +1,145 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A lock-free, multi-channel ring buffer, for passing audio from a single
+ * producer thread (e.g. the audio thread) to a single consumer thread
+ * (e.g. a background thread that computes data for an audio visualizer).
+ *
+ * The consumer reads data through BufferViews that point directly into the
+ * ring buffer, so the data does not need to be copied out. Since the buffer
+ * wraps around, a region of data may be split between two views. If the
+ * consumer needs contiguous data, the buffer can be prepared with a
+ * `maxContiguousReadSize`, in which case the producer mirrors the start of
+ * the buffer past its end, and any region up to that size is returned as
+ * a single view.
+ *
+ * Note that this class is not resizable while the producer or consumer
+ * are running.
+ */
+template <typename SampleType>
+class AudioRingBuffer
+{
+public:
+    /** What to do when the producer pushes more data than the consumer has read. */
+    enum class OverrunPolicy
+    {
+        /**
+         * The oldest data is overwritten, so the buffer always holds the most
+         * recent data. This is usually what you want for visualizers, but
+         * note that data can be overwritten while the consumer is reading it
+         * (see isRegionValid()).
+         */
+        OverwriteOldest,
+
+        /** New data is dropped if the buffer is full, so the consumer receives every sample in order. */
+        DropNewest,
+    };
+
+    /** A region of data in the ring buffer. */
+    struct ReadRegion
+    {
+        BufferView<const SampleType> block1;
+        BufferView<const SampleType> block2; // the part of the region that wraps around to the start of the buffer
+        int64_t startPosition = 0; // position of the first sample in the region, relative to the total number of samples pushed
+
+        /** Returns the total number of samples in the region. */
+        [[nodiscard]] int getNumSamples() const noexcept { return block1.getNumSamples() + block2.getNumSamples(); }
+
+        /** Copies the region into a buffer. */
+        template <typename BufferType>
+        void copyTo (BufferType& dest, int destStartSample = 0) const noexcept
+        {
+            const auto numChannels = juce::jmin (block1.getNumChannels(), dest.getNumChannels());
+            BufferMath::copyBufferData (block1, dest, 0, destStartSample, block1.getNumSamples(), 0, numChannels);
+            BufferMath::copyBufferData (block2, dest, 0, destStartSample + block1.getNumSamples(), block2.getNumSamples(), 0, numChannels);
+        }
+    };
+
+    /** Default constructor */
+    AudioRingBuffer() = default;
+
+    /** Creates a ring buffer with a given size */
+    AudioRingBuffer (int numChannels, int capacity, OverrunPolicy overrunPolicy = OverrunPolicy::OverwriteOldest, int maxContiguousReadSize = 0);
+
+    /**
+     * Allocates memory for the ring buffer, and clears its state.
+     * This must not be called while the producer or consumer are running!
+     *
+     * Regions with up to maxContiguousReadSize samples will always be returned
+     * in a single view (i.e. block2 will be empty). This costs the producer an
+     * extra write for each sample that lands in the first maxContiguousReadSize
+     * samples of the buffer.
+     */
+    void prepare (int numChannels, int capacity, OverrunPolicy overrunPolicy = OverrunPolicy::OverwriteOldest, int maxContiguousReadSize = 0);
+
+    /** Clears the ring buffer. This must not be called while the producer or consumer are running! */
+    void reset();
+
+    /** Returns the number of channels in the ring buffer. */
+    [[nodiscard]] int getNumChannels() const noexcept { return buffer.getNumChannels(); }
+
+    /** Returns the maximum number of samples that the ring buffer can hold. */
+    [[nodiscard]] int getCapacity() const noexcept { return capacity; }
+
+    /**
+     * Producer: pushes a block of samples into the ring buffer,
+     * and returns the number of samples that were written.
+     */
+    int push (const BufferView<const SampleType>& data) noexcept;
+
+    /** Returns the total number of samples that have been pushed into the buffer. */
+    [[nodiscard]] int64_t getTotalNumSamplesPushed() const noexcept { return writePosition.load (std::memory_order_acquire); }
+
+    /** Consumer: returns the number of samples that are ready to be read. */
+    [[nodiscard]] int getNumSamplesAvailable() const noexcept;
+
+    /**
+     * Consumer: returns the oldest unread region of data, with at most numSamples samples.
+     * When you're done with the data, call finishedReading().
+     */
+    [[nodiscard]] ReadRegion getReadRegion (int numSamples) noexcept;
+
+    /** Consumer: marks the given number of samples as read. */
+    void finishedReading (int numSamples) noexcept;
+
+    /**
+     * Consumer: returns the most recent numSamples samples that have been pushed
+     * into the buffer, without marking anything as read. If fewer than numSamples
+     * samples have been pushed, the region will start with silence.
+     */
+    [[nodiscard]] ReadRegion getLatestRegion (int numSamples) const noexcept;
+
+    /**
+     * Consumer: returns false if some of the data in the region may have been
+     * overwritten by the producer since the region was obtained, including by
+     * a push that is still in progress. This can only happen with
+     * OverrunPolicy::OverwriteOldest.
+     *
+     * Call this after you're done reading from the region: if it returns true,
+     * then the data that was read is intact.
+     */
+    [[nodiscard]] bool isRegionValid (const ReadRegion& region) const noexcept;
+
+    /** Returns the number of samples that have been dropped, or overwritten before being read. */
+    [[nodiscard]] int64_t getNumLostSamples() const noexcept { return numLostSamples.load (std::memory_order_relaxed); }
+
+private:
+    ReadRegion getRegion (int64_t startPosition, int numSamples) const noexcept;
+
+    Buffer<SampleType> buffer;
+    int capacity = 0;
+    int mirrorSize = 0; // number of samples at the start of the buffer that are mirrored past the end
+    OverrunPolicy policy = OverrunPolicy::OverwriteOldest;
+
+    // the read and write positions are on separate cache lines so that the producer and consumer don't interfere with each other
+    static constexpr size_t cacheLineSize = 64;
+    alignas (cacheLineSize) std::atomic<int64_t> writePosition { 0 };
+    std::atomic<int64_t> pendingWritePosition { 0 }; // the end of the push that is in progress, published before the data is written
+    alignas (cacheLineSize) std::atomic<int64_t> readPosition { 0 };
+    alignas (cacheLineSize) std::atomic<int64_t> numLostSamples { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioRingBuffer)
+};
+} // namespace chowdsp
@@ -0,0 +1,230 @@
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#elif defined(_M_ARM64)
+#include <intrin.h>
+#endif
+
+#if defined(_WIN32)
+// declared here, to avoid including <windows.h>
+extern "C"
+{
+    __declspec (dllimport) void* __stdcall GetCurrentThread();
+    __declspec (dllimport) int __stdcall SetThreadPriority (void* hThread, int nPriority);
+}
+#else
+#include <pthread.h>
+#endif
+
+namespace chowdsp
+{
+namespace
+{
+    void cpuPause() noexcept
+    {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        _mm_pause();
+#elif defined(_M_ARM64)
+        __yield();
+#elif defined(__aarch64__) || defined(__arm__)
+        __asm__ __volatile__ ("yield");
+#endif
+    }
+
+    bool setCurrentThreadToRealtimePriority() noexcept
+    {
+#if defined(_WIN32)
+        constexpr int timeCriticalPriority = 15; // THREAD_PRIORITY_TIME_CRITICAL
+        return SetThreadPriority (GetCurrentThread(), timeCriticalPriority) != 0;
+#else
+        sched_param param {};
+        param.sched_priority = sched_get_priority_max (SCHED_FIFO) - 1;
+        return pthread_setschedparam (pthread_self(), SCHED_FIFO, &param) == 0;
+#endif
+    }
+} // namespace
+
+ForkJoinPool::ForkJoinPool() : ForkJoinPool (Options {})
+{
+}
+
+ForkJoinPool::ForkJoinPool (const Options& opts) : options (opts)
+{
+    for (int i = 0; i < options.numWorkers; ++i)
+    {
+        auto& worker = *workers.emplace_back (std::make_unique<Worker>());
+        worker.thread = std::thread { [this, &worker]
+                                      { workerLoop (worker); } };
+    }
+}
+
+ForkJoinPool::~ForkJoinPool()
+{
+    shouldExit.store (true);
+    for (auto& worker : workers)
+    {
+        if (worker->isParked.exchange (false))
+            worker->wakeUp.signal();
+    }
+
+    for (auto& worker : workers)
+        worker->thread.join();
+}
+
+void ForkJoinPool::runJob (int numTasks, JobFunction function, void* context)
+{
+    if (numTasks <= 0)
+        return;
+
+    const auto runSerial = [&]
+    {
+        for (int taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+            function (context, taskIndex);
+    };
+
+    // a nested or concurrent call can't use the workers
+    if (callerIsActive.test_and_set (std::memory_order_acquire))
+    {
+        runSerial();
+        return;
+    }
+
+    const auto finishCall = [this]
+    { callerIsActive.clear (std::memory_order_release); };
+
+    if (workers.empty() || numTasks == 1)
+    {
+        runSerial();
+        finishCall();
+        return;
+    }
+
+    if (const auto fallbackCalls = serialFallbackCallsRemaining.load (std::memory_order_relaxed); fallbackCalls > 0)
+    {
+        serialFallbackCallsRemaining.store (fallbackCalls - 1, std::memory_order_relaxed);
+        runSerial();
+        finishCall();
+        return;
+    }
+
+    // A worker may still be leaving the previous job. It won't start any more
+    // tasks from that job, but we can't modify the job until it has left.
+    const auto startTime = Clock::now();
+    while (numActiveWorkers.load() != 0)
+    {
+        if (Clock::now() - startTime > options.deadline)
+        {
+            runSerial();
+            finishCall();
+            return;
+        }
+        cpuPause();
+    }
+
+    jobFunction = function;
+    jobContext = context;
+    jobNumTasks = numTasks;
+    nextTaskIndex.store (0, std::memory_order_relaxed);
+    numTasksCompleted.store (0, std::memory_order_relaxed);
+    jobIsOpen.store (true);
+    jobID.fetch_add (1);
+
+    // the calling thread will run at least one task, so we don't need to wake up more than numTasks - 1 workers
+    int numWorkersWoken = 0;
+    for (auto& worker : workers)
+    {
+        if (numWorkersWoken >= numTasks - 1)
+            break;
+
+        if (worker->isParked.exchange (false))
+            worker->wakeUp.signal();
+        ++numWorkersWoken;
+    }
+
+    runTasks();
+
+    // wait for the workers to finish the tasks that they've started
+    const auto waitStartTime = Clock::now();
+    bool deadlineMissed = false;
+    while (numTasksCompleted.load (std::memory_order_acquire) < numTasks)
+    {
+        if (! deadlineMissed && Clock::now() - waitStartTime > options.deadline)
+            deadlineMissed = true;
+        cpuPause();
+    }
+
+    jobIsOpen.store (false);
+
+    if (deadlineMissed)
+    {
+        numDeadlineMisses.fetch_add (1, std::memory_order_relaxed);
+        serialFallbackCallsRemaining.store (options.numSerialFallbackCalls, std::memory_order_relaxed);
+    }
+
+    finishCall();
+}
+
+void ForkJoinPool::runTasks() noexcept
+{
+    while (true)
+    {
+        const auto taskIndex = nextTaskIndex.fetch_add (1, std::memory_order_relaxed);
+        if (taskIndex >= jobNumTasks)
+            return;
+
+        jobFunction (jobContext, taskIndex);
+        numTasksCompleted.fetch_add (1, std::memory_order_release);
+    }
+}
+
+void ForkJoinPool::workerLoop (Worker& worker)
+{
+    if (options.useRealtimePriority)
+        setCurrentThreadToRealtimePriority();
+
+    uint64_t lastJobID = 0;
+    while (true)
+    {
+        waitForNewJob (worker, lastJobID);
+        if (shouldExit.load())
+            return;
+
+        lastJobID = jobID.load();
+
+        // While a worker is active, the calling thread won't modify the job,
+        // so the job data is safe to read if the job is still open.
+        numActiveWorkers.fetch_add (1);
+        if (jobIsOpen.load())
+            runTasks();
+        numActiveWorkers.fetch_sub (1);
+    }
+}
+
+void ForkJoinPool::waitForNewJob (Worker& worker, uint64_t lastJobID)
+{
+    const auto hasNewJob = [this, lastJobID]
+    { return jobID.load() != lastJobID || shouldExit.load(); };
+
+    const auto spinStartTime = Clock::now();
+    while (! hasNewJob())
+    {
+        if (Clock::now() - spinStartTime < options.spinTime)
+        {
+            cpuPause();
+            continue;
+        }
+
+        // Park the worker. The calling thread will signal the semaphore if
+        // it sees that the worker is parked, after starting a new job.
+        worker.isParked.store (true);
+        if (hasNewJob())
+        {
+            // if the calling thread has already un-parked us, we need to consume its signal
+            if (! worker.isParked.exchange (false))
+                worker.wakeUp.wait();
+            return;
+        }
+
+        worker.wakeUp.wait();
+    }
+}
+} // namespace chowdsp
@@ -0,0 +1,131 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A pool of worker threads that can be used by the audio thread to split
+ * independent work (e.g. processing for separate channels or voices) across
+ * multiple cores, within a single audio callback.
+ *
+ * The worker threads are created with the pool, so `parallelFor()` never
+ * allocates memory or creates threads. When the pool is idle, the workers spin
+ * for a short time waiting for new work, and then park on a semaphore until
+ * they are woken up by the next call to `parallelFor()`.
+ *
+ * The calling thread always works on the tasks alongside the workers, and any
+ * tasks that the workers haven't started are picked up by the calling thread,
+ * so a worker that is slow to wake up can't delay the callback by more than the
+ * time it takes to finish the task that it's already working on. If waiting for
+ * the workers takes longer than the deadline given in the Options, the pool
+ * falls back to processing serially on the calling thread for a while.
+ *
+ * @code
+ * forkJoinPool.parallelFor (buffer.getNumChannels(), [&] (int channel)
+ * {
+ *     channelProcessors[channel].processBlock (buffer.getWritePointer (channel), buffer.getNumSamples());
+ * });
+ * @endcode
+ *
+ * Note that `parallelFor()` should only be called from one thread at a time.
+ */
+class ForkJoinPool
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        /** The number of worker threads, in addition to the thread calling parallelFor(). */
+        int numWorkers = 1;
+
+        /** How long the workers spin waiting for new work, before parking. */
+        std::chrono::microseconds spinTime { 100 };
+
+        /**
+         * If true, the workers will try to set their priority to real-time
+         * (e.g. SCHED_FIFO on Linux, which may require extra permissions).
+         */
+        bool useRealtimePriority = false;
+
+        /**
+         * The longest time that parallelFor() should wait for the workers to
+         * finish their tasks, after the calling thread has finished its own.
+         */
+        std::chrono::microseconds deadline { 1000 };
+
+        /** The number of parallelFor() calls to process serially after the deadline has been missed. */
+        int numSerialFallbackCalls = 256;
+    };
+
+    /** Creates a pool with the default options, and starts the worker threads. */
+    ForkJoinPool();
+
+    /** Creates the pool, and starts the worker threads. */
+    explicit ForkJoinPool (const Options& options);
+
+    /** Stops the worker threads. */
+    ~ForkJoinPool();
+
+    /** Returns the number of worker threads in the pool. */
+    [[nodiscard]] int getNumWorkers() const noexcept { return (int) workers.size(); }
+
+    /**
+     * Calls taskFunction (taskIndex) for each taskIndex in [0, numTasks),
+     * spread across the worker threads and the calling thread, and returns
+     * once all the tasks have been completed.
+     *
+     * The tasks must be independent of each other, since they may be run
+     * in any order, on any thread.
+     */
+    template <typename TaskFunction>
+    void parallelFor (int numTasks, TaskFunction&& taskFunction)
+    {
+        using FunctionType = std::remove_reference_t<TaskFunction>;
+        runJob (numTasks,
+                [] (void* context, int taskIndex)
+                { (*static_cast<FunctionType*> (context)) (taskIndex); },
+                const_cast<void*> (static_cast<const void*> (std::addressof (taskFunction))));
+    }
+
+    /** Returns the number of times that parallelFor() has missed its deadline. */
+    [[nodiscard]] uint64_t getNumDeadlineMisses() const noexcept { return numDeadlineMisses.load (std::memory_order_relaxed); }
+
+    /** Returns true if the next call to parallelFor() will be processed serially, after a missed deadline. */
+    [[nodiscard]] bool isUsingSerialFallback() const noexcept { return serialFallbackCallsRemaining.load (std::memory_order_relaxed) > 0; }
+
+private:
+    using JobFunction = void (*) (void*, int);
+
+    struct Worker
+    {
+        std::thread thread;
+        moodycamel::spsc_sema::LightweightSemaphore wakeUp;
+        std::atomic_bool isParked { false };
+    };
+
+    void runJob (int numTasks, JobFunction function, void* context);
+    void runTasks() noexcept;
+    void workerLoop (Worker& worker);
+    void waitForNewJob (Worker& worker, uint64_t lastJobID);
+
+    const Options options;
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::atomic_bool shouldExit { false };
+
+    // the current job, which is only modified while no workers are active
+    JobFunction jobFunction = nullptr;
+    void* jobContext = nullptr;
+    int jobNumTasks = 0;
+    std::atomic<int> nextTaskIndex { 0 };
+    std::atomic<int> numTasksCompleted { 0 };
+    std::atomic_bool jobIsOpen { false };
+    std::atomic<uint64_t> jobID { 0 };
+    std::atomic<int> numActiveWorkers { 0 };
+
+    std::atomic_flag callerIsActive = ATOMIC_FLAG_INIT;
+    std::atomic<int> serialFallbackCallsRemaining { 0 };
+    std::atomic<uint64_t> numDeadlineMisses { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE (ForkJoinPool)
+};
+} // namespace chowdsp
@@ -1,10 +1,15 @@
 #include "chowdsp_dsp_data_structures.h"
 
 #include "Buffers/chowdsp_Buffer.cpp"
+#include "Buffers/chowdsp_AudioRingBuffer.cpp"
 #include "Other/chowdsp_SmoothedBufferValue.cpp"
 #include "Processors/chowdsp_RebufferedProcessor.cpp"
 #include "LookupTables/chowdsp_LookupTableTransform.cpp"
 
+#if ! JUCE_TEENSY
+#include "Threads/chowdsp_ForkJoinPool.cpp"
+#endif
+
 #if JUCE_MODULE_AVAILABLE_juce_dsp
 #include "Processors/chowdsp_COLAProcessor.cpp"
 #endif
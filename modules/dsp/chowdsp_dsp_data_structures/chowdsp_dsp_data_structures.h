@@ -22,6 +22,8 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 //STL includes
 #include <array>
+#include <chrono>
+#include <thread>
 #include <unordered_map>
 
 //JUCE includes
@@ -39,6 +41,7 @@ JUCE_END_IGNORE_WARNINGS_GCC_LIKE
 #if ! JUCE_TEENSY // readerwriterqueue does not compile with the Teensy toolchain
 #include "third_party/moodycamel/readerwriterqueue.h"
 #include "third_party/moodycamel/concurrentqueue.h"
+#include "Threads/chowdsp_ForkJoinPool.h"
 #endif
 
 #include "Other/chowdsp_ScopedValue.h"
@@ -47,6 +50,7 @@ JUCE_END_IGNORE_WARNINGS_GCC_LIKE
 #include "Buffers/chowdsp_Buffer.h"
 #include "Buffers/chowdsp_StaticBuffer.h"
 #include "Buffers/chowdsp_BufferView.h"
+#include "Buffers/chowdsp_AudioRingBuffer.h"
 #include "Buffers/chowdsp_SIMDBufferHelpers.h"
 
 #include "Processors/chowdsp_RebufferedProcessor.h"
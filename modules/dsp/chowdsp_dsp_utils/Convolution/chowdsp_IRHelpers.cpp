@@ -126,7 +126,7 @@ void makeMinimumPhase (float* minimumPhaseIR, const float* originalIR, int numSa
                 freqDomainData.end(),
                 arg_H.begin(),
                 [] (auto H)
-                { return std::log (H); });
+                { return std::log (std::max (std::real (H), std::numeric_limits<float>::min())); }); // avoid log(0) for IRs with spectral nulls
 
             hilbert (arg_H.data(), arg_H.data(), numSamples);
 
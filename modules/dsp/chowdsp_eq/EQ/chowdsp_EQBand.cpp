@@ -378,4 +378,86 @@ void EQBand<FloatType, FilterChoices...>::process (const ProcessContext& context
     prevFilterType = filterType;
 }
 
+template <typename FloatType, typename... FilterChoices>
+template <typename FilterType>
+constexpr bool EQBand<FloatType, FilterChoices...>::isBiquadFilterType()
+{
+    if constexpr (std::is_base_of_v<IIRFilter<FilterType::Order, FloatType>, FilterType>)
+        return FilterType::Order <= 2;
+    else if constexpr (std::is_same_v<StateVariableFilter<FloatType, FilterType::Type>, FilterType>)
+        return FilterType::Type != StateVariableFilterType::MultiMode && FilterType::Type != StateVariableFilterType::Crossover;
+    else
+        return false;
+}
+
+template <typename FloatType, typename... FilterChoices>
+bool EQBand<FloatType, FilterChoices...>::isBiquadCompatible() const noexcept
+{
+    return biquadCompatibleFilters[(size_t) filterType];
+}
+
+template <typename FloatType, typename... FilterChoices>
+bool EQBand<FloatType, FilterChoices...>::processSmoothing (int numSamples) noexcept
+{
+    freqSmooth.process (freqHzHandle, numSamples);
+    qSmooth.process (qHandle, numSamples);
+    gainSmooth.process (gainHandle, numSamples);
+
+    // the fused processor interpolates between filter types, so we don't need to fade
+    prevFilterType = filterType;
+
+    return freqSmooth.isSmoothing() || qSmooth.isSmoothing() || gainSmooth.isSmoothing();
+}
+
+template <typename FloatType, typename... FilterChoices>
+void EQBand<FloatType, FilterChoices...>::calcBiquadCoefficients (int sampleIndex, NumericType (&b)[3], NumericType (&a)[3])
+{
+    jassert (isBiquadCompatible());
+
+    const auto getValue = [sampleIndex] (const auto& smoother)
+    { return smoother.isSmoothing() ? smoother.getSmoothedBuffer()[sampleIndex] : smoother.getCurrentValue(); };
+    const auto curFreq = getValue (freqSmooth);
+    const auto curQ = getValue (qSmooth);
+    const auto curGain = getValue (gainSmooth);
+
+    TupleHelpers::forEachInTuple (
+        [&] (auto& filter, size_t filterIndex)
+        {
+            using FilterType = std::remove_reference_t<decltype (filter)>;
+            if constexpr (isBiquadFilterType<FilterType>())
+            {
+                if ((int) filterIndex != filterType)
+                    return;
+
+                if constexpr (std::is_base_of_v<IIRFilter<FilterType::Order, FloatType>, FilterType>)
+                {
+                    if constexpr (! FilterType::HasQParameter)
+                        filter.calcCoefs (curFreq, fs);
+                    else if constexpr (! FilterType::HasGainParameter)
+                        filter.calcCoefs (curFreq, curQ, fs);
+                    else
+                        filter.calcCoefs (curFreq, curQ, curGain, fs);
+
+                    // pad first-order filters out to a biquad
+                    const auto* bCoefs = filter.getBCoefs();
+                    const auto* aCoefs = filter.getACoefs();
+                    const auto a0Inv = (NumericType) 1 / aCoefs[0];
+                    for (size_t i = 0; i < 3; ++i)
+                    {
+                        b[i] = i <= FilterType::Order ? bCoefs[i] * a0Inv : (NumericType) 0;
+                        a[i] = i <= FilterType::Order ? aCoefs[i] * a0Inv : (NumericType) 0;
+                    }
+                }
+                else
+                {
+                    filter.template setCutoffFrequency<false> (curFreq);
+                    filter.template setQValue<false> (curQ);
+                    filter.template setGain<false> (curGain);
+                    filter.getBiquadCoefficients (b, a);
+                }
+            }
+        },
+        filters);
+}
+
 } // namespace chowdsp::EQ
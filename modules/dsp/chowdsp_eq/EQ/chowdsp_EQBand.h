@@ -64,7 +64,34 @@ public:
     template <typename ProcessContext>
     void process (const ProcessContext& context) noexcept;
 
+    /**
+     * Returns true if the band's currently selected filter can be represented
+     * as a single biquad section, so that the band can be processed by
+     * EQProcessor's fused processing mode.
+     */
+    [[nodiscard]] bool isBiquadCompatible() const noexcept;
+
+    /**
+     * Advances the band's parameter smoothing by a block of samples, without processing any audio.
+     * Returns true if the band parameters are changing during this block.
+     *
+     * This is used by EQProcessor's fused processing mode, and should not be used together with
+     * processBlock() or process().
+     */
+    bool processSmoothing (int numSamples) noexcept;
+
+    /**
+     * Computes the biquad coefficients for the band's currently selected filter, using the smoothed
+     * parameter values at a given sample index of the block most recently passed to processSmoothing().
+     *
+     * The band's currently selected filter must be biquad-compatible!
+     */
+    void calcBiquadCoefficients (int sampleIndex, NumericType (&b)[3], NumericType (&a)[3]);
+
 private:
+    template <typename FilterType>
+    static constexpr bool isBiquadFilterType();
+
     template <typename FilterType, typename T = FloatType, size_t N = FilterType::Order>
     std::enable_if_t<std::is_base_of_v<IIRFilter<N, T>, FilterType> || std::is_base_of_v<SOSFilter<N, T>, FilterType> || std::is_base_of_v<SOSFilter<N - 1, T>, FilterType>, void>
         processFilterChannel (FilterType& filter, const BufferView<FloatType>& block);
@@ -80,6 +107,7 @@ private:
     void fadeBuffers (const FloatType* fadeInBuffer, const FloatType* fadeOutBuffer, FloatType* targetBuffer, int numSamples) const;
 
     static constexpr auto numFilterChoices = sizeof...(FilterChoices);
+    static constexpr std::array<bool, numFilterChoices> biquadCompatibleFilters { isBiquadFilterType<FilterChoices>()... };
     using Filters = std::tuple<FilterChoices...>;
     Filters filters;
 
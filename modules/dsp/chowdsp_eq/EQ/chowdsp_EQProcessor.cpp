@@ -1,7 +1,11 @@
 namespace chowdsp::EQ
 {
 template <typename FloatType, size_t numBands, typename EQBandType>
-EQProcessor<FloatType, numBands, EQBandType>::EQProcessor() = default;
+EQProcessor<FloatType, numBands, EQBandType>::EQProcessor()
+{
+    std::fill (fusedCoefs.begin(), fusedCoefs.end(), identityCoefs);
+    std::fill (fusedCoefsDirty.begin(), fusedCoefsDirty.end(), true);
+}
 
 template <typename FloatType, size_t numBands, typename EQBandType>
 void EQProcessor<FloatType, numBands, EQBandType>::setCutoffFrequency (int band, NumericType newCutoffHz)
@@ -36,6 +40,7 @@ void EQProcessor<FloatType, numBands, EQBandType>::setFilterType (int band, int
 {
     jassert (juce::isPositiveAndBelow (band, (int) numBands));
     bands[(size_t) band].setFilterType (newFilterType);
+    fusedCoefsDirty[(size_t) band] = true;
 }
 
 template <typename FloatType, size_t numBands, typename EQBandType>
@@ -43,6 +48,7 @@ void EQProcessor<FloatType, numBands, EQBandType>::setBandOnOff (int band, bool
 {
     jassert (juce::isPositiveAndBelow (band, (int) numBands));
     onOffs[(size_t) band] = shouldBeOn;
+    fusedCoefsDirty[(size_t) band] = true;
 }
 
 template <typename FloatType, size_t numBands, typename EQBandType>
@@ -53,6 +59,10 @@ void EQProcessor<FloatType, numBands, EQBandType>::prepare (const juce::dsp::Pro
         bands[i].prepare (spec);
         bypasses[i].prepare (spec, onOffs[i]);
     }
+
+    fusedNumChannelGroups = ((int) spec.numChannels + (int) fusedVecSize - 1) / (int) fusedVecSize;
+    fusedState.resize ((size_t) fusedNumChannelGroups * numBands * 2);
+    reset();
 }
 
 template <typename FloatType, size_t numBands, typename EQBandType>
@@ -60,11 +70,66 @@ void EQProcessor<FloatType, numBands, EQBandType>::reset()
 {
     for (auto& band : bands)
         band.reset();
+
+    std::fill (fusedState.begin(), fusedState.end(), FusedVec {});
+    std::fill (fusedCoefs.begin(), fusedCoefs.end(), identityCoefs);
+    std::fill (fusedCoefsDirty.begin(), fusedCoefsDirty.end(), true);
+    fusedCoefsNeedInit = true;
+}
+
+template <typename FloatType, size_t numBands, typename EQBandType>
+void EQProcessor<FloatType, numBands, EQBandType>::setFusedProcessing (bool shouldUseFusedProcessing, int coefficientUpdateInterval)
+{
+    jassert (coefficientUpdateInterval > 0);
+    jassert (! shouldUseFusedProcessing || std::is_floating_point_v<FloatType>); // fused processing is only available for scalar types!
+
+    useFusedProcessing = shouldUseFusedProcessing && std::is_floating_point_v<FloatType>;
+    fusedUpdateInterval = coefficientUpdateInterval;
+}
+
+template <typename FloatType, size_t numBands, typename EQBandType>
+bool EQProcessor<FloatType, numBands, EQBandType>::canUseFusedProcessing() const noexcept
+{
+    if (! useFusedProcessing)
+        return false;
+
+    for (size_t i = 0; i < numBands; ++i)
+    {
+        if (onOffs[i] && ! bands[i].isBiquadCompatible())
+            return false;
+    }
+
+    return true;
 }
 
 template <typename FloatType, size_t numBands, typename EQBandType>
 void EQProcessor<FloatType, numBands, EQBandType>::processBlock (const BufferView<FloatType>& block) noexcept
 {
+    if constexpr (std::is_floating_point_v<FloatType>)
+    {
+        if (canUseFusedProcessing())
+        {
+            if (! wasUsingFusedProcessing)
+            {
+                std::fill (fusedState.begin(), fusedState.end(), FusedVec {});
+                std::fill (fusedCoefsDirty.begin(), fusedCoefsDirty.end(), true);
+                fusedCoefsNeedInit = true;
+                wasUsingFusedProcessing = true;
+            }
+
+            processBlockFused (block);
+            return;
+        }
+    }
+
+    if (wasUsingFusedProcessing)
+    {
+        // the band filters have not been running, so their state is out-of-date
+        for (auto& band : bands)
+            band.reset();
+        wasUsingFusedProcessing = false;
+    }
+
     for (size_t i = 0; i < numBands; ++i)
     {
         if (! bypasses[i].processBlockIn (block, onOffs[i]))
@@ -75,4 +140,131 @@ void EQProcessor<FloatType, numBands, EQBandType>::processBlock (const BufferVie
         bypasses[i].processBlockOut (block, onOffs[i]);
     }
 }
+
+template <typename FloatType, size_t numBands, typename EQBandType>
+void EQProcessor<FloatType, numBands, EQBandType>::processBlockFused (const BufferView<FloatType>& block) noexcept
+{
+    const auto numSamples = block.getNumSamples();
+    jassert ((block.getNumChannels() + (int) fusedVecSize - 1) / (int) fusedVecSize <= fusedNumChannelGroups);
+
+    std::array<bool, numBands> isSmoothing {};
+    for (size_t i = 0; i < numBands; ++i)
+        isSmoothing[i] = bands[i].processSmoothing (numSamples);
+
+    for (int segmentStart = 0; segmentStart < numSamples; segmentStart += fusedUpdateInterval)
+    {
+        const auto segmentLength = juce::jmin (fusedUpdateInterval, numSamples - segmentStart);
+        const auto segmentLengthInv = (NumericType) 1 / (NumericType) segmentLength;
+
+        // update the coefficients for any bands that are changing, and collect the active sections
+        size_t numSections = 0;
+        bool isRamping = false;
+        for (size_t i = 0; i < numBands; ++i)
+        {
+            auto targetCoefs = fusedCoefs[i];
+            if (isSmoothing[i] || fusedCoefsDirty[i])
+            {
+                targetCoefs = identityCoefs;
+                if (onOffs[i])
+                {
+                    NumericType b[3], a[3];
+                    bands[i].calcBiquadCoefficients (segmentStart + segmentLength - 1, b, a);
+                    targetCoefs = { b[0], b[1], b[2], a[1], a[2] };
+                }
+                fusedCoefsDirty[i] = false;
+
+                // no need to interpolate from the initial coefficients
+                if (fusedCoefsNeedInit)
+                    fusedCoefs[i] = targetCoefs;
+            }
+
+            if (targetCoefs == identityCoefs && fusedCoefs[i] == identityCoefs)
+                continue; // bypassed band, no need to process!
+
+            for (size_t k = 0; k < 5; ++k)
+            {
+                sectionCoefs[k][numSections] = fusedCoefs[i][k];
+                sectionCoefDeltas[k][numSections] = (targetCoefs[k] - fusedCoefs[i][k]) * segmentLengthInv;
+                isRamping |= targetCoefs[k] != fusedCoefs[i][k];
+            }
+            sectionBandIndex[numSections++] = i;
+            fusedCoefs[i] = targetCoefs;
+        }
+
+        fusedCoefsNeedInit = false;
+        if (numSections == 0)
+            continue;
+
+        if (isRamping)
+            processFusedSegment<true> (block, segmentStart, segmentLength, numSections);
+        else
+            processFusedSegment<false> (block, segmentStart, segmentLength, numSections);
+    }
+}
+
+template <typename FloatType, size_t numBands, typename EQBandType>
+template <bool isRamping>
+void EQProcessor<FloatType, numBands, EQBandType>::processFusedSegment (const BufferView<FloatType>& block, int startSample, int numSamples, size_t numSections) noexcept
+{
+    const auto numChannels = block.getNumChannels();
+    auto* const* channelData = block.getArrayOfWritePointers();
+
+    for (int group = 0; group * (int) fusedVecSize < numChannels; ++group)
+    {
+        const auto groupStartChannel = group * (int) fusedVecSize;
+        const auto groupNumChannels = juce::jmin ((int) fusedVecSize, numChannels - groupStartChannel);
+        auto* groupState = fusedState.data() + (size_t) group * numBands * 2;
+
+        // load the state for the active sections
+        FusedVec z1[numBands], z2[numBands];
+        for (size_t s = 0; s < numSections; ++s)
+        {
+            z1[s] = groupState[sectionBandIndex[s] * 2];
+            z2[s] = groupState[sectionBandIndex[s] * 2 + 1];
+        }
+
+        auto coefs = sectionCoefs;
+        alignas (SIMDUtils::defaultSIMDAlignment) NumericType frame[fusedVecSize] {};
+        for (int n = startSample; n < startSample + numSamples; ++n)
+        {
+            for (int ch = 0; ch < groupNumChannels; ++ch)
+                frame[ch] = channelData[groupStartChannel + ch][n];
+
+#if ! CHOWDSP_NO_XSIMD
+            auto x = xsimd::load_aligned (frame);
+#else
+            auto x = frame[0];
+#endif
+
+            for (size_t s = 0; s < numSections; ++s)
+            {
+                const auto y = z1[s] + x * coefs[0][s];
+                z1[s] = z2[s] + x * coefs[1][s] - y * coefs[3][s];
+                z2[s] = x * coefs[2][s] - y * coefs[4][s];
+                x = y;
+
+                if constexpr (isRamping)
+                {
+                    for (size_t k = 0; k < 5; ++k)
+                        coefs[k][s] += sectionCoefDeltas[k][s];
+                }
+            }
+
+#if ! CHOWDSP_NO_XSIMD
+            xsimd::store_aligned (frame, x);
+#else
+            frame[0] = x;
+#endif
+
+            for (int ch = 0; ch < groupNumChannels; ++ch)
+                channelData[groupStartChannel + ch][n] = frame[ch];
+        }
+
+        for (size_t s = 0; s < numSections; ++s)
+        {
+            groupState[sectionBandIndex[s] * 2] = z1[s];
+            groupState[sectionBandIndex[s] * 2 + 1] = z2[s];
+        }
+    }
+}
 } // namespace chowdsp::EQ
@@ -59,11 +59,64 @@ public:
     /** Processes an audio block */
     void processBlock (const BufferView<FloatType>& block) noexcept;
 
+    /**
+     * Enables or disables fused processing.
+     *
+     * In fused mode, all the active bands are processed together as a single
+     * cascade of biquad sections, with groups of channels processed in parallel
+     * SIMD lanes. The band coefficients are cached, and only re-computed when
+     * the band parameters change. For bands that are being smoothed, the coefficients
+     * are computed once every `coefficientUpdateInterval` samples, and linearly
+     * interpolated in between. Changes to the band filter types or on/off states
+     * are also handled by interpolating the coefficients, rather than cross-fading.
+     *
+     * Fused processing is only available for scalar sample types, and requires that
+     * the currently selected filter for every active band is biquad-compatible (see
+     * EQBand::isBiquadCompatible()). Otherwise, the bands are processed one at a time.
+     * Switching between the two processing modes may cause a discontinuity in the output.
+     */
+    void setFusedProcessing (bool shouldUseFusedProcessing, int coefficientUpdateInterval = 32);
+
+    /** Returns true if fused processing has been enabled. */
+    [[nodiscard]] bool isFusedProcessingEnabled() const noexcept { return useFusedProcessing; }
+
 private:
+    [[nodiscard]] bool canUseFusedProcessing() const noexcept;
+    void processBlockFused (const BufferView<FloatType>& block) noexcept;
+
+    template <bool isRamping>
+    void processFusedSegment (const BufferView<FloatType>& block, int startSample, int numSamples, size_t numSections) noexcept;
+
     std::array<EQBandType, numBands> bands;
     std::array<BypassProcessor<FloatType>, numBands> bypasses;
     std::array<bool, numBands> onOffs = { false };
 
+#if ! CHOWDSP_NO_XSIMD
+    using FusedVec = xsimd::batch<NumericType>;
+#else
+    using FusedVec = NumericType;
+#endif
+    static constexpr auto fusedVecSize = sizeof (FusedVec) / sizeof (NumericType);
+
+    /** Biquad coefficients stored as { b0, b1, b2, a1, a2 } */
+    using BiquadCoefs = std::array<NumericType, 5>;
+    static constexpr BiquadCoefs identityCoefs { (NumericType) 1, (NumericType) 0, (NumericType) 0, (NumericType) 0, (NumericType) 0 };
+
+    bool useFusedProcessing = false;
+    bool wasUsingFusedProcessing = false;
+    int fusedUpdateInterval = 32;
+
+    std::array<BiquadCoefs, numBands> fusedCoefs;
+    std::array<bool, numBands> fusedCoefsDirty;
+    bool fusedCoefsNeedInit = true;
+    std::vector<FusedVec> fusedState; // [channel group][band][state]
+    int fusedNumChannelGroups = 0;
+
+    // structure-of-arrays scratch data for the active sections
+    std::array<std::array<NumericType, numBands>, 5> sectionCoefs {};
+    std::array<std::array<NumericType, numBands>, 5> sectionCoefDeltas {};
+    std::array<size_t, numBands> sectionBandIndex {};
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EQProcessor)
 };
 } // namespace chowdsp::EQ
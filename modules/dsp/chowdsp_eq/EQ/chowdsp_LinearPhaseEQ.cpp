@@ -2,6 +2,17 @@
 
 namespace chowdsp::EQ
 {
+template <typename PrototypeEQ, int defaultFIRLength>
+LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::LinearPhaseEQ() : juce::Thread ("Linear Phase EQ Design Thread")
+{
+}
+
+template <typename PrototypeEQ, int defaultFIRLength>
+LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::~LinearPhaseEQ()
+{
+    stopThread (-1);
+}
+
 template <typename PrototypeEQ, int defaultFIRLength>
 int LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::getIRSize (double sampleRate)
 {
@@ -18,39 +29,75 @@ int LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::getIRSize (double sampleRate)
 template <typename PrototypeEQ, int defaultFIRLength>
 void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::prepare (const juce::dsp::ProcessSpec& spec, const ProtoEQParams& initialParams)
 {
-    stopTimer();
+    stopThread (-1);
 
     fs = spec.sampleRate;
     maxBlockSize = (int) spec.maximumBlockSize;
     irSize = getIRSize (fs);
+    activePhaseMode = phaseMode;
 
     const auto fftOrder = Math::log2 (irSize);
     fft = std::make_unique<juce::dsp::FFT> (fftOrder);
 
     prototypeEQ.prepare ({ spec.sampleRate, (juce::uint32) irSize, 1 });
 
+    if (activePhaseMode == PhaseMode::Mixed)
+    {
+        // the convolution for the mixed phase IR is longer than the IR, so it needs a zero-padded FFT
+        mixedPhaseFFT = std::make_unique<juce::dsp::FFT> (fftOrder + 1);
+        for (auto& scratch : mixedPhaseScratch)
+            scratch.resize ((size_t) irSize * 2);
+    }
+
     irBuffer = juce::AudioBuffer<float> (1, irSize);
     params = { initialParams };
     updateParams();
 
+    // if the partition size is larger than the IR, we can just use uniform partitioning
+    headSize = tailPartitionSize > 0 ? juce::nextPowerOfTwo (tailPartitionSize) : irSize;
+    if (headSize >= irSize)
+        headSize = irSize;
+
     engines.clear();
+    tailEngines.clear();
     for (size_t ch = 0; ch < spec.numChannels; ++ch)
-        engines.push_back (std::make_unique<ConvolutionEngine<>> ((size_t) irSize, spec.maximumBlockSize, irBuffer.getWritePointer (0)));
+    {
+        engines.push_back (std::make_unique<ConvolutionEngine<>> ((size_t) headSize, spec.maximumBlockSize, irBuffer.getWritePointer (0)));
+
+        // the tail engine has exactly `headSize` samples of latency, which lines it up with the end of the head
+        if (headSize < irSize)
+            tailEngines.push_back (std::make_unique<ConvolutionEngine<>> ((size_t) (irSize - headSize), (size_t) headSize, irBuffer.getWritePointer (0) + headSize));
+    }
 
     irUpdateState.store (IRUpdateState::Good);
     irTransfer = std::make_unique<IRTransfer> (*engines[0]);
 
-    startTimer (10); // @TODO: should we expose the timer frequency to the user?
+    tailIRTransfer.reset();
+    if (! tailEngines.empty())
+    {
+        tailIRTransfer = std::make_unique<IRTransfer> (*tailEngines[0]);
+        tailBuffer = juce::AudioBuffer<float> (1, maxBlockSize);
+    }
+
+    startThread();
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
-void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::hiResTimerCallback()
+void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::run()
 {
-    if (irUpdateState == IRUpdateState::Needed)
+    while (! threadShouldExit())
     {
-        updateParams();
-        irTransfer->setNewIR (irBuffer.getReadPointer (0));
-        irUpdateState.store (IRUpdateState::Ready);
+        if (irUpdateState == IRUpdateState::Needed)
+        {
+            updateParams();
+            irTransfer->setNewIR (irBuffer.getReadPointer (0));
+            if (tailIRTransfer != nullptr)
+                tailIRTransfer->setNewIR (irBuffer.getReadPointer (0) + headSize);
+            irUpdateState.store (IRUpdateState::Ready);
+        }
+
+        // sleep until the parameters change again
+        wait (-1);
     }
 }
 
@@ -67,6 +114,7 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::setParameters (const ProtoEQP
     // refresh params
     params = { newParams };
     irUpdateState.store (IRUpdateState::Needed);
+    notify();
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
@@ -92,6 +140,49 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::updateParams()
 
     // halve the IR magnitude sicne we processed it twice
     IRHelpers::makeHalfMagnitude (irData, irData, irSize, *fft);
+
+    if (activePhaseMode == PhaseMode::Minimum)
+        IRHelpers::makeMinimumPhase (irData, irData, irSize, *fft);
+    else if (activePhaseMode == PhaseMode::Mixed)
+        makeMixedPhase (irData);
+}
+
+template <typename PrototypeEQ, int defaultFIRLength>
+void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::makeMixedPhase (float* irData)
+{
+    // The mixed phase IR is made by convolving a linear phase IR and a minimum phase IR,
+    // each with half the (dB) magnitude response of the full EQ. The linear phase part
+    // is windowed down to half the full IR length, so it only needs half the latency.
+    IRHelpers::makeHalfMagnitude (irData, irData, irSize, *fft);
+
+    auto& linearData = mixedPhaseScratch[0];
+    auto& minimumData = mixedPhaseScratch[1];
+    auto& freqData = mixedPhaseScratch[2];
+
+    const auto halfSize = irSize / 2;
+    const auto quarterSize = irSize / 4;
+    std::fill (linearData.begin(), linearData.end(), std::complex<float> {});
+    for (int n = 0; n < halfSize; ++n)
+    {
+        const auto window = 0.5f - 0.5f * std::cos (juce::MathConstants<float>::twoPi * (float) n / (float) halfSize);
+        linearData[(size_t) n] = irData[n + quarterSize] * window;
+    }
+    mixedPhaseFFT->perform (linearData.data(), freqData.data(), false);
+
+    IRHelpers::makeMinimumPhase (irData, irData, irSize, *fft);
+    std::fill (linearData.begin(), linearData.end(), std::complex<float> {});
+    std::copy (irData, irData + irSize, linearData.begin());
+    mixedPhaseFFT->perform (linearData.data(), minimumData.data(), false);
+
+    for (size_t k = 0; k < freqData.size(); ++k)
+        freqData[k] *= minimumData[k];
+
+    // The FFTs are zero-padded to twice the IR length, so this is a linear (not circular) convolution,
+    // with a length of 1.5x the IR length. The minimum phase part has mostly decayed by the end of the IR,
+    // so the result can be truncated to the IR length.
+    mixedPhaseFFT->perform (freqData.data(), linearData.data(), true);
+    std::transform (linearData.begin(), linearData.begin() + irSize, irData, [] (auto x)
+                    { return std::real (x); });
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
@@ -101,6 +192,16 @@ bool LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::attemptIRTransfer()
     if (! lock.isLocked())
         return false; // we weren't able to grab the irTransfer lock, so let's skip and  try again later!
 
+    if (tailIRTransfer != nullptr)
+    {
+        juce::SpinLock::ScopedTryLockType tailLock (tailIRTransfer->mutex);
+        if (! tailLock.isLocked())
+            return false;
+
+        for (const auto& eng : tailEngines)
+            tailIRTransfer->transferIR (*eng);
+    }
+
     // Lock acquired! Let's do the swap
     for (const auto& eng : engines)
         irTransfer->transferIR (*eng);
@@ -109,6 +210,23 @@ bool LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::attemptIRTransfer()
     return true;
 }
 
+template <typename PrototypeEQ, int defaultFIRLength>
+void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::processChannel (size_t channel, const float* input, float* output, size_t numSamples) noexcept
+{
+    if (tailEngines.empty())
+    {
+        engines[channel]->processSamples (input, output, numSamples);
+        return;
+    }
+
+    // the tail needs to be processed first, since the head may be processed in-place
+    jassert ((int) numSamples <= tailBuffer.getNumSamples()); // block size is larger than what was prepared!
+    auto* tailData = tailBuffer.getWritePointer (0);
+    tailEngines[channel]->processSamplesWithAddedLatency (input, tailData, numSamples);
+    engines[channel]->processSamples (input, output, numSamples);
+    juce::FloatVectorOperations::add (output, tailData, (int) numSamples);
+}
+
 template <typename PrototypeEQ, int defaultFIRLength>
 void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::processBlock (const BufferView<float>& buffer) noexcept
 {
@@ -119,11 +237,7 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::processBlock (const BufferVie
     const auto numSamples = buffer.getNumSamples();
 
     for (int ch = 0; ch < numChannels; ++ch)
-    {
-        engines[(size_t) ch]->processSamples (buffer.getReadPointer (ch),
-                                              buffer.getWritePointer (ch),
-                                              (size_t) numSamples);
-    }
+        processChannel ((size_t) ch, buffer.getReadPointer (ch), buffer.getWritePointer (ch), (size_t) numSamples);
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
@@ -133,11 +247,7 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::processBlocksInternal (const
     const auto numSamples = outBlock.getNumSamples();
 
     for (size_t ch = 0; ch < numChannels; ++ch)
-    {
-        engines[ch]->processSamples (inBlock.getChannelPointer (ch),
-                                     outBlock.getChannelPointer (ch),
-                                     numSamples);
-    }
+        processChannel (ch, inBlock.getChannelPointer (ch), outBlock.getChannelPointer (ch), numSamples);
 }
 
 template <typename PrototypeEQ, int defaultFIRLength>
@@ -161,6 +271,12 @@ void LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::process (const ProcessContext
 template <typename PrototypeEQ, int defaultFIRLength>
 int LinearPhaseEQ<PrototypeEQ, defaultFIRLength>::getLatencySamples() const noexcept
 {
+    if (activePhaseMode == PhaseMode::Minimum)
+        return 0;
+
+    if (activePhaseMode == PhaseMode::Mixed)
+        return irSize / 4;
+
     return irSize / 2;
 }
 } // namespace chowdsp::EQ
@@ -14,19 +14,57 @@ namespace chowdsp::EQ
  *   - `PrototypeEQ::processBlock (juce::AudioBuffer<float>&)` (note that the buffer passed in will only contain one channel)
  *
  * The defaultFIRLength represents the FIR filter length to use at 48 kHz sampling rate.
+ *
+ * The FIR filter is re-designed on a background thread, which only wakes up
+ * when the EQ parameters actually change. Along with linear phase, the FIR
+ * filter can also be designed as minimum phase (no latency), or mixed phase
+ * (half the latency and half the pre-ringing of linear phase).
  */
 template <typename PrototypeEQ, int defaultFIRLength = 4096>
-class LinearPhaseEQ : private juce::HighResolutionTimer
+class LinearPhaseEQ : private juce::Thread
 {
     using ProtoEQParams = typename PrototypeEQ::Params;
 
 public:
+    /** Phase response options for the EQ FIR filter. */
+    enum class PhaseMode
+    {
+        Linear, /**< Linear phase, with a latency of half the FIR length */
+        Minimum, /**< Minimum phase, with no latency */
+        Mixed, /**< Half linear phase and half minimum phase, with a latency of one quarter of the FIR length */
+    };
+
     /** Default constructor. */
-    LinearPhaseEQ() = default;
+    LinearPhaseEQ();
+
+    /** Destructor */
+    ~LinearPhaseEQ() override;
 
     /** Implement this function to update the prototype EQ parameters. */
     std::function<void (PrototypeEQ&, const ProtoEQParams&)> updatePrototypeEQParameters = nullptr;
 
+    /**
+     * Sets the phase response of the EQ FIR filter.
+     *
+     * Since this changes the latency of the EQ, the new phase mode
+     * will take effect on the next call to prepare().
+     */
+    void setPhaseMode (PhaseMode newPhaseMode) noexcept { phaseMode = newPhaseMode; }
+
+    /**
+     * Enables non-uniformly partitioned convolution. The first `partitionSize`
+     * samples of the FIR filter are convolved with partitions the size of the
+     * processing block, while the remainder of the filter is convolved with
+     * partitions of `partitionSize` samples. This does not add any latency, but
+     * can greatly reduce the CPU cost of processing with small block sizes.
+     *
+     * The partition size will be rounded up to the next power of two, and should
+     * be much larger than the processing block size. Set to zero to use uniformly
+     * partitioned convolution (the default). The new partition size will take
+     * effect on the next call to prepare().
+     */
+    void setTailPartitionSize (int partitionSize) noexcept { tailPartitionSize = partitionSize; }
+
     /** Prepares the EQ to process a new stream of data. */
     void prepare (const juce::dsp::ProcessSpec& spec, const ProtoEQParams& initialParams);
 
@@ -47,9 +85,11 @@ private:
     static int getIRSize (double sampleRate);
 
     void updateParams();
-    void hiResTimerCallback() override;
+    void makeMixedPhase (float* irData);
+    void run() override;
 
     bool attemptIRTransfer();
+    void processChannel (size_t channel, const float* input, float* output, size_t numSamples) noexcept;
     void processBlocksInternal (const AudioBlock<const float>& inputBlock, AudioBlock<float>& outputBlock) noexcept;
 
     PrototypeEQ prototypeEQ;
@@ -59,6 +99,16 @@ private:
     std::unique_ptr<IRTransfer> irTransfer;
     juce::AudioBuffer<float> irBuffer;
 
+    // convolution engines for the tail of the IR, when using non-uniform partitioning
+    std::vector<std::unique_ptr<ConvolutionEngine<>>> tailEngines;
+    std::unique_ptr<IRTransfer> tailIRTransfer;
+    juce::AudioBuffer<float> tailBuffer;
+
+    PhaseMode phaseMode = PhaseMode::Linear;
+    PhaseMode activePhaseMode = PhaseMode::Linear;
+    int tailPartitionSize = 0;
+    int headSize = 0;
+
     double fs = 48000.0;
     int maxBlockSize = 512;
     int irSize = 0;
@@ -72,6 +122,8 @@ private:
     std::atomic<IRUpdateState> irUpdateState;
 
     std::unique_ptr<juce::dsp::FFT> fft;
+    std::unique_ptr<juce::dsp::FFT> mixedPhaseFFT;
+    std::vector<std::complex<float>> mixedPhaseScratch[3];
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LinearPhaseEQ)
 };
@@ -147,6 +147,9 @@ public:
         }
     }
 
+    /** Returns the filter's first-order section */
+    [[nodiscard]] const IIRFilter<1, FloatType>& getFirstOrderSection() const noexcept { return firstOrderSection; }
+
 private:
     IIRFilter<1, FloatType> firstOrderSection;
 
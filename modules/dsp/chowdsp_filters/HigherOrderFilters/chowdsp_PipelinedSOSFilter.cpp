@@ -0,0 +1,153 @@
+namespace chowdsp
+{
+#ifndef DOXYGEN
+namespace PipelinedSOSHelpers
+{
+    /** Shifts each value up by one SIMD lane, and inserts a new value into the first lane */
+    template <typename T>
+    inline xsimd::batch<T> shiftIn (const xsimd::batch<T>& x, T newValue, const xsimd::batch_bool<T>& firstLaneMask) noexcept
+    {
+        using IntType = std::conditional_t<sizeof (T) == 4, int32_t, int64_t>;
+        const auto shifted = xsimd::bitwise_cast<xsimd::batch<T>> (xsimd::slide_left<sizeof (T)> (xsimd::bitwise_cast<xsimd::batch<IntType>> (x)));
+        return xsimd::select (firstLaneMask, xsimd::batch<T> (newValue), shifted);
+    }
+
+    template <typename T>
+    inline xsimd::batch<T> getLaneIndexes() noexcept
+    {
+        alignas (xsimd::default_arch::alignment()) T laneIndexes[xsimd::batch<T>::size] {};
+        for (size_t i = 0; i < xsimd::batch<T>::size; ++i)
+            laneIndexes[i] = (T) i;
+        return xsimd::load_aligned (laneIndexes);
+    }
+} // namespace PipelinedSOSHelpers
+#endif // DOXYGEN
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::prepare (int numChannels, int filterOrder)
+{
+    order = filterOrder;
+    numSections = (order + 1) / 2;
+    numGroups = (size_t) (numSections + vecSize - 1) / (size_t) vecSize;
+
+    // unused lanes are filled with pass-through sections
+    const auto numLanes = numGroups * (size_t) vecSize;
+    b0.assign (numLanes, (FloatType) 1);
+    for (auto* coefs : { &b1, &b2, &a1, &a2 })
+        coefs->assign (numLanes, (FloatType) 0);
+
+    state.resize ((size_t) numChannels);
+    for (auto& channelState : state)
+    {
+        channelState.z1.resize (numLanes);
+        channelState.z2.resize (numLanes);
+    }
+
+    reset();
+}
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::reset()
+{
+    for (auto& channelState : state)
+    {
+        std::fill (channelState.z1.begin(), channelState.z1.end(), (FloatType) 0);
+        std::fill (channelState.z2.begin(), channelState.z2.end(), (FloatType) 0);
+    }
+}
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::setCoefs (int section, const FloatType (&b)[3], const FloatType (&a)[3]) noexcept
+{
+    jassert (section < numSections);
+
+    b0[(size_t) section] = b[0];
+    b1[(size_t) section] = b[1];
+    b2[(size_t) section] = b[2];
+    a1[(size_t) section] = a[1];
+    a2[(size_t) section] = a[2];
+}
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::setFirstOrderCoefs (int section, const FloatType (&b)[2], const FloatType (&a)[2]) noexcept
+{
+    setCoefs (section, { b[0], b[1], (FloatType) 0 }, { a[0], a[1], (FloatType) 0 });
+}
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::processGroup (FloatType* block, const int numSamples, const int channel, size_t group) noexcept
+{
+    const auto offset = group * (size_t) vecSize;
+    const auto b0Vec = xsimd::load_aligned (b0.data() + offset);
+    const auto b1Vec = xsimd::load_aligned (b1.data() + offset);
+    const auto b2Vec = xsimd::load_aligned (b2.data() + offset);
+    const auto a1Vec = xsimd::load_aligned (a1.data() + offset);
+    const auto a2Vec = xsimd::load_aligned (a2.data() + offset);
+
+    auto& channelState = state[(size_t) channel];
+    auto z1 = xsimd::load_aligned (channelState.z1.data() + offset);
+    auto z2 = xsimd::load_aligned (channelState.z2.data() + offset);
+
+    const auto laneIndexes = PipelinedSOSHelpers::getLaneIndexes<FloatType>();
+    const auto firstLaneMask = laneIndexes == (FloatType) 0;
+
+    // At time step t, section k (in SIMD lane k) is processing sample n = t - k,
+    // so the last section outputs sample n at time step n + vecSize - 1.
+    static constexpr auto pipelineDelay = vecSize - 1;
+    const auto numSteps = numSamples + pipelineDelay;
+
+    Vec y {};
+    auto processStep = [&] (int t, auto isRamping)
+    {
+        const auto x = PipelinedSOSHelpers::shiftIn (y, t < numSamples ? block[t] : (FloatType) 0, firstLaneMask);
+        y = z1 + x * b0Vec;
+        const auto z1New = z2 + x * b1Vec - y * a1Vec;
+        const auto z2New = x * b2Vec - y * a2Vec;
+
+        if constexpr (decltype (isRamping)::value)
+        {
+            // while the pipeline is filling up (or draining), some sections are not yet
+            // (or no longer) processing valid samples, so their state should not be updated.
+            const auto stepVec = Vec ((FloatType) t);
+            const auto isActive = (laneIndexes <= stepVec) && (laneIndexes > stepVec - (FloatType) numSamples);
+            z1 = xsimd::select (isActive, z1New, z1);
+            z2 = xsimd::select (isActive, z2New, z2);
+        }
+        else
+        {
+            z1 = z1New;
+            z2 = z2New;
+        }
+
+        if (t >= pipelineDelay)
+            block[t - pipelineDelay] = y.get ((size_t) pipelineDelay);
+    };
+
+    int t = 0;
+    for (; t < juce::jmin (pipelineDelay, numSteps); ++t)
+        processStep (t, std::true_type {});
+    for (; t < numSamples; ++t)
+        processStep (t, std::false_type {});
+    for (; t < numSteps; ++t)
+        processStep (t, std::true_type {});
+
+    xsimd::store_aligned (channelState.z1.data() + offset, z1);
+    xsimd::store_aligned (channelState.z2.data() + offset, z2);
+}
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::processBlock (FloatType* block, const int numSamples, const int channel) noexcept
+{
+    for (size_t group = 0; group < numGroups; ++group)
+        processGroup (block, numSamples, channel, group);
+}
+
+template <typename FloatType>
+void PipelinedSOSFilter<FloatType>::processBlock (const BufferView<FloatType>& block) noexcept
+{
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    for (int channel = 0; channel < numChannels; ++channel)
+        processBlock (block.getWritePointer (channel), numSamples, channel);
+}
+} // namespace chowdsp
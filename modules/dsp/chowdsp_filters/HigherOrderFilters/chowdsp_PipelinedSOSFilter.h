@@ -0,0 +1,114 @@
+#if ! CHOWDSP_NO_XSIMD
+
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A higher-order filter made up of second-order sections, where the filter
+ * order is chosen at run-time.
+ *
+ * The section coefficients are stored in SoA arrays, and the sections are
+ * processed in SIMD lanes with a pipelined scheme: while section k is
+ * processing sample n, section k + 1 is processing sample n - 1. This allows
+ * a cascade of up to `Vec::size` sections to be processed with a throughput
+ * close to that of a single biquad filter. Each section is implemented in
+ * Transposed Direct Form II, so the output should match the equivalent
+ * `chowdsp::SOSFilter` up to floating-point rounding.
+ *
+ * Since the filter is pipelined across samples, it can only process blocks
+ * of samples, and not individual samples.
+ */
+template <typename FloatType = float>
+class PipelinedSOSFilter
+{
+public:
+    static_assert (std::is_floating_point_v<FloatType>, "PipelinedSOSFilter only supports scalar floating-point types!");
+
+    using Vec = xsimd::batch<FloatType>;
+
+    PipelinedSOSFilter() = default;
+
+    /**
+     * Prepares the filter to process a new stream of audio, with a given filter order.
+     * For odd filter orders, the last section should be a first-order section.
+     */
+    void prepare (int numChannels, int filterOrder);
+
+    /** Resets the filter state */
+    void reset();
+
+    /** Returns the current filter order */
+    [[nodiscard]] int getOrder() const noexcept { return order; }
+
+    /** Returns the number of second-order sections in the filter */
+    [[nodiscard]] int getNumSections() const noexcept { return numSections; }
+
+    /** Sets the coefficients for one of the second-order sections (a[0] is assumed to be 1) */
+    void setCoefs (int section, const FloatType (&b)[3], const FloatType (&a)[3]) noexcept;
+
+    /** Sets the coefficients for one of the sections, as a first-order filter (a[0] is assumed to be 1) */
+    void setFirstOrderCoefs (int section, const FloatType (&b)[2], const FloatType (&a)[2]) noexcept;
+
+    /**
+     * Copies the section coefficients from a compile-time order filter made up of
+     * second-order sections (e.g. chowdsp::ButterworthFilter). For odd-order filters,
+     * the first-order section is copied into the last section.
+     */
+    template <typename FilterType>
+    void setCoefs (const FilterType& filter) noexcept
+    {
+        static constexpr auto filterOrder = (int) FilterType::Order;
+        using SOSBase = SOSFilter<filterOrder - filterOrder % 2, FloatType>;
+        static_assert (std::is_base_of_v<SOSBase, FilterType>, "Filter must be made up of second-order sections!");
+        jassert ((filterOrder + 1) / 2 <= numSections); // this filter was not prepared with a high enough order!
+
+        const auto& sosFilter = static_cast<const SOSBase&> (filter);
+        for (int i = 0; i < filterOrder / 2; ++i)
+        {
+            const auto& section = sosFilter.getSection ((size_t) i);
+            const auto* b = section.getBCoefs();
+            const auto* a = section.getACoefs();
+            setCoefs (i, { b[0], b[1], b[2] }, { a[0], a[1], a[2] });
+        }
+
+        if constexpr (filterOrder % 2 == 1)
+        {
+            const auto& section = filter.getFirstOrderSection();
+            const auto* b = section.getBCoefs();
+            const auto* a = section.getACoefs();
+            setFirstOrderCoefs (filterOrder / 2, { b[0], b[1] }, { a[0], a[1] });
+        }
+    }
+
+    /** Process block of samples */
+    void processBlock (FloatType* block, int numSamples, int channel = 0) noexcept;
+
+    /** Process block of samples */
+    void processBlock (const BufferView<FloatType>& block) noexcept;
+
+private:
+    void processGroup (FloatType* block, int numSamples, int channel, size_t group) noexcept;
+
+    static constexpr auto vecSize = (int) Vec::size;
+
+    int order = 0;
+    int numSections = 0;
+    size_t numGroups = 0;
+
+    using VectorType = std::vector<FloatType, xsimd::default_allocator<FloatType>>;
+    VectorType b0, b1, b2, a1, a2;
+
+    struct ChannelState
+    {
+        VectorType z1, z2;
+    };
+    std::vector<ChannelState> state;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PipelinedSOSFilter)
+};
+} // namespace chowdsp
+
+#include "chowdsp_PipelinedSOSFilter.cpp"
+
+#endif // ! CHOWDSP_NO_XSIMD
@@ -65,6 +65,9 @@ public:
         }
     }
 
+    /** Returns one of the second-order sections of this filter */
+    [[nodiscard]] const IIRFilter<2, FloatType>& getSection (size_t index) const noexcept { return secondOrderSections[index]; }
+
 protected:
     std::array<IIRFilter<2, FloatType>, (size_t) order / 2> secondOrderSections;
 
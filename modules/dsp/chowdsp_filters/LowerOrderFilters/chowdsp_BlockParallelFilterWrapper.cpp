@@ -0,0 +1,189 @@
+namespace chowdsp
+{
+template <typename PrototypeFilter>
+void BlockParallelFilterWrapper<PrototypeFilter>::prepare (int numChannels)
+{
+    state.resize ((size_t) numChannels);
+    reset();
+}
+
+template <typename PrototypeFilter>
+void BlockParallelFilterWrapper<PrototypeFilter>::reset()
+{
+    for (auto& channelState : state)
+        std::fill (channelState.begin(), channelState.end(), SampleType (0));
+}
+
+template <typename PrototypeFilter>
+template <typename... Args>
+void BlockParallelFilterWrapper<PrototypeFilter>::calcCoefs (Args&&... args)
+{
+    prototypeFilter.calcCoefs (std::forward<Args> (args)...);
+    update();
+}
+
+template <typename PrototypeFilter>
+void BlockParallelFilterWrapper<PrototypeFilter>::setCoefs (const SampleType (&newB)[Order + 1], const SampleType (&newA)[Order + 1])
+{
+    prototypeFilter.setCoefs (newB, newA);
+    update();
+}
+
+template <typename PrototypeFilter>
+void BlockParallelFilterWrapper<PrototypeFilter>::update()
+{
+    // The Transposed Direct Form II filter has the state-space form:
+    // A = [-a_1, 1, 0, ...; -a_2, 0, 1, ...; ...], B = b_{1:N} - a_{1:N} b_0, C = [1, 0, ...], D = b_0
+    // The block matrices are computed in double precision, to avoid accumulating errors.
+    const auto* b = prototypeFilter.getBCoefs();
+    const auto* a = prototypeFilter.getACoefs();
+
+    using Matrix = std::array<std::array<double, Order>, Order>;
+    using Vector = std::array<double, Order>;
+
+    Matrix A {};
+    Vector B {};
+    b0 = b[0];
+    for (size_t i = 0; i < Order; ++i)
+    {
+        A[i][0] = -(double) a[i + 1];
+        if (i + 1 < Order)
+            A[i][i + 1] = 1.0;
+        B[i] = (double) b[i + 1] - (double) a[i + 1] * (double) b[0];
+
+        stateFeedback[i] = (SampleType) -a[i + 1];
+        stateInput[i] = (SampleType) B[i];
+    }
+
+    const auto rowTimesMatrix = [&A] (const Vector& row)
+    {
+        Vector result {};
+        for (size_t j = 0; j < Order; ++j)
+            for (size_t i = 0; i < Order; ++i)
+                result[j] += row[i] * A[i][j];
+        return result;
+    };
+
+    const auto matrixTimesColumn = [&A] (const Vector& column)
+    {
+        Vector result {};
+        for (size_t i = 0; i < Order; ++i)
+            for (size_t j = 0; j < Order; ++j)
+                result[i] += A[i][j] * column[j];
+        return result;
+    };
+
+    const auto dot = [] (const Vector& x, const Vector& y)
+    {
+        return std::inner_product (x.begin(), x.end(), y.begin(), 0.0);
+    };
+
+    alignas (xsimd::default_arch::alignment()) SampleType lanes[blockSize] {};
+
+    // rows of C A^k, for k = 0 ... L - 1, and the impulse response h[k] = D, C A^(k-1) B
+    std::array<Vector, blockSize> CAk {};
+    std::array<double, blockSize> impulseResponse {};
+    CAk[0][0] = 1.0;
+    impulseResponse[0] = (double) b[0];
+    for (size_t k = 1; k < blockSize; ++k)
+    {
+        CAk[k] = rowTimesMatrix (CAk[k - 1]);
+        impulseResponse[k] = dot (CAk[k - 1], B);
+    }
+
+    // O: the contribution of each state variable to each output in the block
+    for (size_t i = 0; i < Order; ++i)
+    {
+        for (size_t k = 0; k < blockSize; ++k)
+            lanes[k] = (SampleType) CAk[k][i];
+        stateToOutput[i] = xsimd::load_aligned (lanes);
+    }
+
+    // T: the contribution of each input sample to each output in the block (lower-triangular Toeplitz)
+    for (size_t j = 0; j < blockSize; ++j)
+    {
+        for (size_t k = 0; k < blockSize; ++k)
+            lanes[k] = k >= j ? (SampleType) impulseResponse[k - j] : SampleType (0);
+        inputToOutput[j] = xsimd::load_aligned (lanes);
+    }
+
+    // K: the contribution of each input sample to the next state, A^(L - 1 - j) B
+    std::array<Vector, blockSize> AkB {};
+    AkB[0] = B;
+    for (size_t k = 1; k < blockSize; ++k)
+        AkB[k] = matrixTimesColumn (AkB[k - 1]);
+
+    for (size_t i = 0; i < Order; ++i)
+    {
+        for (size_t j = 0; j < blockSize; ++j)
+            lanes[j] = (SampleType) AkB[blockSize - 1 - j][i];
+        inputToState[i] = xsimd::load_aligned (lanes);
+    }
+
+    // A^L: the contribution of the current state to the next state
+    Matrix AL {};
+    for (size_t i = 0; i < Order; ++i)
+        AL[i][i] = 1.0;
+    for (size_t k = 0; k < blockSize; ++k)
+        for (auto& row : AL)
+            row = rowTimesMatrix (row);
+
+    for (size_t i = 0; i < Order; ++i)
+        for (size_t j = 0; j < Order; ++j)
+            stateToState[i][j] = (SampleType) AL[i][j];
+}
+
+template <typename PrototypeFilter>
+inline typename BlockParallelFilterWrapper<PrototypeFilter>::SampleType
+    BlockParallelFilterWrapper<PrototypeFilter>::processSample (SampleType x, SampleType* s) const noexcept
+{
+    const auto s0 = s[0];
+    const auto y = s0 + b0 * x;
+    for (int i = 0; i < (int) Order - 1; ++i)
+        s[i] = s[i + 1] + stateFeedback[i] * s0 + stateInput[i] * x;
+    s[Order - 1] = stateFeedback[Order - 1] * s0 + stateInput[Order - 1] * x;
+    return y;
+}
+
+template <typename PrototypeFilter>
+void BlockParallelFilterWrapper<PrototypeFilter>::processBlock (SampleType* block, const int numSamples, const int channel) noexcept
+{
+    auto& s = state[(size_t) channel];
+
+    int n = 0;
+    for (; n + (int) blockSize <= numSamples; n += (int) blockSize)
+    {
+        const auto x = xsimd::load_unaligned (block + n);
+
+        auto y = stateToOutput[0] * s[0];
+        for (size_t i = 1; i < Order; ++i)
+            y += stateToOutput[i] * s[i];
+        for (size_t j = 0; j < blockSize; ++j)
+            y += inputToOutput[j] * block[n + (int) j];
+
+        SampleType newState[Order];
+        for (size_t i = 0; i < Order; ++i)
+        {
+            newState[i] = xsimd::reduce_add (inputToState[i] * x);
+            for (size_t j = 0; j < Order; ++j)
+                newState[i] += stateToState[i][j] * s[j];
+        }
+        std::copy (std::begin (newState), std::end (newState), s.begin());
+
+        xsimd::store_unaligned (block + n, y);
+    }
+
+    // process any leftover samples one at a time
+    for (; n < numSamples; ++n)
+        block[n] = processSample (block[n], s.data());
+}
+
+template <typename PrototypeFilter>
+void BlockParallelFilterWrapper<PrototypeFilter>::processBlock (const BufferView<SampleType>& block) noexcept
+{
+    const auto numChannels = block.getNumChannels();
+    const auto numSamples = block.getNumSamples();
+    for (int channel = 0; channel < numChannels; ++channel)
+        processBlock (block.getWritePointer (channel), numSamples, channel);
+}
+} // namespace chowdsp
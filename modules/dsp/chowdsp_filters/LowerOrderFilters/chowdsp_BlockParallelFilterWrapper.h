@@ -0,0 +1,84 @@
+#if ! CHOWDSP_NO_XSIMD
+
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Since IIR filters are recursive, a single-channel chowdsp::IIRFilter
+ * can't make use of SIMD lanes. This wrapper re-formulates a scalar
+ * IIRFilter (or any of the first or second order filters derived from it)
+ * as a state-space system, which is then "unrolled" so that a whole SIMD
+ * register of output samples can be computed at once, using a few
+ * matrix-vector products:
+ *
+ * \f[
+ * \vec{y}_k = O \vec{s}_k + T \vec{x}_k \\
+ * \vec{s}_{k+1} = A^L \vec{s}_k + K \vec{x}_k
+ * \f]
+ *
+ * where \f$ L \f$ is the SIMD register width. This works best for filters
+ * with fixed (or slowly changing) coefficients, since the block matrices
+ * need to be re-computed whenever the coefficients change.
+ *
+ * Reference: https://en.wikipedia.org/wiki/State-space_representation
+ */
+template <typename PrototypeFilter>
+class BlockParallelFilterWrapper
+{
+public:
+    using SampleType = typename PrototypeFilter::SampleType;
+    static constexpr auto Order = (size_t) PrototypeFilter::Order;
+    static_assert (std::is_floating_point_v<SampleType>, "Block-parallel processing is only supported for scalar filters!");
+
+    using Vec = xsimd::batch<SampleType>;
+    static constexpr auto blockSize = Vec::size;
+
+    BlockParallelFilterWrapper() = default;
+
+    /** Prepares the filter to process a new stream of audio */
+    void prepare (int numChannels);
+
+    /** Resets the filter state */
+    void reset();
+
+    /** Forwards arguments to the calcCoefs method of the prototype filter */
+    template <typename... Args>
+    void calcCoefs (Args&&... args);
+
+    /** Sets the filter coefficients directly (a[0] is assumed to be 1) */
+    void setCoefs (const SampleType (&newB)[Order + 1], const SampleType (&newA)[Order + 1]);
+
+    /** Process block of samples */
+    void processBlock (SampleType* block, int numSamples, int channel = 0) noexcept;
+
+    /** Process block of samples */
+    void processBlock (const BufferView<SampleType>& block) noexcept;
+
+private:
+    void update();
+
+    inline SampleType processSample (SampleType x, SampleType* s) const noexcept;
+
+    PrototypeFilter prototypeFilter;
+
+    // single-sample state-space matrices (in companion form)
+    SampleType b0 {};
+    SampleType stateFeedback[Order] {}; // first column of A
+    SampleType stateInput[Order] {}; // B
+
+    // block state-space matrices
+    Vec stateToOutput[Order] {}; // columns of O
+    Vec inputToOutput[blockSize] {}; // columns of T
+    Vec inputToState[Order] {}; // rows of K
+    SampleType stateToState[Order][Order] {}; // A^L
+
+    std::vector<std::array<SampleType, Order>> state;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BlockParallelFilterWrapper)
+};
+} // namespace chowdsp
+
+#include "chowdsp_BlockParallelFilterWrapper.cpp"
+
+#endif // ! CHOWDSP_NO_XSIMD
@@ -145,6 +145,12 @@ public:
         std::copy (newA, &newA[order + 1], a);
     }
 
+    /** Returns the current feed-forward coefficients */
+    [[nodiscard]] const FloatType* getBCoefs() const noexcept { return b; }
+
+    /** Returns the current feed-back coefficients */
+    [[nodiscard]] const FloatType* getACoefs() const noexcept { return a; }
+
 protected:
     FloatType a[order + 1];
     FloatType b[order + 1];
@@ -84,6 +84,43 @@ std::enable_if_t<M == StateVariableFilterType::MultiMode, void>
     bandpassMult *= juce::MathConstants<NumericType>::sqrt2;
 }
 
+template <typename SampleType, StateVariableFilterType type>
+template <StateVariableFilterType M>
+std::enable_if_t<M != StateVariableFilterType::MultiMode && M != StateVariableFilterType::Crossover, void>
+    StateVariableFilter<SampleType, type>::getBiquadCoefficients (SampleType (&b)[3], SampleType (&a)[3]) const noexcept
+{
+    // The SVF implements the analog prototype H(s) = (c2 s^2 + c1 s + c0) / (s^2 + k s + 1),
+    // discretized with the bilinear transform s = (1 / g) (1 - z^-1) / (1 + z^-1).
+    SampleType g, k, c0, c1, c2;
+    if constexpr (type == FilterType::Lowpass)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0, k0, (SampleType) 1, (SampleType) 0, (SampleType) 0);
+    else if constexpr (type == FilterType::Bandpass)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0, k0, (SampleType) 0, (SampleType) 1, (SampleType) 0);
+    else if constexpr (type == FilterType::Highpass)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0, k0, (SampleType) 0, (SampleType) 0, (SampleType) 1);
+    else if constexpr (type == FilterType::Notch)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0, k0, (SampleType) 1, (SampleType) 0, (SampleType) 1);
+    else if constexpr (type == FilterType::Allpass)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0, k0, (SampleType) 1, -k0, (SampleType) 1);
+    else if constexpr (type == FilterType::Bell)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0, k0 / A, (SampleType) 1, k0A, (SampleType) 1);
+    else if constexpr (type == FilterType::LowShelf)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0 / sqrtA, k0, Asq, k0A, (SampleType) 1);
+    else if constexpr (type == FilterType::HighShelf)
+        std::tie (g, k, c0, c1, c2) = std::make_tuple (g0 * sqrtA, k0, (SampleType) 1, k0A, Asq);
+
+    const auto gSq = g * g;
+    const auto a0Inv = (NumericType) 1 / ((NumericType) 1 + k * g + gSq);
+
+    b[0] = (c2 + c1 * g + c0 * gSq) * a0Inv;
+    b[1] = (NumericType) 2 * (c0 * gSq - c2) * a0Inv;
+    b[2] = (c2 - c1 * g + c0 * gSq) * a0Inv;
+
+    a[0] = (SampleType) 1;
+    a[1] = (NumericType) 2 * (gSq - (NumericType) 1) * a0Inv;
+    a[2] = ((NumericType) 1 - k * g + gSq) * a0Inv;
+}
+
 template <typename SampleType, StateVariableFilterType type>
 void StateVariableFilter<SampleType, type>::prepare (const juce::dsp::ProcessSpec& spec)
 {
@@ -94,6 +94,17 @@ public:
     /** Returns the gain of the filter. */
     [[nodiscard]] SampleType getGain() const noexcept { return gain; }
 
+    /**
+     * Computes the coefficients of a biquad filter with the same transfer function
+     * as the filter's current settings. Since the SVF is discretized with the
+     * trapezoidal rule, the biquad is equivalent to the SVF (for time-invariant settings).
+     *
+     * The coefficients are normalized such that a[0] = 1.
+     */
+    template <StateVariableFilterType M = type>
+    std::enable_if_t<M != StateVariableFilterType::MultiMode && M != StateVariableFilterType::Crossover, void>
+        getBiquadCoefficients (SampleType (&b)[3], SampleType (&a)[3]) const noexcept;
+
     /** Initialises the filter. */
     void prepare (const juce::dsp::ProcessSpec& spec);
 
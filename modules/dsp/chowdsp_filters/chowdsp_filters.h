@@ -36,9 +36,11 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include "LowerOrderFilters/chowdsp_SecondOrderFilters.h"
 #include "LowerOrderFilters/chowdsp_StateVariableFilter.h"
 #include "LowerOrderFilters/chowdsp_ModFilterWrapper.h"
+#include "LowerOrderFilters/chowdsp_BlockParallelFilterWrapper.h"
 
 #include "HigherOrderFilters/chowdsp_NthOrderFilter.h"
 #include "HigherOrderFilters/chowdsp_SOSFilter.h"
+#include "HigherOrderFilters/chowdsp_PipelinedSOSFilter.h"
 #include "HigherOrderFilters/chowdsp_ButterworthFilter.h"
 #include "HigherOrderFilters/chowdsp_ChebyshevIIFilter.h"
 #include "HigherOrderFilters/chowdsp_EllipticFilter.h"
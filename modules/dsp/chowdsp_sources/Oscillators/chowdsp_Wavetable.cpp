@@ -0,0 +1,134 @@
+namespace chowdsp
+{
+#ifndef DOXYGEN
+namespace WavetableHelpers
+{
+    /** In-place radix-2 FFT, used for generating the bandlimited tables. */
+    inline void fft (std::vector<std::complex<double>>& data, const std::vector<std::complex<double>>& twiddles, bool inverse) noexcept
+    {
+        const auto N = data.size();
+
+        // bit-reversal permutation
+        for (size_t i = 1, j = 0; i < N; ++i)
+        {
+            auto bit = N >> 1;
+            for (; (j & bit) != 0; bit >>= 1)
+                j ^= bit;
+            j ^= bit;
+
+            if (i < j)
+                std::swap (data[i], data[j]);
+        }
+
+        for (size_t length = 2; length <= N; length <<= 1)
+        {
+            const auto twiddleStep = N / length;
+            for (size_t start = 0; start < N; start += length)
+            {
+                for (size_t k = 0; k < length / 2; ++k)
+                {
+                    const auto w = inverse ? std::conj (twiddles[k * twiddleStep]) : twiddles[k * twiddleStep];
+                    const auto u = data[start + k];
+                    const auto v = data[start + k + length / 2] * w;
+                    data[start + k] = u + v;
+                    data[start + k + length / 2] = u - v;
+                }
+            }
+        }
+    }
+} // namespace WavetableHelpers
+#endif
+
+inline Wavetable::~Wavetable()
+{
+    waitUntilReady();
+}
+
+inline bool Wavetable::generate (const std::vector<std::vector<float>>& frames)
+{
+    if (! startGenerating (frames))
+        return false;
+
+    generateTables (frames);
+    return true;
+}
+
+inline bool Wavetable::generateAsync (std::vector<std::vector<float>> frames)
+{
+    if (! startGenerating (frames))
+        return false;
+
+    generationFuture = std::async (std::launch::async, [this, framesToGenerate = std::move (frames)]
+                                   { generateTables (framesToGenerate); });
+    return true;
+}
+
+inline void Wavetable::waitUntilReady()
+{
+    if (generationFuture.valid())
+        generationFuture.wait();
+}
+
+inline bool Wavetable::startGenerating (const std::vector<std::vector<float>>& frames)
+{
+    // the wavetable needs at least one frame, and every frame must be the same power-of-2 length!
+    const auto frameSize = frames.empty() ? 0 : frames.front().size();
+    const auto framesAreValid = frameSize >= 4
+                                && juce::isPowerOfTwo (frameSize)
+                                && std::all_of (frames.begin(), frames.end(), [frameSize] (const auto& frame)
+                                                { return frame.size() == frameSize; });
+    jassert (framesAreValid);
+    if (! framesAreValid)
+        return false;
+
+    // each wavetable can only be generated once!
+    return ! generationStarted.exchange (true);
+}
+
+inline void Wavetable::generateTables (const std::vector<std::vector<float>>& frames)
+{
+    tableSize = (int) frames.front().size();
+    numFrames = (int) frames.size();
+    numLevels = 1;
+    while ((tableSize / 2) >> numLevels > 0)
+        numLevels++;
+
+    const auto N = (size_t) tableSize;
+    const auto stride = (size_t) getTableStride();
+    tableData.resize ((size_t) numLevels * (size_t) numFrames * stride, 0.0f);
+
+    std::vector<std::complex<double>> twiddles (N / 2);
+    for (auto [k, twiddle] : enumerate (twiddles))
+        twiddle = std::polar (1.0, -juce::MathConstants<double>::twoPi * (double) k / (double) N);
+
+    std::vector<std::complex<double>> spectrum (N);
+    std::vector<std::complex<double>> levelData (N);
+    for (const auto [frameIndex, frame] : enumerate (frames))
+    {
+        std::copy (frame.begin(), frame.end(), spectrum.begin());
+        WavetableHelpers::fft (spectrum, twiddles, false);
+
+        for (int level = 0; level < numLevels; ++level)
+        {
+            // keep the DC component, and the positive and negative frequency bins for each harmonic below the limit
+            const auto numHarmonics = (size_t) getNumHarmonics (level);
+            std::fill (levelData.begin(), levelData.end(), std::complex<double> {});
+            levelData[0] = spectrum[0];
+            for (size_t harmonic = 1; harmonic <= numHarmonics; ++harmonic)
+            {
+                levelData[harmonic] = spectrum[harmonic];
+                levelData[N - harmonic] = spectrum[N - harmonic];
+            }
+
+            WavetableHelpers::fft (levelData, twiddles, true);
+
+            auto* table = tableData.data() + ((size_t) level * (size_t) numFrames + frameIndex) * stride;
+            for (size_t n = 0; n < N; ++n)
+                table[n] = (float) (levelData[n].real() / (double) N);
+            table[N] = table[0]; // guard sample
+        }
+    }
+
+    ready.store (true, std::memory_order_release);
+}
+} // namespace chowdsp
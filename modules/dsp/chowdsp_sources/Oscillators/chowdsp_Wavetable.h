@@ -0,0 +1,95 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A set of bandlimited, mip-mapped wavetables, for use with chowdsp::WavetableOscillator.
+ *
+ * The wavetable is generated from a set of single-cycle frames. For each frame, one table
+ * is generated per octave (a "mip level"): level 0 contains all the harmonics of the frame
+ * below Nyquist, and each subsequent level contains half as many harmonics as the previous
+ * level. The tables are bandlimited by taking the FFT of the frame, removing the harmonics
+ * above the level's limit, and taking the inverse FFT.
+ *
+ * The tables are stored in a single contiguous array, indexed by [level][frame][sample],
+ * with one extra "guard" sample at the end of each table, so that interpolation never
+ * needs to wrap around.
+ *
+ * A wavetable can only be generated once, either on the calling thread or on a background
+ * thread. Oscillators using the wavetable will be silent until the generation is finished.
+ * Since the tables don't change once they have been generated, a wavetable can be shared
+ * by any number of oscillators (see chowdsp::WavetableCache).
+ */
+class Wavetable
+{
+public:
+    Wavetable() = default;
+
+    /** The destructor will wait for any background generation to finish. */
+    ~Wavetable();
+
+    /**
+     * Generates the tables on the calling thread, from a set of single-cycle frames.
+     * Each frame must have the same length, which must be a power of 2.
+     *
+     * Returns false if the wavetable has already been generated (or is being generated).
+     */
+    bool generate (const std::vector<std::vector<float>>& frames);
+
+    /**
+     * Generates the tables on a background thread, from a set of single-cycle frames.
+     * Each frame must have the same length, which must be a power of 2.
+     *
+     * Returns false if the wavetable has already been generated (or is being generated).
+     */
+    bool generateAsync (std::vector<std::vector<float>> frames);
+
+    /** Returns true if the tables have been generated and are ready to use. */
+    [[nodiscard]] bool isReady() const noexcept { return ready.load (std::memory_order_acquire); }
+
+    /** Blocks the calling thread until any background generation is finished. */
+    void waitUntilReady();
+
+    /** Returns the length of each table. */
+    [[nodiscard]] int getTableSize() const noexcept { return tableSize; }
+
+    /** Returns the number of frames in the wavetable. */
+    [[nodiscard]] int getNumFrames() const noexcept { return numFrames; }
+
+    /** Returns the number of mip levels in the wavetable. */
+    [[nodiscard]] int getNumLevels() const noexcept { return numLevels; }
+
+    /** Returns the number of harmonics kept in the tables for a mip level. */
+    [[nodiscard]] int getNumHarmonics (int level) const noexcept { return level == 0 ? tableSize / 2 - 1 : (tableSize / 2) >> level; }
+
+    /** Returns the distance between the start of two consecutive tables in the table data. */
+    [[nodiscard]] int getTableStride() const noexcept { return tableSize + 1; }
+
+    /** Returns the table for a given mip level and frame. */
+    [[nodiscard]] const float* getTable (int level, int frame) const noexcept
+    {
+        jassert (isReady());
+        return tableData.data() + (size_t) (level * numFrames + frame) * (size_t) getTableStride();
+    }
+
+    /** Returns the data for all the tables. */
+    [[nodiscard]] const float* getTableData() const noexcept { return tableData.data(); }
+
+private:
+    bool startGenerating (const std::vector<std::vector<float>>& frames);
+    void generateTables (const std::vector<std::vector<float>>& frames);
+
+    std::vector<float> tableData;
+    int tableSize = 0;
+    int numFrames = 0;
+    int numLevels = 0;
+
+    std::atomic_bool generationStarted { false };
+    std::atomic_bool ready { false };
+    std::future<void> generationFuture;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Wavetable)
+};
+} // namespace chowdsp
+
+#include "chowdsp_Wavetable.cpp"
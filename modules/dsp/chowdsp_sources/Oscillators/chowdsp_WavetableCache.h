@@ -0,0 +1,50 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A cache that can be used for storing wavetables,
+ * which may be shared between many voices or oscillators.
+ *
+ * @code
+ * auto& wavetable = wavetableCache->addWavetable ("saw");
+ * wavetable.generateAsync (sawFrames); // does nothing if the wavetable has already been generated
+ * oscillator.setWavetable (&wavetable);
+ * @endcode
+ */
+class WavetableCache
+{
+public:
+    WavetableCache() = default;
+
+    /**
+     * Adds a wavetable to the cache, or returns the wavetable
+     * if a wavetable with the given ID is already present in the cache.
+     */
+    Wavetable& addWavetable (const std::string& wavetableID)
+    {
+        if (auto tableIter = wavetables.find (wavetableID); tableIter != wavetables.end())
+            return tableIter->second;
+        return wavetables[wavetableID];
+    }
+
+    /**
+     * Clears any wavetables currently stored in the cache.
+     * Make sure no oscillators are using the wavetables before calling this!
+     */
+    void clearCache()
+    {
+        wavetables.clear();
+    }
+
+private:
+    std::unordered_map<std::string, Wavetable> wavetables;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableCache)
+};
+
+#if CHOWDSP_USING_JUCE
+/** Helpful alias for creating a SharedResourcePointer<WavetableCache> */
+using SharedWavetableCache = juce::SharedResourcePointer<WavetableCache>;
+#endif
+} // namespace chowdsp
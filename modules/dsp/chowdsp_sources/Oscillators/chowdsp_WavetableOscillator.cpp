@@ -0,0 +1,124 @@
+namespace chowdsp
+{
+template <typename T>
+void WavetableOscillator<T>::setWavetable (const Wavetable* newWavetable) noexcept
+{
+    wavetable = newWavetable;
+    wavetableIsReady = false;
+    checkWavetableReady();
+}
+
+template <typename T>
+void WavetableOscillator<T>::setFrequency (T newFrequency) noexcept
+{
+    CHOWDSP_USING_XSIMD_STD (floor);
+
+    // The phase increment is wrapped into [0, 1), so that the phase stays in range for
+    // negative frequencies, or frequencies above the sample rate. Since the phase is only
+    // used modulo 1, this doesn't change the output.
+    freq = newFrequency;
+    deltaPhase = freq / fs;
+    deltaPhase -= floor (deltaPhase);
+
+    if (wavetableIsReady)
+        updateTableOffsets();
+}
+
+template <typename T>
+void WavetableOscillator<T>::setFramePosition (T newFramePosition) noexcept
+{
+    CHOWDSP_USING_XSIMD_STD (max);
+    CHOWDSP_USING_XSIMD_STD (min);
+    framePosition = min (max (newFramePosition, (T) 0), (T) 1);
+
+    if (wavetableIsReady)
+        updateTableOffsets();
+}
+
+template <typename T>
+void WavetableOscillator<T>::prepare (const juce::dsp::ProcessSpec& spec) noexcept
+{
+    fs = (NumericType) spec.sampleRate;
+    setFrequency (freq);
+    reset();
+}
+
+template <typename T>
+void WavetableOscillator<T>::reset (T newPhase) noexcept
+{
+    CHOWDSP_USING_XSIMD_STD (floor);
+
+    // make sure initial phase is in range
+    phase = newPhase - floor (newPhase);
+}
+
+template <typename T>
+void WavetableOscillator<T>::processBlock (const BufferView<T>& buffer) noexcept
+{
+    const auto numChannels = buffer.getNumChannels();
+    const auto numSamples = buffer.getNumSamples();
+
+    if (! wavetableIsReady && ! checkWavetableReady())
+    {
+        for (int i = 0; i < numSamples; ++i)
+            updatePhase();
+        return;
+    }
+
+    T phase_temp = phase;
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        phase = phase_temp;
+
+        auto* data = buffer.getWritePointer (ch);
+
+        for (int i = 0; i < numSamples; ++i)
+            data[i] += generateSample();
+    }
+}
+
+template <typename T>
+bool WavetableOscillator<T>::checkWavetableReady() noexcept
+{
+    if (wavetable == nullptr || ! wavetable->isReady())
+        return false;
+
+    wavetableIsReady = true;
+    tableData = wavetable->getTableData();
+    tableSize = (T) (NumericType) wavetable->getTableSize();
+    maxIndex = IndexType (wavetable->getTableSize() - 1);
+    updateTableOffsets();
+
+    return true;
+}
+
+template <typename T>
+void WavetableOscillator<T>::updateTableOffsets() noexcept
+{
+    CHOWDSP_USING_XSIMD_STD (abs);
+    CHOWDSP_USING_XSIMD_STD (ceil);
+    CHOWDSP_USING_XSIMD_STD (floor);
+    CHOWDSP_USING_XSIMD_STD (log2);
+    CHOWDSP_USING_XSIMD_STD (max);
+    CHOWDSP_USING_XSIMD_STD (min);
+    using WavetableHelpers::toIndex;
+
+    // Mip level k contains (tableSize / 2^(k+1)) harmonics, so the harmonics
+    // won't alias if k >= log2 (tableSize * |freq| / fs).
+    const auto maxLevel = (T) (NumericType) (wavetable->getNumLevels() - 1);
+    const auto level = min (max (ceil (log2 (abs (freq) * tableSize / fs)), (T) 0), maxLevel);
+
+    const auto maxFrame = (T) (NumericType) (wavetable->getNumFrames() - 1);
+    const auto frame = framePosition * maxFrame;
+    const auto frame0 = floor (frame);
+    const auto frame1 = min (frame0 + (T) 1, maxFrame);
+    frameFrac = frame - frame0;
+
+    const auto levelStride = IndexType (wavetable->getNumFrames() * wavetable->getTableStride());
+    const auto frameStride = IndexType (wavetable->getTableStride());
+    const auto levelOffset = toIndex (level) * levelStride;
+    offset0 = levelOffset + toIndex (frame0) * frameStride;
+    offset1 = levelOffset + toIndex (frame1) * frameStride;
+}
+} // namespace chowdsp
@@ -0,0 +1,150 @@
+#pragma once
+
+namespace chowdsp
+{
+#ifndef DOXYGEN
+namespace WavetableHelpers
+{
+    template <typename T>
+    struct IndexTypeHelper
+    {
+        using type = int32_t;
+    };
+
+#if ! CHOWDSP_NO_XSIMD
+    template <>
+    struct IndexTypeHelper<xsimd::batch<float>>
+    {
+        using type = xsimd::batch<int32_t>;
+    };
+#endif
+
+    inline int32_t toIndex (float x) noexcept { return (int32_t) x; }
+    inline float toFloat (int32_t index) noexcept { return (float) index; }
+    inline float lookup (const float* data, int32_t index) noexcept { return data[index]; }
+
+#if ! CHOWDSP_NO_XSIMD
+    inline xsimd::batch<int32_t> toIndex (const xsimd::batch<float>& x) noexcept { return xsimd::batch_cast<int32_t> (x); }
+    inline xsimd::batch<float> toFloat (const xsimd::batch<int32_t>& index) noexcept { return xsimd::batch_cast<float> (index); }
+    inline xsimd::batch<float> lookup (const float* data, const xsimd::batch<int32_t>& index) noexcept { return xsimd::batch<float>::gather (data, index); }
+#endif
+} // namespace WavetableHelpers
+#endif
+
+/**
+ * Bandlimited wavetable oscillator, which reads from a chowdsp::Wavetable.
+ *
+ * The oscillator selects the wavetable's mip level based on its frequency, so that none
+ * of the harmonics in the table can alias, and interpolates linearly between the samples
+ * in the table, as well as crossfading between neighbouring frames of the wavetable.
+ *
+ * When used with a SIMD type, each SIMD lane can have a different frequency and frame
+ * position (e.g. for processing a group of synth voices together), and the table reads
+ * are done with SIMD gather instructions.
+ *
+ * The oscillator will be silent until its wavetable has finished generating.
+ */
+template <typename T>
+class WavetableOscillator
+{
+    using NumericType = SampleTypeHelpers::NumericType<T>;
+    using IndexType = typename WavetableHelpers::IndexTypeHelper<T>::type;
+    static_assert (std::is_same_v<NumericType, float>, "WavetableOscillator only supports single-precision types!");
+
+public:
+    WavetableOscillator() = default;
+
+    /** Sets the wavetable for the oscillator to use. The wavetable must outlive the oscillator (or be replaced). */
+    void setWavetable (const Wavetable* newWavetable) noexcept;
+
+    /** Returns the wavetable that the oscillator is using. */
+    [[nodiscard]] const Wavetable* getWavetable() const noexcept { return wavetable; }
+
+    /** Sets the frequency of the oscillator. Negative frequencies play the wavetable backwards. */
+    void setFrequency (T newFrequency) noexcept;
+
+    /** Returns the current frequency of the oscillator. */
+    [[nodiscard]] T getFrequency() const noexcept { return freq; }
+
+    /** Sets the position in the wavetable's frames, in the range [0, 1]. */
+    void setFramePosition (T newFramePosition) noexcept;
+
+    /** Returns the current position in the wavetable's frames. */
+    [[nodiscard]] T getFramePosition() const noexcept { return framePosition; }
+
+    /** Prepares the oscillator to process at a given sample rate */
+    void prepare (const juce::dsp::ProcessSpec& spec) noexcept;
+
+    /** Resets the internal state of the oscillator, with a phase in range [0, 1) */
+    void reset (T newPhase = (T) 0) noexcept;
+
+    /** Returns the result of processing a single sample. */
+    inline T processSample() noexcept
+    {
+        if (! wavetableIsReady && ! checkWavetableReady())
+        {
+            updatePhase();
+            return {};
+        }
+
+        return generateSample();
+    }
+
+    /** Processes a block of samples, adding the oscillator output to the buffer. */
+    void processBlock (const BufferView<T>& buffer) noexcept;
+
+private:
+    inline T generateSample() noexcept
+    {
+        CHOWDSP_USING_XSIMD_STD (min);
+        using namespace WavetableHelpers;
+
+        const auto index = phase * tableSize;
+        const auto index0 = min (toIndex (index), maxIndex); // phase * tableSize can round up to tableSize
+        const auto frac = index - toFloat (index0);
+
+        const auto y00 = lookup (tableData, offset0 + index0);
+        const auto y01 = lookup (tableData, offset0 + index0 + 1);
+        const auto y10 = lookup (tableData, offset1 + index0);
+        const auto y11 = lookup (tableData, offset1 + index0 + 1);
+
+        const auto y0 = y00 + frac * (y01 - y00);
+        const auto y1 = y10 + frac * (y11 - y10);
+
+        updatePhase();
+
+        return y0 + frameFrac * (y1 - y0);
+    }
+
+    inline void updatePhase() noexcept
+    {
+        // the phase is in [0, 1), and setFrequency() wraps the phase increment, so at most one wrap is needed
+        phase += deltaPhase;
+        phase = SIMDUtils::select (phase >= (T) 1, phase - (T) 1, phase);
+    }
+
+    bool checkWavetableReady() noexcept;
+    void updateTableOffsets() noexcept;
+
+    const Wavetable* wavetable = nullptr;
+    bool wavetableIsReady = false;
+    const float* tableData = nullptr;
+    T tableSize {};
+    IndexType maxIndex {};
+
+    IndexType offset0 {};
+    IndexType offset1 {};
+    T frameFrac {};
+
+    T phase {};
+    T deltaPhase {};
+
+    T freq = static_cast<T> (0.0);
+    T framePosition = static_cast<T> (0.0);
+    NumericType fs = static_cast<NumericType> (44100.0);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WavetableOscillator)
+};
+} // namespace chowdsp
+
+#include "chowdsp_WavetableOscillator.cpp"
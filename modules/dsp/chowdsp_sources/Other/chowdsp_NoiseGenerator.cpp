@@ -0,0 +1,96 @@
+namespace chowdsp
+{
+template <typename FloatType>
+void NoiseGenerator<FloatType>::setSeed (uint64_t newSeed)
+{
+    noiseSeed = newSeed;
+    reset();
+}
+
+template <typename FloatType>
+void NoiseGenerator<FloatType>::prepare (int numChannels, int maxBlockSize)
+{
+    // space for the output noise, plus two random numbers per sample for pink noise
+    noiseData.resize (3 * (size_t) maxBlockSize, (FloatType) 0);
+    pinkStates.resize ((size_t) numChannels);
+
+    channelRands = std::make_unique<VectorRandom[]> ((size_t) numChannels);
+    numPreparedChannels = numChannels;
+
+    reset();
+}
+
+template <typename FloatType>
+void NoiseGenerator<FloatType>::reset()
+{
+    for (int ch = 0; ch < numPreparedChannels; ++ch)
+        channelRands[(size_t) ch].setSeed (getChannelSeed (ch));
+
+    std::fill (pinkStates.begin(), pinkStates.end(), PinkState {});
+    pinkCounter = 0;
+}
+
+template <typename FloatType>
+void NoiseGenerator<FloatType>::generatePink (FloatType* data, int channel, int numSamples) noexcept
+{
+    static constexpr auto pinkScale = (FloatType) 1 / (FloatType) (2 * (pinkNumRows + 1));
+
+    // two random numbers per sample: the first is used if a row is updated on that sample, and the second for the white noise
+    auto* randData = data + numSamples;
+    channelRands[(size_t) channel].fillUniformCentered (randData, 2 * numSamples);
+    for (int n = 0; n < numSamples; ++n)
+        data[n] = randData[2 * n + 1];
+
+    // Voss-McCartney: row k is updated once every 2^(k+1) samples (on the samples where
+    // the counter has k trailing zeros), and holds its value in between. So rather than
+    // updating a running sum for every sample, we add each row's held value to the output
+    // for each run of samples between the row's updates.
+    auto& rows = pinkStates[(size_t) channel];
+    for (size_t row = 0; row < pinkNumRows; ++row)
+    {
+        const auto period = 2 << row;
+        const auto updateOffset = 1 << row;
+
+        // the counter for sample n is (pinkCounter + n + 1)
+        auto nextUpdate = (int) ((uint32_t) (updateOffset - (int) pinkCounter - 1) & (uint32_t) (period - 1));
+        int runStart = 0;
+        while (true)
+        {
+            const auto runEnd = juce::jmin (nextUpdate, numSamples);
+            juce::FloatVectorOperations::add (data + runStart, rows[row], runEnd - runStart);
+            if (runEnd == numSamples)
+                break;
+
+            rows[row] = randData[2 * nextUpdate];
+            runStart = nextUpdate;
+            nextUpdate += period;
+        }
+    }
+
+    juce::FloatVectorOperations::multiply (data, pinkScale, numSamples);
+}
+
+template <typename FloatType>
+void NoiseGenerator<FloatType>::processBlock (const BufferView<FloatType>& buffer) noexcept
+{
+    const auto numChannels = buffer.getNumChannels();
+    const auto numSamples = buffer.getNumSamples();
+    jassert ((size_t) numSamples * 3 <= noiseData.size()); // block size is larger than what was prepared!
+    jassert (numChannels <= numPreparedChannels); // more channels than were prepared!
+
+    auto* noise = noiseData.data();
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        if (type == NoiseType::Uniform)
+            channelRands[(size_t) ch].fillUniformCentered (noise, numSamples);
+        else if (type == NoiseType::Normal)
+            channelRands[(size_t) ch].fillNormal (noise, numSamples);
+        else if (type == NoiseType::Pink)
+            generatePink (noise, ch, numSamples);
+
+        juce::FloatVectorOperations::addWithMultiply (buffer.getWritePointer (ch), noise, gain, numSamples);
+    }
+
+    pinkCounter = (pinkCounter + (uint32_t) numSamples) & pinkCounterMask;
+}
+} // namespace chowdsp
@@ -0,0 +1,83 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Block-based noise generator, which supports white noise with a uniform
+ * or normal distribution, or pink noise (-3dB / Oct).
+ *
+ * Unlike chowdsp::Noise, random numbers are generated a whole block at a
+ * time using chowdsp::VectorRandom. Each channel has its own random number
+ * generator (seeded from the generator seed and the channel index), so the
+ * output is deterministic for a given seed, regardless of the block sizes.
+ */
+template <typename FloatType>
+class NoiseGenerator
+{
+public:
+    static_assert (std::is_floating_point_v<FloatType>, "NoiseGenerator only supports scalar floating point types!");
+
+    enum class NoiseType
+    {
+        Uniform, /**< Uniform white noise [-1, 1] */
+        Normal, /**< White noise with a normal/Gaussian distribution, generated using the Box-Muller Transform */
+        Pink, /**< Pink noise (-3dB / Oct), generated using the Voss-McCartney algorithm */
+    };
+
+    /** Creates a noise generator with the given seed. */
+    explicit NoiseGenerator (uint64_t seed = VectorRandom::defaultSeed) : noiseSeed (seed) {}
+
+    /** Selects a new noise profile */
+    void setNoiseType (NoiseType newType) noexcept { type = newType; }
+
+    /** Returns the current noise profile */
+    [[nodiscard]] NoiseType getNoiseType() const noexcept { return type; }
+
+    /** Sets the linear gain to apply to the generated noise. */
+    void setGainLinear (FloatType newGain) noexcept { gain = newGain; }
+
+    /** Returns the linear gain applied to the generated noise. */
+    [[nodiscard]] FloatType getGainLinear() const noexcept { return gain; }
+
+    /** Sets the seed for the random number generators, and resets the generator state. */
+    void setSeed (uint64_t newSeed);
+
+    /** Returns the seed for the random number generators. */
+    [[nodiscard]] uint64_t getSeed() const noexcept { return noiseSeed; }
+
+    /** Prepares the noise generator to process a given number of channels and samples per block. */
+    void prepare (int numChannels, int maxBlockSize);
+
+    /** Re-seeds the random number generators, so that the noise sequence starts over. */
+    void reset();
+
+    /** Adds noise to a block of samples. */
+    void processBlock (const BufferView<FloatType>& buffer) noexcept;
+
+private:
+    void generatePink (FloatType* data, int channel, int numSamples) noexcept;
+
+    /** Returns the seed for a channel's random number generator. */
+    [[nodiscard]] uint64_t getChannelSeed (int channel) const noexcept { return noiseSeed ^ ((uint64_t) channel * 0x9e3779b97f4a7c15); }
+
+    NoiseType type = NoiseType::Uniform;
+    FloatType gain = (FloatType) 1;
+
+    uint64_t noiseSeed;
+    std::unique_ptr<VectorRandom[]> channelRands;
+    int numPreparedChannels = 0;
+    std::vector<FloatType> noiseData;
+
+    /** Number of Voss-McCartney rows used for pink noise. */
+    static constexpr size_t pinkNumRows = 8;
+    static constexpr uint32_t pinkCounterMask = (1u << pinkNumRows) - 1;
+
+    using PinkState = std::array<FloatType, pinkNumRows>; // the current value of each row
+    std::vector<PinkState> pinkStates;
+    uint32_t pinkCounter = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NoiseGenerator)
+};
+} // namespace chowdsp
+
+#include "chowdsp_NoiseGenerator.cpp"
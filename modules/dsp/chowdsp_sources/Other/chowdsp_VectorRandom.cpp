@@ -0,0 +1,215 @@
+namespace chowdsp
+{
+#ifndef DOXYGEN
+namespace VectorRandomHelpers
+{
+#if ! CHOWDSP_NO_XSIMD
+    using UIntVec = xsimd::batch<uint32_t>;
+    using FloatVec = xsimd::batch<float>;
+    constexpr size_t vecSize = UIntVec::size;
+
+    inline UIntVec load (const uint32_t* p) { return xsimd::load_aligned (p); }
+    inline void store (uint32_t* p, const UIntVec& x) { xsimd::store_aligned (p, x); }
+#else
+    using UIntVec = uint32_t;
+    constexpr size_t vecSize = 1;
+
+    inline UIntVec load (const uint32_t* p) { return *p; }
+    inline void store (uint32_t* p, const UIntVec& x) { *p = x; }
+#endif
+
+    template <int k>
+    inline UIntVec rotl (const UIntVec& x) noexcept
+    {
+        return (x << k) | (x >> (32 - k));
+    }
+
+    inline uint64_t splitMix64 (uint64_t& x) noexcept
+    {
+        auto z = (x += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    /** Converts raw random bits to a float in [1, 2), using the upper 23 bits as the mantissa. */
+    inline float toFloat12 (uint32_t x) noexcept
+    {
+        const auto bits = (x >> 9) | 0x3f800000u;
+        float y;
+        std::memcpy (&y, &bits, sizeof (float));
+        return y;
+    }
+
+    template <typename FloatType, size_t N>
+    void convertUniform01 (const uint32_t* raw, FloatType* out) noexcept
+    {
+        if constexpr (std::is_same_v<FloatType, float>)
+        {
+#if ! CHOWDSP_NO_XSIMD
+            for (size_t i = 0; i < N; i += vecSize)
+            {
+                const auto bits = (load (raw + i) >> 9) | UIntVec (0x3f800000u);
+                xsimd::store_unaligned (out + i, xsimd::bitwise_cast<FloatVec> (bits) - 1.0f);
+            }
+#else
+            for (size_t i = 0; i < N; ++i)
+                out[i] = toFloat12 (raw[i]) - 1.0f;
+#endif
+        }
+        else
+        {
+            for (size_t i = 0; i < N; ++i)
+                out[i] = (FloatType) raw[i] * (FloatType) 2.3283064365386963e-10; // 2^-32
+        }
+    }
+
+    template <typename FloatType, size_t N>
+    void convertUniformCentered (const uint32_t* raw, FloatType* out) noexcept
+    {
+        convertUniform01<FloatType, N> (raw, out);
+        for (size_t i = 0; i < N; ++i)
+            out[i] = (FloatType) 2 * out[i] - (FloatType) 1;
+    }
+
+    /**
+     * Box-Muller transform: the first half of the group is used for the radii,
+     * and the second half for the angles, so that each group of uniform numbers
+     * produces a full group of normal numbers.
+     */
+    template <typename FloatType, size_t N>
+    void convertNormal (const uint32_t* raw, FloatType* out) noexcept
+    {
+        static constexpr auto halfN = N / 2;
+        static constexpr auto twoPi = (FloatType) 6.283185307179586476925286766559;
+        static constexpr auto oneOverSqrt2 = (FloatType) 0.70710678118654752440084436210485;
+
+        FloatType uniform[N];
+        convertUniform01<FloatType, N> (raw, uniform);
+
+#if ! CHOWDSP_NO_XSIMD
+        // Use a fixed-width batch, so that results are the same regardless of the SIMD architecture.
+        using QuadVec = xsimd::make_sized_batch_t<FloatType, 4>;
+        if constexpr (! std::is_void_v<QuadVec>)
+        {
+            for (size_t i = 0; i < halfN; i += QuadVec::size)
+            {
+                const auto u1 = QuadVec::load_unaligned (uniform + i);
+                const auto u2 = QuadVec::load_unaligned (uniform + halfN + i);
+
+                const auto radius = xsimd::sqrt ((FloatType) -2 * xsimd::log ((FloatType) 1 - u1)) * oneOverSqrt2;
+                const auto [sinTheta, cosTheta] = xsimd::sincos (twoPi * u2);
+                xsimd::store_unaligned (out + i, radius * sinTheta);
+                xsimd::store_unaligned (out + halfN + i, radius * cosTheta);
+            }
+            return;
+        }
+#endif
+
+        for (size_t i = 0; i < halfN; ++i)
+        {
+            const auto radius = std::sqrt ((FloatType) -2 * std::log ((FloatType) 1 - uniform[i])) * oneOverSqrt2;
+            const auto theta = twoPi * uniform[halfN + i];
+            out[i] = radius * std::sin (theta);
+            out[halfN + i] = radius * std::cos (theta);
+        }
+    }
+} // namespace VectorRandomHelpers
+#endif // DOXYGEN
+
+inline void VectorRandom::setSeed (uint64_t newSeed) noexcept
+{
+    seed = newSeed;
+
+    auto splitMixState = seed;
+    for (size_t stream = 0; stream < numStreams; ++stream)
+    {
+        for (size_t word = 0; word < 4; word += 2)
+        {
+            const auto x = VectorRandomHelpers::splitMix64 (splitMixState);
+            state[word][stream] = (uint32_t) x;
+            state[word + 1][stream] = (uint32_t) (x >> 32);
+        }
+    }
+
+    rawCacheIndex = numStreams;
+}
+
+inline void VectorRandom::nextRaw (uint32_t* output) noexcept
+{
+    using namespace VectorRandomHelpers;
+    for (size_t i = 0; i < numStreams; i += vecSize)
+    {
+        auto s0 = load (state[0] + i);
+        auto s1 = load (state[1] + i);
+        auto s2 = load (state[2] + i);
+        auto s3 = load (state[3] + i);
+
+        store (output + i, s0 + s3);
+
+        const auto t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3 = rotl<11> (s3);
+
+        store (state[0] + i, s0);
+        store (state[1] + i, s1);
+        store (state[2] + i, s2);
+        store (state[3] + i, s3);
+    }
+}
+
+template <typename FloatType, typename ConvertFunc>
+void VectorRandom::fillInternal (FloatType* data, int numSamples, ConvertFunc&& convert) noexcept
+{
+    FloatType converted[numStreams];
+    int sampleIndex = 0;
+
+    // use up any leftover values from last time
+    if (rawCacheIndex < numStreams)
+    {
+        convert (rawCache, converted);
+        const auto numToCopy = juce::jmin (numSamples, int (numStreams - rawCacheIndex));
+        std::copy (converted + rawCacheIndex, converted + rawCacheIndex + numToCopy, data);
+        rawCacheIndex += (size_t) numToCopy;
+        sampleIndex += numToCopy;
+    }
+
+    alignas (SIMDUtils::defaultSIMDAlignment) uint32_t raw[numStreams];
+    for (; sampleIndex + (int) numStreams <= numSamples; sampleIndex += (int) numStreams)
+    {
+        nextRaw (raw);
+        convert (raw, data + sampleIndex);
+    }
+
+    // save any leftover values for next time
+    if (sampleIndex < numSamples)
+    {
+        nextRaw (rawCache);
+        convert (rawCache, converted);
+        rawCacheIndex = size_t (numSamples - sampleIndex);
+        std::copy (converted, converted + rawCacheIndex, data + sampleIndex);
+    }
+}
+
+template <typename FloatType>
+void VectorRandom::fillUniform01 (FloatType* data, int numSamples) noexcept
+{
+    fillInternal (data, numSamples, &VectorRandomHelpers::convertUniform01<FloatType, numStreams>);
+}
+
+template <typename FloatType>
+void VectorRandom::fillUniformCentered (FloatType* data, int numSamples) noexcept
+{
+    fillInternal (data, numSamples, &VectorRandomHelpers::convertUniformCentered<FloatType, numStreams>);
+}
+
+template <typename FloatType>
+void VectorRandom::fillNormal (FloatType* data, int numSamples) noexcept
+{
+    fillInternal (data, numSamples, &VectorRandomHelpers::convertNormal<FloatType, numStreams>);
+}
+} // namespace chowdsp
@@ -0,0 +1,72 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A fast pseudo-random number generator, which generates blocks
+ * of random numbers using several interleaved xoshiro128+ streams,
+ * running in parallel SIMD lanes.
+ *
+ * The output sequence depends only on the seed (and not on the
+ * block sizes used to request random numbers, or the SIMD
+ * architecture being compiled for), so renders that use this
+ * generator are reproducible. Note that normally distributed
+ * numbers may differ in the last few bits between architectures,
+ * depending on the available SIMD math functions.
+ *
+ * Reference: https://prng.di.unimi.it/xoshiro128plus.c
+ */
+class VectorRandom
+{
+public:
+    /** The number of interleaved random number streams. */
+    static constexpr size_t numStreams = 16;
+
+    /** Creates a random number generator with the given seed. */
+    explicit VectorRandom (uint64_t initialSeed = defaultSeed) { setSeed (initialSeed); }
+
+    /** Re-seeds the random number generator, and resets its state. */
+    void setSeed (uint64_t newSeed) noexcept;
+
+    /** Returns the current seed. */
+    [[nodiscard]] uint64_t getSeed() const noexcept { return seed; }
+
+    /** Fills a buffer with uniformly distributed random numbers in the range [0, 1) */
+    template <typename FloatType>
+    void fillUniform01 (FloatType* data, int numSamples) noexcept;
+
+    /** Fills a buffer with uniformly distributed random numbers in the range [-1, 1) */
+    template <typename FloatType>
+    void fillUniformCentered (FloatType* data, int numSamples) noexcept;
+
+    /**
+     * Fills a buffer with normally distributed random numbers, with
+     * mean 0 and variance 0.5, generated using the Box-Muller transform.
+     */
+    template <typename FloatType>
+    void fillNormal (FloatType* data, int numSamples) noexcept;
+
+    static constexpr uint64_t defaultSeed = 0x9e3779b97f4a7c15;
+
+private:
+    /** Fills a buffer with raw random numbers, converting each group of numStreams numbers with the given function. */
+    template <typename FloatType, typename ConvertFunc>
+    void fillInternal (FloatType* data, int numSamples, ConvertFunc&& convert) noexcept;
+
+    /** Generates the next numStreams raw random numbers. */
+    void nextRaw (uint32_t* output) noexcept;
+
+    uint64_t seed = defaultSeed;
+
+    // xoshiro128+ state, stored as [state word][stream]
+    alignas (SIMDUtils::defaultSIMDAlignment) uint32_t state[4][numStreams] {};
+
+    // leftover values from the last group that was only partially consumed
+    alignas (SIMDUtils::defaultSIMDAlignment) uint32_t rawCache[numStreams] {};
+    size_t rawCacheIndex = numStreams;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VectorRandom)
+};
+} // namespace chowdsp
+
+#include "chowdsp_VectorRandom.cpp"
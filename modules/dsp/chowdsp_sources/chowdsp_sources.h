@@ -20,6 +20,10 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #pragma once
 
+// STL includes
+#include <complex>
+#include <future>
+
 #include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
 
 #include "Oscillators/chowdsp_SawtoothWave.h"
@@ -29,6 +33,13 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #include "Oscillators/chowdsp_PolygonalOscillator.h"
 
+#include "Oscillators/chowdsp_Wavetable.h"
+#include "Oscillators/chowdsp_WavetableCache.h"
+#include "Oscillators/chowdsp_WavetableOscillator.h"
+
+#include "Other/chowdsp_VectorRandom.h"
+#include "Other/chowdsp_NoiseGenerator.h"
+
 #if CHOWDSP_USING_JUCE
 #if JUCE_MODULE_AVAILABLE_juce_dsp
 #include "Other/chowdsp_Noise.h"
@@ -2,6 +2,43 @@
 
 namespace chowdsp::EQ
 {
+#ifndef DOXYGEN
+namespace plot_detail
+{
+    /**
+     * Evaluates a magnitude function (in Decibels) for a set of frequencies
+     * normalized by freq0, and adds the results to the destination array.
+     * The function is called with SIMD batches where possible.
+     */
+    template <typename FunctionType>
+    void accumulateMagnitudesDecibels (const float* frequencies, float* magnitudesDB, int numPoints, float freq0, FunctionType&& getMagnitudeDB)
+    {
+        int n = 0;
+
+#if ! CHOWDSP_NO_XSIMD
+        using Vec = xsimd::batch<float>;
+        static constexpr auto vecSize = (int) Vec::size;
+        for (; n + vecSize <= numPoints; n += vecSize)
+        {
+            const auto w = xsimd::load_unaligned (frequencies + n) / freq0;
+            xsimd::store_unaligned (magnitudesDB + n, xsimd::load_unaligned (magnitudesDB + n) + getMagnitudeDB (w));
+        }
+#endif
+
+        for (; n < numPoints; ++n)
+            magnitudesDB[n] += getMagnitudeDB (frequencies[n] / freq0);
+    }
+
+    /** Converts a squared magnitude to Decibels, with a -200 dB floor. */
+    template <typename T>
+    T squaredMagnitudeToDecibels (const T& magSquared)
+    {
+        using std::log10;
+        return 10.0f * log10 (magSquared + 1.0e-20f);
+    }
+} // namespace plot_detail
+#endif // DOXYGEN
+
 /** Base class for plotting EQ filters. */
 struct EQFilterPlot
 {
@@ -12,6 +49,23 @@ struct EQFilterPlot
     virtual void setQValue ([[maybe_unused]] float qVal) {}
     virtual void setGainDecibels ([[maybe_unused]] float gainDB) {}
     [[nodiscard]] virtual float getMagnitudeForFrequency ([[maybe_unused]] float freqHz) const { return 1.0f; }
+
+    /**
+     * Computes the filter's magnitude response (in Decibels) for a set of
+     * frequencies, and adds it to the magnitudesDB array. Since the responses
+     * are added in the Decibel domain, the combined response of several filters
+     * can be computed by accumulating each filter's response into the same array.
+     *
+     * The default implementation calls getMagnitudeForFrequency() for each point,
+     * so custom plots only need to override getMagnitudeForFrequency(). The built-in
+     * plots compute their responses directly with SIMD, so both methods are `final`
+     * for those plots. To plot a custom response, derive from EQFilterPlot instead.
+     */
+    virtual void accumulateMagnitudesDecibels (const float* frequencies, float* magnitudesDB, int numPoints) const
+    {
+        for (int n = 0; n < numPoints; ++n)
+            magnitudesDB[n] += juce::Decibels::gainToDecibels (getMagnitudeForFrequency (frequencies[n]), -200.0f);
+    }
 };
 
 /** Plotting helper for first-order filters. */
@@ -26,13 +80,29 @@ struct FirstOrderFilterPlot : public EQFilterPlot
         freq0 = cutoffFreqHz;
     }
 
-    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const override
+    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const final
     {
         const auto s = std::complex<float> { 0, freqHz / freq0 };
         const auto numerator = s * b_coeffs[1] + b_coeffs[0];
         const auto denominator = s * a_coeffs[1] + a_coeffs[0];
         return std::abs (numerator / denominator);
     }
+
+    void accumulateMagnitudesDecibels (const float* frequencies, float* magnitudesDB, int numPoints) const final
+    {
+        plot_detail::accumulateMagnitudesDecibels (frequencies,
+                                                   magnitudesDB,
+                                                   numPoints,
+                                                   freq0,
+                                                   [this] (const auto& w)
+                                                   {
+                                                       const auto numImag = w * b_coeffs[1];
+                                                       const auto denImag = w * a_coeffs[1];
+                                                       const auto numMagSq = numImag * numImag + b_coeffs[0] * b_coeffs[0];
+                                                       const auto denMagSq = denImag * denImag + a_coeffs[0] * a_coeffs[0];
+                                                       return plot_detail::squaredMagnitudeToDecibels (numMagSq / denMagSq);
+                                                   });
+    }
 };
 
 /** Plotting helper for second-order filters. */
@@ -47,7 +117,7 @@ struct SecondOrderFilterPlot : public EQFilterPlot
         freq0 = cutoffFreqHz;
     }
 
-    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const override
+    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const final
     {
         const auto s = std::complex<float> { 0, freqHz / freq0 };
         const auto sSq = s * s;
@@ -55,6 +125,26 @@ struct SecondOrderFilterPlot : public EQFilterPlot
         const auto denominator = sSq * a_coeffs[2] + s * a_coeffs[1] + a_coeffs[0];
         return std::abs (numerator / denominator);
     }
+
+    void accumulateMagnitudesDecibels (const float* frequencies, float* magnitudesDB, int numPoints) const final
+    {
+        plot_detail::accumulateMagnitudesDecibels (frequencies,
+                                                   magnitudesDB,
+                                                   numPoints,
+                                                   freq0,
+                                                   [this] (const auto& w)
+                                                   {
+                                                       // H(jw) = (b0 - b2 w^2 + j b1 w) / (a0 - a2 w^2 + j a1 w)
+                                                       const auto wSq = w * w;
+                                                       const auto numReal = b_coeffs[0] - wSq * b_coeffs[2];
+                                                       const auto numImag = w * b_coeffs[1];
+                                                       const auto denReal = a_coeffs[0] - wSq * a_coeffs[2];
+                                                       const auto denImag = w * a_coeffs[1];
+                                                       const auto numMagSq = numReal * numReal + numImag * numImag;
+                                                       const auto denMagSq = denReal * denReal + denImag * denImag;
+                                                       return plot_detail::squaredMagnitudeToDecibels (numMagSq / denMagSq);
+                                                   });
+    }
 };
 
 /** Plotting helper for first-order LPF. */
@@ -259,7 +349,7 @@ struct HigherOrderLPFPlot : EQFilterPlot
         plots[0].a_coeffs[1] = 1.0f / ((qVal / CoefficientCalculators::butterworthQ<float>) *butterQVals[0]);
     }
 
-    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const override
+    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const final
     {
         float result = 1.0f;
         for (auto& plot : plots)
@@ -271,6 +361,15 @@ struct HigherOrderLPFPlot : EQFilterPlot
         return result;
     }
 
+    void accumulateMagnitudesDecibels (const float* frequencies, float* magnitudesDB, int numPoints) const final
+    {
+        for (auto& plot : plots)
+            plot.accumulateMagnitudesDecibels (frequencies, magnitudesDB, numPoints);
+
+        if constexpr (order % 2 == 1)
+            extraPlot.accumulateMagnitudesDecibels (frequencies, magnitudesDB, numPoints);
+    }
+
 private:
     LPF1Plot extraPlot;
     std::array<SecondOrderFilterPlot, size_t (order / 2)> plots;
@@ -304,7 +403,7 @@ struct HigherOrderHPFPlot : EQFilterPlot
         plots[0].a_coeffs[1] = 1.0f / ((qVal / CoefficientCalculators::butterworthQ<float>) *butterQVals[0]);
     }
 
-    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const override
+    [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const final
     {
         float result = 1.0f;
         for (auto& plot : plots)
@@ -316,6 +415,15 @@ struct HigherOrderHPFPlot : EQFilterPlot
         return result;
     }
 
+    void accumulateMagnitudesDecibels (const float* frequencies, float* magnitudesDB, int numPoints) const final
+    {
+        for (auto& plot : plots)
+            plot.accumulateMagnitudesDecibels (frequencies, magnitudesDB, numPoints);
+
+        if constexpr (order % 2 == 1)
+            extraPlot.accumulateMagnitudesDecibels (frequencies, magnitudesDB, numPoints);
+    }
+
 private:
     HPF1Plot extraPlot;
     std::array<SecondOrderFilterPlot, size_t (order / 2)> plots;
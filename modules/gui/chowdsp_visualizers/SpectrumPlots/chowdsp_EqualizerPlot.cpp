@@ -139,75 +139,86 @@ void EqualizerPlot::setGainDBParameter (int bandIndex, float gainDB)
 
 void EqualizerPlot::updateFilterPlotPath (int bandIndex)
 {
-    const auto width = getWidth();
-    if (width == 0 || getHeight() == 0)
+    if (getWidth() == 0 || getHeight() == 0)
         return;
 
-    const auto& plot = *filterPlots[(size_t) bandIndex].plot;
-    auto& plotData = filterPlots[(size_t) bandIndex].plotData;
-    plotData.resize ((size_t) width);
-
-    auto& path = filterPlots[(size_t) bandIndex].plotPath;
-    path.clear();
-    path.preallocateSpace (width * 3);
-
-    const auto getPointForXCoord = [this, &plot, &plotData] (int x) -> juce::Point<float>
+    if (updateFrequencyGrid())
     {
-        const auto frequency = getFrequencyForXCoordinate ((float) x);
-        plotData[(size_t) x] = plot.getMagnitudeForFrequency (frequency);
-        const auto magDB = juce::Decibels::gainToDecibels (plotData[(size_t) x]);
-        return { (float) x, getYCoordinateForDecibels (magDB) };
-    };
-
-    path.startNewSubPath (getPointForXCoord (0));
-    for (int x = 1; x < width; ++x)
-        path.lineTo (getPointForXCoord (x));
+        // the plot size has changed, so all the bands need to be re-computed
+        resized();
+        repaint();
+        return;
+    }
 
+    updateFilterPlotData (bandIndex);
     updateMasterFilterPlotPath();
 
     repaint();
 }
 
-void EqualizerPlot::updateMasterFilterPlotPath()
+bool EqualizerPlot::updateFrequencyGrid()
 {
     const auto width = getWidth();
-    if (width == 0 || getHeight() == 0)
-        return;
+    if (frequencyGrid.size() == (size_t) width)
+        return false;
 
-    masterFilterPlotPath.clear();
-    masterFilterPlotPath.preallocateSpace (width * 3);
+    frequencyGrid.resize ((size_t) width);
+    for (auto [x, frequency] : enumerate (frequencyGrid))
+        frequency = getFrequencyForXCoordinate ((float) x);
+
+    return true;
+}
+
+void EqualizerPlot::updateFilterPlotData (int bandIndex)
+{
+    auto& [plot, path, plotData] = filterPlots[(size_t) bandIndex];
+    plotData.assign (frequencyGrid.size(), 0.0f);
+    plot->accumulateMagnitudesDecibels (frequencyGrid.data(), plotData.data(), (int) plotData.size());
 
-    std::vector<std::vector<float>*> activePlots;
+    updatePathFromMagnitudes (path, plotData);
+}
+
+void EqualizerPlot::updateMasterFilterPlotPath()
+{
+    // the magnitude responses are in Decibels, so the combined response is just the sum of the active bands
+    masterPlotData.assign (frequencyGrid.size(), 0.0f);
     for (auto [index, filterPlot] : enumerate (filterPlots))
     {
-        if (filtersActiveFlags[index])
-            activePlots.push_back (&filterPlot.plotData);
+        if (filtersActiveFlags[index] && filterPlot.plotData.size() == masterPlotData.size())
+            juce::FloatVectorOperations::add (masterPlotData.data(), filterPlot.plotData.data(), (int) masterPlotData.size());
     }
 
-    const auto getPointForXCoord = [this, &activePlots = std::as_const (activePlots)] (int x) -> juce::Point<float>
-    {
-        float magLinear = 1.0f;
-        for (auto* plotData : activePlots)
-        {
-            if (plotData->size() <= (size_t) x)
-                break;
+    updatePathFromMagnitudes (masterFilterPlotPath, masterPlotData);
+}
+
+void EqualizerPlot::updatePathFromMagnitudes (juce::Path& path, const std::vector<float>& magnitudesDB) const
+{
+    path.clear();
+    if (magnitudesDB.empty())
+        return;
 
-            magLinear *= plotData->operator[] ((size_t) x);
-        }
+    path.preallocateSpace ((int) magnitudesDB.size() * 3);
 
-        const auto magDB = juce::Decibels::gainToDecibels (magLinear);
+    const auto getPointForXCoord = [this, &magnitudesDB] (size_t x) -> juce::Point<float>
+    {
+        const auto magDB = juce::jmax (magnitudesDB[x], -100.0f);
         return { (float) x, getYCoordinateForDecibels (magDB) };
     };
 
-    masterFilterPlotPath.startNewSubPath (getPointForXCoord (0));
-    for (int x = 1; x < width; ++x)
-        masterFilterPlotPath.lineTo (getPointForXCoord (x));
+    path.startNewSubPath (getPointForXCoord (0));
+    for (size_t x = 1; x < magnitudesDB.size(); ++x)
+        path.lineTo (getPointForXCoord (x));
 }
 
 void EqualizerPlot::resized()
 {
+    if (getWidth() == 0 || getHeight() == 0)
+        return;
+
+    updateFrequencyGrid();
     for (int i = 0; i < (int) filterPlots.size(); ++i)
-        updateFilterPlotPath (i);
+        updateFilterPlotData (i);
+    updateMasterFilterPlotPath();
 }
 
 const juce::Path& EqualizerPlot::getPath (int bandIndex) const
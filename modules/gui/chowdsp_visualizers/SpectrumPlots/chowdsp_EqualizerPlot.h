@@ -74,18 +74,24 @@ public:
     void resized() override;
 
 private:
+    bool updateFrequencyGrid();
+    void updateFilterPlotData (int bandIndex);
     void updateMasterFilterPlotPath();
+    void updatePathFromMagnitudes (juce::Path& path, const std::vector<float>& magnitudesDB) const;
 
     struct BandPlotInfo
     {
         std::unique_ptr<EQFilterPlot> plot;
         juce::Path plotPath;
-        std::vector<float> plotData {};
+        std::vector<float> plotData {}; // magnitude response in Decibels
     };
 
     std::vector<BandPlotInfo> filterPlots;
     juce::Path masterFilterPlotPath;
 
+    std::vector<float> frequencyGrid; // the frequency for each x-coordinate
+    std::vector<float> masterPlotData; // magnitude response in Decibels
+
     std::vector<bool> filtersActiveFlags;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EqualizerPlot)
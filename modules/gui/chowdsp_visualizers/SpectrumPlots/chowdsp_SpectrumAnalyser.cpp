@@ -0,0 +1,258 @@
+#include "chowdsp_SpectrumAnalyser.h"
+
+namespace chowdsp
+{
+SpectrumAnalyserTask::SpectrumAnalyserTask (const SpectrumAnalyserParams& analyserParams)
+    : ScheduledAudioUIBackgroundTask ("Spectrum Analyser"),
+      params (analyserParams),
+      fftSize (1 << analyserParams.fftOrder),
+      fft (analyserParams.fftOrder),
+      window ((size_t) fftSize),
+      fftData (2 * (size_t) fftSize)
+{
+    jassert (params.overlapFactor > 0 && params.overlapFactor <= fftSize);
+
+    // normalize the window so that a full-scale sine wave will have a magnitude of 0 dB
+    juce::dsp::WindowingFunction<float>::fillWindowingTables (window.data(), (size_t) fftSize, juce::dsp::WindowingFunction<float>::hann, false);
+    const auto windowSum = std::accumulate (window.begin(), window.end(), 0.0f);
+    juce::FloatVectorOperations::multiply (window.data(), 2.0f / windowSum, fftSize);
+}
+
+void SpectrumAnalyserTask::setFrequencyGrid (std::vector<float>&& frequencies)
+{
+    std::lock_guard lock { dataMutex };
+    requestedFrequencyGrid = std::move (frequencies);
+    frequencyGridChanged = true;
+}
+
+bool SpectrumAnalyserTask::getLatestSpectrum (std::vector<float>& spectrumDB, std::vector<float>& peakHoldDB)
+{
+    if (! hasNewSpectrum.load())
+        return false;
+
+    std::unique_lock lock { dataMutex, std::try_to_lock };
+    if (! lock.owns_lock())
+        return false;
+
+    spectrumDB = publishedSpectrumDB;
+    peakHoldDB = publishedPeakHoldDB;
+    hasNewSpectrum = false;
+    return true;
+}
+
+void SpectrumAnalyserTask::prepareTask (double sampleRate, int, int& requestedBlockSize, int& waitMs)
+{
+    fs = sampleRate;
+    binRangesNeedUpdate = true;
+    needsReset = true;
+
+    requestedBlockSize = fftSize;
+
+    // run one analysis frame per hop
+    const auto hopSizeSeconds = (double) (fftSize / params.overlapFactor) / sampleRate;
+    waitMs = juce::jmax (1, (int) (1000.0 * hopSizeSeconds));
+}
+
+void SpectrumAnalyserTask::resetTask()
+{
+    // this could be called from the audio thread, so the background thread will do the actual reset
+    needsReset = true;
+}
+
+void SpectrumAnalyserTask::runTask (const juce::AudioBuffer<float>& data)
+{
+    {
+        std::lock_guard lock { dataMutex };
+        if (std::exchange (frequencyGridChanged, false))
+        {
+            frequencyGrid = requestedFrequencyGrid;
+            binRangesNeedUpdate = true;
+        }
+    }
+
+    if (std::exchange (binRangesNeedUpdate, false))
+    {
+        updateBinRanges();
+        needsReset = true;
+    }
+
+    if (needsReset.exchange (false))
+    {
+        std::fill (smoothedSpectrumDB.begin(), smoothedSpectrumDB.end(), params.minMagnitudeDB);
+        std::fill (peakHoldSpectrumDB.begin(), peakHoldSpectrumDB.end(), params.minMagnitudeDB);
+        lastFrameTimeMs = 0.0;
+    }
+
+    const auto numChannels = data.getNumChannels();
+    if (numChannels == 0 || frequencyGrid.empty())
+        return;
+
+    // mix down to mono, and apply the window
+    std::fill (fftData.begin(), fftData.end(), 0.0f);
+    juce::FloatVectorOperations::copy (fftData.data(), data.getReadPointer (0), fftSize);
+    for (int ch = 1; ch < numChannels; ++ch)
+        juce::FloatVectorOperations::add (fftData.data(), data.getReadPointer (ch), fftSize);
+    if (numChannels > 1)
+        juce::FloatVectorOperations::multiply (fftData.data(), 1.0f / (float) numChannels, fftSize);
+    juce::FloatVectorOperations::multiply (fftData.data(), window.data(), fftSize);
+
+    fft.performFrequencyOnlyForwardTransform (fftData.data(), true);
+    aggregateBins();
+
+    const auto frameTimeMs = juce::Time::getMillisecondCounterHiRes();
+    const auto hopSizeMs = 1000.0 * (double) (fftSize / params.overlapFactor) / fs;
+    const auto timeSinceLastFrameMs = lastFrameTimeMs > 0.0 ? frameTimeMs - lastFrameTimeMs : hopSizeMs;
+    lastFrameTimeMs = frameTimeMs;
+    updateSmoothedSpectrum (0.001f * (float) timeSinceLastFrameMs);
+
+    std::lock_guard lock { dataMutex };
+    publishedSpectrumDB = smoothedSpectrumDB;
+    publishedPeakHoldDB = peakHoldSpectrumDB;
+    hasNewSpectrum = true;
+}
+
+void SpectrumAnalyserTask::updateBinRanges()
+{
+    const auto numPoints = frequencyGrid.size();
+    binRanges.resize (numPoints);
+    pointMagnitudes.resize (numPoints);
+    smoothedSpectrumDB.resize (numPoints);
+    peakHoldSpectrumDB.resize (numPoints);
+
+    const auto maxBin = fftSize / 2;
+    const auto binWidthHz = (float) fs / (float) fftSize;
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        // each point covers the frequencies halfway (logarithmically) to its neighbours
+        const auto freq = frequencyGrid[i];
+        const auto lowFreq = i > 0 ? std::sqrt (freq * frequencyGrid[i - 1]) : freq;
+        const auto highFreq = i < numPoints - 1 ? std::sqrt (freq * frequencyGrid[i + 1]) : freq;
+
+        const auto firstBin = juce::jlimit (0, maxBin, (int) std::ceil (lowFreq / binWidthHz));
+        const auto lastBin = juce::jlimit (0, maxBin, (int) std::floor (highFreq / binWidthHz));
+
+        auto& binRange = binRanges[i];
+        if (lastBin >= firstBin)
+        {
+            binRange = { firstBin, lastBin - firstBin + 1, 0.0f };
+            continue;
+        }
+
+        // at low frequencies there may be fewer bins than points, so we interpolate between the nearest bins
+        const auto binPosition = juce::jlimit (0.0f, (float) maxBin, freq / binWidthHz);
+        const auto interpBin = juce::jmin ((int) binPosition, maxBin - 1);
+        binRange = { interpBin, 0, binPosition - (float) interpBin };
+    }
+}
+
+void SpectrumAnalyserTask::aggregateBins()
+{
+    for (auto [i, binRange] : enumerate (binRanges))
+    {
+        if (binRange.numBins > 0)
+        {
+            pointMagnitudes[i] = juce::FloatVectorOperations::findMaximum (fftData.data() + binRange.firstBin, binRange.numBins);
+            continue;
+        }
+
+        const auto mag0 = fftData[(size_t) binRange.firstBin];
+        const auto mag1 = fftData[(size_t) binRange.firstBin + 1];
+        pointMagnitudes[i] = mag0 + binRange.interpolation * (mag1 - mag0);
+    }
+}
+
+void SpectrumAnalyserTask::updateSmoothedSpectrum (float timeSinceLastFrameSeconds)
+{
+    // the spectrum rises instantly, and falls exponentially (in Decibels)
+    const auto releaseCoef = std::exp (-timeSinceLastFrameSeconds / (0.001f * juce::jmax (params.releaseTimeMs, 1.0f)));
+    const auto peakDecayDB = params.peakDecayDBPerSecond * timeSinceLastFrameSeconds;
+    const auto minMagnitudeDB = params.minMagnitudeDB;
+
+    const auto numPoints = (int) pointMagnitudes.size();
+    auto* smoothedData = smoothedSpectrumDB.data();
+    auto* peakHoldData = peakHoldSpectrumDB.data();
+    int n = 0;
+
+#if ! CHOWDSP_NO_XSIMD
+    using Vec = xsimd::batch<float>;
+    static constexpr auto vecSize = (int) Vec::size;
+    for (; n + vecSize <= numPoints; n += vecSize)
+    {
+        const auto magDB = SIMDUtils::gainToDecibels (xsimd::load_unaligned (pointMagnitudes.data() + n), minMagnitudeDB);
+        const auto prevSmoothedDB = xsimd::load_unaligned (smoothedData + n);
+        const auto smoothedDB = xsimd::select (magDB > prevSmoothedDB, magDB, magDB + releaseCoef * (prevSmoothedDB - magDB));
+        const auto peakHoldDB = xsimd::max (smoothedDB, xsimd::load_unaligned (peakHoldData + n) - peakDecayDB);
+
+        xsimd::store_unaligned (smoothedData + n, smoothedDB);
+        xsimd::store_unaligned (peakHoldData + n, peakHoldDB);
+    }
+#endif
+
+    for (; n < numPoints; ++n)
+    {
+        const auto magDB = juce::Decibels::gainToDecibels (pointMagnitudes[(size_t) n], minMagnitudeDB);
+        const auto prevSmoothedDB = smoothedData[n];
+        smoothedData[n] = magDB > prevSmoothedDB ? magDB : magDB + releaseCoef * (prevSmoothedDB - magDB);
+        peakHoldData[n] = juce::jmax (smoothedData[n], peakHoldData[n] - peakDecayDB);
+    }
+}
+
+//=================================================================
+SpectrumAnalyser::SpectrumAnalyser (SpectrumAnalyserTask& analyserTask, SpectrumPlotParams&& plotParams, int refreshRateHz)
+    : SpectrumPlotBase (std::move (plotParams)),
+      task (analyserTask)
+{
+    task.setShouldBeRunning (true);
+    startTimerHz (refreshRateHz);
+}
+
+SpectrumAnalyser::~SpectrumAnalyser()
+{
+    stopTimer();
+    task.setShouldBeRunning (false);
+}
+
+void SpectrumAnalyser::resized()
+{
+    // one point per pixel
+    const auto numPoints = (size_t) getWidth() + 1;
+    xCoords.resize (numPoints);
+    std::vector<float> frequencyGrid (numPoints);
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        xCoords[i] = (float) i;
+        frequencyGrid[i] = getFrequencyForXCoordinate ((float) i);
+    }
+
+    task.setFrequencyGrid (std::move (frequencyGrid));
+
+    spectrumPath.clear();
+    peakHoldPath.clear();
+}
+
+void SpectrumAnalyser::timerCallback()
+{
+    if (! task.getLatestSpectrum (spectrumDB, peakHoldDB))
+        return;
+
+    // the spectrum may have been computed for an old frequency grid
+    if (spectrumDB.size() != xCoords.size() || peakHoldDB.size() != xCoords.size())
+        return;
+
+    updatePath (spectrumPath, spectrumDB);
+    updatePath (peakHoldPath, peakHoldDB);
+    repaint();
+}
+
+void SpectrumAnalyser::updatePath (juce::Path& path, const std::vector<float>& magnitudesDB) const
+{
+    path.clear();
+    if (magnitudesDB.empty())
+        return;
+
+    path.preallocateSpace ((int) magnitudesDB.size() * 3);
+    path.startNewSubPath (xCoords[0], getYCoordinateForDecibels (magnitudesDB[0]));
+    for (size_t i = 1; i < magnitudesDB.size(); ++i)
+        path.lineTo (xCoords[i], getYCoordinateForDecibels (magnitudesDB[i]));
+}
+} // namespace chowdsp
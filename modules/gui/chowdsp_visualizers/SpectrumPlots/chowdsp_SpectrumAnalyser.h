@@ -0,0 +1,128 @@
+#pragma once
+
+namespace chowdsp
+{
+/** Parameters for a real-time spectrum analyser. */
+struct SpectrumAnalyserParams
+{
+    int fftOrder = 12; // the FFT size will be 2^fftOrder
+    int overlapFactor = 4; // the analysis hop size will be fftSize / overlapFactor
+    float minMagnitudeDB = -120.0f; // the lowest magnitude reported by the analyser
+    float releaseTimeMs = 150.0f; // how long the spectrum takes to fall back down after a peak
+    float peakDecayDBPerSecond = 12.0f; // how quickly the peak-hold spectrum falls back down
+};
+
+/**
+ * Background task for computing a real-time magnitude spectrum.
+ *
+ * Audio should be pushed into the task from the audio thread, and then the
+ * spectrum is computed on a background thread, using windowed FFTs, with
+ * one analysis frame per hop. The FFT bins are aggregated onto a (usually
+ * log-spaced) frequency grid, and then smoothed over time, along with a
+ * peak-hold spectrum.
+ *
+ * Usually this task is displayed using a `SpectrumAnalyser` component.
+ */
+class SpectrumAnalyserTask : public ScheduledAudioUIBackgroundTask
+{
+public:
+    explicit SpectrumAnalyserTask (const SpectrumAnalyserParams& params = {});
+
+    /** Sets the frequencies (in Hertz) for which the spectrum should be computed. */
+    void setFrequencyGrid (std::vector<float>&& frequencies);
+
+    /**
+     * Copies the latest spectrum and peak-hold spectrum (in Decibels) into the given vectors.
+     *
+     * This method will never block. If no new spectrum has been computed since the last
+     * call, or if the background thread is currently publishing a new spectrum, this
+     * method will return false, and the vectors will not be changed.
+     */
+    bool getLatestSpectrum (std::vector<float>& spectrumDB, std::vector<float>& peakHoldDB);
+
+    /** Returns the FFT size used by the analyser. */
+    [[nodiscard]] int getFFTSize() const noexcept { return fftSize; }
+
+private:
+    void prepareTask (double sampleRate, int samplesPerBlock, int& requestedBlockSize, int& waitMs) override;
+    void resetTask() override;
+    void runTask (const juce::AudioBuffer<float>& data) override;
+
+    void updateBinRanges();
+    void aggregateBins();
+    void updateSmoothedSpectrum (float timeSinceLastFrameSeconds);
+
+    const SpectrumAnalyserParams params;
+    const int fftSize;
+    juce::dsp::FFT fft;
+    std::vector<float> window;
+    std::vector<float> fftData;
+    double fs = 48000.0;
+
+    // for each point in the frequency grid, either take the maximum of a range of bins, or interpolate between two bins
+    struct BinRange
+    {
+        int firstBin = 0;
+        int numBins = 0;
+        float interpolation = 0.0f;
+    };
+
+    std::vector<float> frequencyGrid;
+    std::vector<BinRange> binRanges;
+    bool binRangesNeedUpdate = true;
+
+    std::vector<float> pointMagnitudes;
+    std::vector<float> smoothedSpectrumDB;
+    std::vector<float> peakHoldSpectrumDB;
+    double lastFrameTimeMs = 0.0;
+    std::atomic_bool needsReset { false };
+
+    // data shared with the UI thread
+    std::mutex dataMutex;
+    std::vector<float> requestedFrequencyGrid;
+    bool frequencyGridChanged = false;
+    std::vector<float> publishedSpectrumDB;
+    std::vector<float> publishedPeakHoldDB;
+    std::atomic_bool hasNewSpectrum { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyserTask)
+};
+
+/**
+ * UI component for plotting the output of a SpectrumAnalyserTask.
+ *
+ * The spectrum is computed for one point per pixel of the component's
+ * width, and the spectrum paths are updated at the display refresh rate.
+ * Child classes should override `paint()` to draw the paths.
+ */
+class SpectrumAnalyser : public SpectrumPlotBase,
+                         private juce::Timer
+{
+public:
+    explicit SpectrumAnalyser (SpectrumAnalyserTask& analyserTask, SpectrumPlotParams&& params = {}, int refreshRateHz = 60);
+    ~SpectrumAnalyser() override;
+
+    /** Returns the path for the most recent spectrum. */
+    [[nodiscard]] const juce::Path& getSpectrumPath() const noexcept { return spectrumPath; }
+
+    /** Returns the path for the peak-hold spectrum. */
+    [[nodiscard]] const juce::Path& getPeakHoldPath() const noexcept { return peakHoldPath; }
+
+    void resized() override;
+
+private:
+    void timerCallback() override;
+    void updatePath (juce::Path& path, const std::vector<float>& magnitudesDB) const;
+
+    SpectrumAnalyserTask& task;
+
+    std::vector<float> xCoords;
+    std::vector<float> spectrumDB;
+    std::vector<float> peakHoldDB;
+
+    juce::Path spectrumPath;
+    juce::Path peakHoldPath;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyser)
+};
+} // namespace chowdsp
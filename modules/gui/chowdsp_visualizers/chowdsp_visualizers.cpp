@@ -2,3 +2,7 @@
 
 #include "SpectrumPlots/chowdsp_SpectrumPlotBase.cpp"
 #include "SpectrumPlots/chowdsp_EqualizerPlot.cpp"
+
+#if JUCE_MODULE_AVAILABLE_juce_dsp && JUCE_MODULE_AVAILABLE_chowdsp_plugin_utils
+#include "SpectrumPlots/chowdsp_SpectrumAnalyser.cpp"
+#endif
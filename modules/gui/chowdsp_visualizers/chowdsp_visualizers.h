@@ -21,6 +21,7 @@ BEGIN_JUCE_MODULE_DECLARATION
 #pragma once
 
 #include <complex>
+#include <numeric>
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_audio_basics/juce_audio_basics.h>
@@ -34,6 +35,20 @@ BEGIN_JUCE_MODULE_DECLARATION
 #include <chowdsp_plugin_state/chowdsp_plugin_state.h>
 #endif
 
+#if JUCE_MODULE_AVAILABLE_juce_dsp
+JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wimplicit-const-int-float-conversion")
+#include <juce_dsp/juce_dsp.h>
+JUCE_END_IGNORE_WARNINGS_GCC_LIKE
+#endif
+
+#if JUCE_MODULE_AVAILABLE_chowdsp_plugin_utils
+#include <chowdsp_plugin_utils/chowdsp_plugin_utils.h>
+#endif
+
 #include "SpectrumPlots/chowdsp_SpectrumPlotBase.h"
 #include "SpectrumPlots/chowdsp_EQFilterPlots.h"
 #include "SpectrumPlots/chowdsp_EqualizerPlot.h"
+
+#if JUCE_MODULE_AVAILABLE_juce_dsp && JUCE_MODULE_AVAILABLE_chowdsp_plugin_utils
+#include "SpectrumPlots/chowdsp_SpectrumAnalyser.h"
+#endif
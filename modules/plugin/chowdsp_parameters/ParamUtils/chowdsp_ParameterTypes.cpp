@@ -45,6 +45,11 @@ void FloatParameter::applyMonophonicModulation (double modulationValue)
 
 float FloatParameter::getCurrentValue() const noexcept
 {
-    return normalisableRange.convertFrom0to1 (juce::jlimit (0.0f, 1.0f, normalisableRange.convertTo0to1 (get()) + modulationAmount));
+    return getValueWithModulation (normalisableRange.convertTo0to1 (get()), modulationAmount);
+}
+
+float FloatParameter::getValueWithModulation (float normalisedValue, float modulation) const noexcept
+{
+    return normalisableRange.convertFrom0to1 (juce::jlimit (0.0f, 1.0f, normalisedValue + modulation));
 }
 } // namespace chowdsp
@@ -65,9 +65,27 @@ public:
     /** Applies monphonic modulation to this parameter. */
     void applyMonophonicModulation (double value) override;
 
+    /** Returns true if polyphonic (per-note) modulation has been enabled for this parameter. */
+    bool supportsPolyphonicModulation() override { return polyphonicModulationEnabled; }
+
+    /**
+     * Enables polyphonic (per-note) modulation for this parameter. This should be set
+     * when the parameter is created, since the host will only check it once.
+     *
+     * The per-note modulation amounts are not stored in the parameter itself,
+     * since they belong to the synth voices (see chowdsp::PolyphonicModulationStore).
+     */
+    void setPolyphonicModulationEnabled (bool shouldBeEnabled) noexcept { polyphonicModulationEnabled = shouldBeEnabled; }
+
+    /** Returns the (normalised) monophonic modulation amount that is currently applied. */
+    float getModulationAmount() const noexcept { return modulationAmount; }
+
     /** Returns the current parameter value accounting for any modulation that is currently applied. */
     float getCurrentValue() const noexcept;
 
+    /** Returns the parameter value for a given normalised value and modulation amount. */
+    float getValueWithModulation (float normalisedValue, float modulation) const noexcept;
+
     /** Returns the current parameter value accounting for any modulation that is currently applied. */
     operator float() const noexcept { return getCurrentValue(); } // NOSONAR, NOLINT(google-explicit-constructor): we want to be able to do implicit conversion here
 
@@ -76,6 +94,7 @@ private:
     const juce::NormalisableRange<float> normalisableRange;
 
     float modulationAmount = 0.0f;
+    bool polyphonicModulationEnabled = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (FloatParameter)
 };
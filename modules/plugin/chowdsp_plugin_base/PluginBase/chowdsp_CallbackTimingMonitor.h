@@ -0,0 +1,190 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Measures the time taken by each audio callback, relative to the real-time
+ * budget for that callback (i.e. the duration of the audio being processed).
+ *
+ * The measurements are accumulated into a lock-free histogram of callback
+ * utilisation, so that tail percentiles (p99, p99.9) can be reported along
+ * with the worst-case callback time and the number of overruns (callbacks that
+ * took longer than their budget).
+ *
+ * `measureCallback()` should only be called from the audio thread, while
+ * `getStats()` and `logStats()` may be called from any thread.
+ */
+class CallbackTimingMonitor
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /** The histogram covers utilisation from 0% to (numHistogramBins / histogramBinsPerUnit) * 100%. */
+    static constexpr size_t numHistogramBins = 512;
+    static constexpr double histogramBinsPerUnit = 200.0; // 0.5% resolution
+
+    CallbackTimingMonitor() = default;
+
+    /** Timing statistics for the callbacks measured so far. */
+    struct Stats
+    {
+        uint64_t numCallbacks = 0;
+        uint64_t numOverruns = 0;
+
+        // utilisation is the callback time, as a proportion of the callback's real-time budget
+        double meanUtilisation = 0.0;
+        double p50Utilisation = 0.0;
+        double p90Utilisation = 0.0;
+        double p99Utilisation = 0.0;
+        double p999Utilisation = 0.0;
+        double maxUtilisation = 0.0;
+
+        double maxCallbackTimeMicroseconds = 0.0;
+
+        /** Returns a human-readable summary of the statistics. */
+        [[nodiscard]] juce::String toString() const
+        {
+            const auto percentString = [] (double utilisation)
+            { return juce::String (100.0 * utilisation, 1) + "%"; };
+
+            return juce::String (numCallbacks) + " callbacks, "
+                   + juce::String (numOverruns) + " overruns, "
+                   + "utilisation mean " + percentString (meanUtilisation)
+                   + " / p50 " + percentString (p50Utilisation)
+                   + " / p90 " + percentString (p90Utilisation)
+                   + " / p99 " + percentString (p99Utilisation)
+                   + " / p99.9 " + percentString (p999Utilisation)
+                   + " / max " + percentString (maxUtilisation)
+                   + ", worst callback " + juce::String (maxCallbackTimeMicroseconds, 1) + " us";
+        }
+    };
+
+    /** Enables or disables the measurements. */
+    void setEnabled (bool shouldBeEnabled) noexcept { enabled.store (shouldBeEnabled, std::memory_order_relaxed); }
+
+    /** Returns true if the measurements are enabled. */
+    [[nodiscard]] bool isEnabled() const noexcept { return enabled.load (std::memory_order_relaxed); }
+
+    /**
+     * Measures the duration of the callback, and adds it to the statistics.
+     * The callback's real-time budget is numSamples / sampleRate.
+     */
+    template <typename Callback>
+    void measureCallback (int numSamples, double sampleRate, Callback&& callback)
+    {
+        if (! isEnabled() || numSamples <= 0 || sampleRate <= 0.0)
+        {
+            callback();
+            return;
+        }
+
+        const auto startTime = Clock::now();
+        callback();
+        const auto callbackTime = std::chrono::duration<double> (Clock::now() - startTime).count();
+
+        addMeasurement (callbackTime, (double) numSamples / sampleRate);
+    }
+
+    /** Adds a measurement of a callback that took callbackTimeSeconds, with a real-time budget of budgetSeconds. */
+    void addMeasurement (double callbackTimeSeconds, double budgetSeconds) noexcept
+    {
+        const auto utilisation = callbackTimeSeconds / budgetSeconds;
+        const auto binIndex = std::min ((size_t) (utilisation * histogramBinsPerUnit), numHistogramBins - 1);
+        histogram[binIndex].fetch_add (1, std::memory_order_relaxed);
+
+        numCallbacks.fetch_add (1, std::memory_order_relaxed);
+        if (utilisation > 1.0)
+            numOverruns.fetch_add (1, std::memory_order_relaxed);
+
+        // only the audio thread writes these values, so we don't need a compare-exchange loop
+        totalUtilisation.store (totalUtilisation.load (std::memory_order_relaxed) + utilisation, std::memory_order_relaxed);
+        if (utilisation > maxUtilisation.load (std::memory_order_relaxed))
+            maxUtilisation.store (utilisation, std::memory_order_relaxed);
+        if (callbackTimeSeconds > maxCallbackTimeSeconds.load (std::memory_order_relaxed))
+            maxCallbackTimeSeconds.store (callbackTimeSeconds, std::memory_order_relaxed);
+    }
+
+    /**
+     * Returns the statistics for the callbacks measured so far.
+     *
+     * Percentiles are rounded up to the edge of the histogram bin that contains
+     * them, and are clamped to the maximum measured utilisation.
+     */
+    [[nodiscard]] Stats getStats() const noexcept
+    {
+        std::array<uint64_t, numHistogramBins> histogramCounts {};
+        uint64_t histogramTotal = 0;
+        for (size_t i = 0; i < numHistogramBins; ++i)
+        {
+            histogramCounts[i] = histogram[i].load (std::memory_order_relaxed);
+            histogramTotal += histogramCounts[i];
+        }
+
+        Stats stats;
+        stats.numCallbacks = numCallbacks.load (std::memory_order_relaxed);
+        stats.numOverruns = numOverruns.load (std::memory_order_relaxed);
+        stats.maxUtilisation = maxUtilisation.load (std::memory_order_relaxed);
+        stats.maxCallbackTimeMicroseconds = 1.0e6 * maxCallbackTimeSeconds.load (std::memory_order_relaxed);
+        if (stats.numCallbacks == 0 || histogramTotal == 0)
+            return stats;
+
+        stats.meanUtilisation = totalUtilisation.load (std::memory_order_relaxed) / (double) stats.numCallbacks;
+
+        const auto getPercentile = [&] (double percentile)
+        {
+            const auto targetCount = (uint64_t) std::ceil (percentile * (double) histogramTotal);
+            uint64_t count = 0;
+            for (size_t i = 0; i < numHistogramBins; ++i)
+            {
+                count += histogramCounts[i];
+                if (count >= targetCount)
+                    return std::min ((double) (i + 1) / histogramBinsPerUnit, stats.maxUtilisation);
+            }
+            return stats.maxUtilisation;
+        };
+
+        stats.p50Utilisation = getPercentile (0.5);
+        stats.p90Utilisation = getPercentile (0.9);
+        stats.p99Utilisation = getPercentile (0.99);
+        stats.p999Utilisation = getPercentile (0.999);
+
+        return stats;
+    }
+
+    /** Writes the current statistics to the current juce::Logger (e.g. a chowdsp::PluginLogger). */
+    void logStats() const
+    {
+        juce::Logger::writeToLog ("Audio callback timing: " + getStats().toString());
+    }
+
+    /**
+     * Clears the statistics.
+     *
+     * If the audio thread is running, a measurement that is in progress
+     * may be partially included in the cleared statistics.
+     */
+    void reset() noexcept
+    {
+        for (auto& bin : histogram)
+            bin.store (0, std::memory_order_relaxed);
+
+        numCallbacks.store (0, std::memory_order_relaxed);
+        numOverruns.store (0, std::memory_order_relaxed);
+        totalUtilisation.store (0.0, std::memory_order_relaxed);
+        maxUtilisation.store (0.0, std::memory_order_relaxed);
+        maxCallbackTimeSeconds.store (0.0, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic_bool enabled { false };
+
+    std::array<std::atomic<uint64_t>, numHistogramBins> histogram {};
+    std::atomic<uint64_t> numCallbacks { 0 };
+    std::atomic<uint64_t> numOverruns { 0 };
+    std::atomic<double> totalUtilisation { 0.0 };
+    std::atomic<double> maxUtilisation { 0.0 };
+    std::atomic<double> maxCallbackTimeSeconds { 0.0 };
+
+    JUCE_DECLARE_NON_COPYABLE (CallbackTimingMonitor)
+};
+} // namespace chowdsp
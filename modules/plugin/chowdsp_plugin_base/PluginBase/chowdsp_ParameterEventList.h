@@ -0,0 +1,172 @@
+#pragma once
+
+namespace chowdsp
+{
+/** A single sample-accurate parameter change or modulation event. */
+struct ParameterEvent
+{
+    enum class Type
+    {
+        Value, /**< A new normalised parameter value */
+        Modulation, /**< A new (normalised) modulation amount */
+    };
+
+    int sampleOffset = 0; /**< Offset of the event from the start of the current block */
+    int parameterIndex = 0; /**< Index of the parameter in the processor's parameter list */
+    Type type = Type::Value;
+    float value = 0.0f;
+
+    int32_t noteID = -1; /**< For polyphonic modulation, otherwise -1 */
+    int16_t portIndex = -1;
+    int16_t channel = -1;
+    int16_t key = -1;
+
+    /** Returns true if this is a polyphonic modulation event, which targets specific notes. */
+    [[nodiscard]] bool isPolyphonic() const noexcept { return type == Type::Modulation && (noteID >= 0 || key >= 0); }
+};
+
+/**
+ * A fixed-capacity list of parameter events for the current block,
+ * which is kept sorted by sample offset as events are added.
+ *
+ * Memory is only allocated by the constructor and `setCapacity()`,
+ * so the rest of the class is safe to use on the audio thread.
+ */
+class ParameterEventList
+{
+public:
+    static constexpr int defaultCapacity = 512;
+
+    /** Creates an event list with the given capacity. */
+    explicit ParameterEventList (int capacity = defaultCapacity) { setCapacity (capacity); }
+
+    /** Changes the maximum number of events that the list can hold. This will allocate memory and clear the list! */
+    void setCapacity (int newCapacity)
+    {
+        events.resize ((size_t) newCapacity);
+        numEvents = 0;
+    }
+
+    /** Returns the maximum number of events that the list can hold. */
+    [[nodiscard]] int getCapacity() const noexcept { return (int) events.size(); }
+
+    /** Removes all events from the list. */
+    void clear() noexcept { numEvents = 0; }
+
+    /** Returns the number of events in the list. */
+    [[nodiscard]] int size() const noexcept { return numEvents; }
+
+    /** Returns true if the list contains no events. */
+    [[nodiscard]] bool isEmpty() const noexcept { return numEvents == 0; }
+
+    /**
+     * Adds an event to the list, after any existing events with the same sample offset.
+     * Returns false if the list is full, in which case the event is not added.
+     */
+    bool addEvent (const ParameterEvent& newEvent) noexcept
+    {
+        if (numEvents >= getCapacity())
+            return false;
+
+        // events usually arrive in order, so searching back from the end is cheapest
+        auto insertIndex = numEvents;
+        while (insertIndex > 0 && events[(size_t) insertIndex - 1].sampleOffset > newEvent.sampleOffset)
+        {
+            events[(size_t) insertIndex] = events[(size_t) insertIndex - 1];
+            --insertIndex;
+        }
+
+        events[(size_t) insertIndex] = newEvent;
+        ++numEvents;
+        return true;
+    }
+
+    const ParameterEvent& operator[] (int index) const noexcept { return events[(size_t) index]; }
+    [[nodiscard]] const ParameterEvent* begin() const noexcept { return events.data(); }
+    [[nodiscard]] const ParameterEvent* end() const noexcept { return events.data() + numEvents; }
+
+    /** Returns true if the list contains any events for the given parameter. */
+    [[nodiscard]] bool hasEventsForParameter (int parameterIndex) const noexcept
+    {
+        return std::any_of (begin(), end(), [parameterIndex] (const ParameterEvent& event)
+                            { return event.parameterIndex == parameterIndex; });
+    }
+
+    /**
+     * Splits a block of numSamples samples into sub-blocks at the event boundaries.
+     *
+     * For each sub-block, `handleEvent (const ParameterEvent&)` is called for every
+     * event that occurs at the start of the sub-block, followed by
+     * `processSubBlock (int startSample, int numSubBlockSamples)`.
+     *
+     * Events that are less than minSubBlockSize samples after the start of the
+     * current sub-block are moved to the start of that sub-block, which can be
+     * used to avoid processing lots of very small sub-blocks.
+     */
+    template <typename EventFunc, typename SubBlockFunc>
+    void processSubBlocks (int numSamples, EventFunc&& handleEvent, SubBlockFunc&& processSubBlock, int minSubBlockSize = 1) const
+    {
+        minSubBlockSize = juce::jmax (1, minSubBlockSize);
+
+        int startSample = 0;
+        auto eventIter = begin();
+        while (startSample < numSamples)
+        {
+            while (eventIter != end() && eventIter->sampleOffset < startSample + minSubBlockSize)
+                handleEvent (*eventIter++);
+
+            const auto endSample = eventIter != end() ? juce::jmin (eventIter->sampleOffset, numSamples) : numSamples;
+            processSubBlock (startSample, endSample - startSample);
+            startSample = endSample;
+        }
+
+        // events past the end of the block still need to be applied
+        while (eventIter != end())
+            handleEvent (*eventIter++);
+    }
+
+    /**
+     * Renders a per-sample buffer for a parameter, from the value and modulation
+     * events for that parameter. The parameter's normalised value and modulation
+     * amount at the start of the block should be passed in, and `toOutputValue (float normalisedValue, float modulation)`
+     * is used to convert them to the values written to the buffer.
+     *
+     * Returns false (without writing to the buffer), if there are no events
+     * for the parameter in this block, in which case the parameter can be
+     * treated as constant for the block.
+     */
+    template <typename ConvertFunc>
+    bool renderParameterBuffer (int parameterIndex, float* data, int numSamples, float startValue, float startModulation, ConvertFunc&& toOutputValue) const noexcept
+    {
+        if (! hasEventsForParameter (parameterIndex))
+            return false;
+
+        auto value = startValue;
+        auto modulation = startModulation;
+        int startSample = 0;
+        for (const auto& event : *this)
+        {
+            if (event.parameterIndex != parameterIndex || event.isPolyphonic())
+                continue;
+
+            const auto eventSample = juce::jlimit (0, numSamples, event.sampleOffset);
+            std::fill (data + startSample, data + eventSample, toOutputValue (value, modulation));
+            startSample = eventSample;
+
+            if (event.type == ParameterEvent::Type::Value)
+                value = event.value;
+            else
+                modulation = event.value;
+        }
+
+        std::fill (data + startSample, data + numSamples, toOutputValue (value, modulation));
+        return true;
+    }
+
+private:
+    std::vector<ParameterEvent> events;
+    int numEvents = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterEventList)
+};
+} // namespace chowdsp
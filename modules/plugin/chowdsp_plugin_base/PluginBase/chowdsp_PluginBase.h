@@ -2,6 +2,8 @@
 
 #include <chowdsp_parameters/chowdsp_parameters.h>
 #include "chowdsp_ProgramAdapter.h"
+#include "chowdsp_ParameterEventList.h"
+#include "chowdsp_CallbackTimingMonitor.h"
 
 #if JUCE_MODULE_AVAILABLE_chowdsp_presets
 #include <chowdsp_presets/chowdsp_presets.h>
@@ -117,6 +119,67 @@ public:
     virtual juce::String getWrapperTypeString() const;
     bool supportsParameterModulation() const;
 
+    /** Determines how sample-accurate parameter events are passed on to the processor. */
+    enum class ParameterEventMode
+    {
+        Disabled, /**< Parameter events are applied at the start of each block */
+        SubBlocks, /**< The block is split at the parameter events, and processAudioBlock() is called for each sub-block */
+        PerSampleBuffers, /**< processAudioBlock() is called for the whole block, and can use renderParameterBuffer() for the parameters that changed */
+    };
+
+    /**
+     * Sets how sample-accurate parameter events should be handled.
+     *
+     * In SubBlocks mode, events that are closer than minSubBlockSize samples together
+     * will be applied at the same time. This should be set before the processor is
+     * being used to process audio.
+     */
+    void setParameterEventMode (ParameterEventMode newMode, int minSubBlockSize = 1);
+
+    /** Returns the current parameter event mode. */
+    ParameterEventMode getParameterEventMode() const noexcept { return parameterEventMode; }
+
+    /**
+     * Adds a sample-accurate parameter event to be processed with the next block.
+     * CLAP parameter value and modulation events are added automatically.
+     *
+     * This should only be called from the audio thread. If the event list is full,
+     * or parameter events are disabled, the event will be applied immediately.
+     */
+    void addParameterEvent (const ParameterEvent& event);
+
+    /**
+     * Returns the parameter events for the current block, with sample offsets relative to the start of the block.
+     * In PerSampleBuffers mode, the events will be applied to the parameters after processAudioBlock() returns.
+     */
+    const ParameterEventList& getParameterEvents() const noexcept { return parameterEvents; }
+
+    /**
+     * Renders a per-sample buffer for a parameter, from the parameter events for the current block.
+     * Returns false (without writing to the buffer) if the parameter has no events in the current block,
+     * in which case `param.getCurrentValue()` can be used for the whole block.
+     */
+    bool renderParameterBuffer (const FloatParameter& param, float* data, int numSamples) const noexcept;
+
+    /**
+     * Enables or disables timing of the audio callbacks. When enabled, each call
+     * to processBlock() is measured against its real-time budget (the number of
+     * samples in the block, divided by the sample rate), and the timing statistics
+     * can be retrieved with `getCallbackTimingMonitor().getStats()`.
+     */
+    void setCallbackTimingEnabled (bool shouldBeEnabled) noexcept { callbackTimingMonitor.setEnabled (shouldBeEnabled); }
+
+    /** Returns the monitor used to measure the audio callback timing. */
+    CallbackTimingMonitor& getCallbackTimingMonitor() noexcept { return callbackTimingMonitor; }
+
+    /** Returns the monitor used to measure the audio callback timing. */
+    const CallbackTimingMonitor& getCallbackTimingMonitor() const noexcept { return callbackTimingMonitor; }
+
+#if JUCE_MODULE_AVAILABLE_chowdsp_clap_extensions
+    bool supportsDirectEvent (uint16_t space_id, uint16_t type) override;
+    void handleDirectEvent (const clap_event_header_t* event, int sampleOffset) override;
+#endif
+
 protected:
 #if JUCE_MODULE_AVAILABLE_chowdsp_plugin_state
     PluginStateType state;
@@ -129,6 +192,13 @@ protected:
 #endif
 #endif
 
+    /**
+     * Applies the parameter events for the current block to the parameters, and clears
+     * the event list. This is called after processAudioBlock() (unless the events have
+     * already been applied in SubBlocks mode), or after SynthBase::processSynth().
+     */
+    void applyParameterEvents();
+
 #if JUCE_MODULE_AVAILABLE_chowdsp_presets_v2
     std::unique_ptr<PresetManager> presetManager {};
     std::unique_ptr<ProgramAdapter::BaseProgramAdapter> programAdaptor = std::make_unique<PresetsProgramAdapter> (presetManager);
@@ -142,6 +212,22 @@ protected:
 private:
     static juce::AudioProcessor::BusesProperties getDefaultBusLayout();
 
+    void processBlockInternal (juce::AudioBuffer<float>& buffer);
+    void applyParameterEvent (const ParameterEvent& event);
+
+    ParameterEventList parameterEvents;
+    ParameterEventMode parameterEventMode = ParameterEventMode::Disabled;
+    int parameterEventMinSubBlockSize = 1;
+
+    CallbackTimingMonitor callbackTimingMonitor;
+
+#if JUCE_MODULE_AVAILABLE_chowdsp_clap_extensions
+    void initialiseCLAPParameterIDs();
+    int getParameterIndexForCLAPID (uint32_t clapID) const noexcept;
+
+    std::vector<std::pair<uint32_t, int>> clapParameterIDs; // sorted by CLAP ID
+#endif
+
 #if ! JUCE_MODULE_AVAILABLE_chowdsp_plugin_state
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
@@ -166,12 +252,18 @@ PluginBase<State>::PluginBase (juce::UndoManager* um, const juce::AudioProcessor
     : AudioProcessor (layout),
       state (*this, um)
 {
+#if JUCE_MODULE_AVAILABLE_chowdsp_clap_extensions
+    initialiseCLAPParameterIDs();
+#endif
 }
 #else
 template <class Processor>
 PluginBase<Processor>::PluginBase (juce::UndoManager* um, const juce::AudioProcessor::BusesProperties& layout) : AudioProcessor (layout),
                                                                                                                  vts (*this, um, juce::Identifier ("Parameters"), createParameterLayout())
 {
+#if JUCE_MODULE_AVAILABLE_chowdsp_clap_extensions
+    initialiseCLAPParameterIDs();
+#endif
 }
 
 template <class Processor>
@@ -242,6 +334,16 @@ void PluginBase<P>::prepareToPlay (double sampleRate, int samplesPerBlock)
 
 template <class P>
 void PluginBase<P>::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
+{
+    CHOWDSP_PROFILE_ZONE ("PluginBase::processBlock");
+    callbackTimingMonitor.measureCallback (buffer.getNumSamples(),
+                                           getSampleRate(),
+                                           [this, &buffer]
+                                           { processBlockInternal (buffer); });
+}
+
+template <class P>
+void PluginBase<P>::processBlockInternal (juce::AudioBuffer<float>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
 
@@ -249,9 +351,165 @@ void PluginBase<P>::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBu
     state.getParameterListeners().callAudioThreadBroadcasters();
 #endif
 
-    processAudioBlock (buffer);
+    if (parameterEventMode == ParameterEventMode::SubBlocks && ! parameterEvents.isEmpty())
+    {
+        parameterEvents.processSubBlocks (
+            buffer.getNumSamples(),
+            [this] (const ParameterEvent& event)
+            { applyParameterEvent (event); },
+            [this, &buffer] (int startSample, int numSamples)
+            {
+                juce::AudioBuffer<float> subBuffer { buffer.getArrayOfWritePointers(), buffer.getNumChannels(), startSample, numSamples };
+                processAudioBlock (subBuffer);
+            },
+            parameterEventMinSubBlockSize);
+        parameterEvents.clear();
+    }
+    else
+    {
+        processAudioBlock (buffer);
+        applyParameterEvents();
+    }
+}
+
+template <class P>
+void PluginBase<P>::applyParameterEvents()
+{
+    for (const auto& event : parameterEvents)
+        applyParameterEvent (event);
+
+    parameterEvents.clear();
+}
+
+template <class P>
+void PluginBase<P>::setParameterEventMode (ParameterEventMode newMode, int minSubBlockSize)
+{
+    parameterEventMode = newMode;
+    parameterEventMinSubBlockSize = juce::jmax (1, minSubBlockSize);
+}
+
+template <class P>
+void PluginBase<P>::addParameterEvent (const ParameterEvent& event)
+{
+    if (parameterEventMode == ParameterEventMode::Disabled || ! parameterEvents.addEvent (event))
+        applyParameterEvent (event);
+}
+
+template <class P>
+void PluginBase<P>::applyParameterEvent (const ParameterEvent& event)
+{
+    auto* param = getParameters()[event.parameterIndex];
+    if (param == nullptr)
+        return;
+
+    if (event.type == ParameterEvent::Type::Value)
+    {
+        param->setValue (event.value);
+        param->sendValueChangedMessageToListeners (event.value);
+    }
+    else if (auto* modParam = dynamic_cast<ParamUtils::ModParameterMixin*> (param))
+    {
+        if (event.isPolyphonic())
+            modParam->applyPolyphonicModulation (event.noteID, event.portIndex, event.channel, event.key, (double) event.value);
+        else
+            modParam->applyMonophonicModulation ((double) event.value);
+    }
+}
+
+template <class P>
+bool PluginBase<P>::renderParameterBuffer (const FloatParameter& param, float* data, int numSamples) const noexcept
+{
+    if (parameterEventMode != ParameterEventMode::PerSampleBuffers)
+        return false;
+
+    return parameterEvents.renderParameterBuffer (param.getParameterIndex(),
+                                                  data,
+                                                  numSamples,
+                                                  param.getValue(),
+                                                  param.getModulationAmount(),
+                                                  [&param] (float value, float modulation)
+                                                  { return param.getValueWithModulation (value, modulation); });
+}
+
+#if JUCE_MODULE_AVAILABLE_chowdsp_clap_extensions
+template <class P>
+void PluginBase<P>::initialiseCLAPParameterIDs()
+{
+    // this needs to match the parameter IDs generated by the CLAP wrapper
+    const auto& params = getParameters();
+    clapParameterIDs.clear();
+    clapParameterIDs.reserve ((size_t) params.size());
+    for (auto* param : params)
+    {
+#if JUCE_FORCE_USE_LEGACY_PARAM_IDS
+        const auto clapID = (uint32_t) param->getParameterIndex();
+#else
+        auto* paramWithID = dynamic_cast<juce::AudioProcessorParameterWithID*> (param);
+        const auto paramID = paramWithID != nullptr ? paramWithID->paramID : juce::String (param->getParameterIndex());
+        const auto clapID = (uint32_t) paramID.hashCode();
+#endif
+        clapParameterIDs.emplace_back (clapID, param->getParameterIndex());
+    }
+
+    std::sort (clapParameterIDs.begin(), clapParameterIDs.end());
 }
 
+template <class P>
+int PluginBase<P>::getParameterIndexForCLAPID (uint32_t clapID) const noexcept
+{
+    const auto iter = std::lower_bound (clapParameterIDs.begin(),
+                                        clapParameterIDs.end(),
+                                        clapID,
+                                        [] (const auto& idPair, uint32_t id)
+                                        { return idPair.first < id; });
+    if (iter == clapParameterIDs.end() || iter->first != clapID)
+        return -1;
+    return iter->second;
+}
+
+template <class P>
+bool PluginBase<P>::supportsDirectEvent (uint16_t space_id, uint16_t type)
+{
+    if (parameterEventMode == ParameterEventMode::Disabled || space_id != CLAP_CORE_EVENT_SPACE_ID)
+        return false;
+
+    return type == CLAP_EVENT_PARAM_VALUE || type == CLAP_EVENT_PARAM_MOD;
+}
+
+template <class P>
+void PluginBase<P>::handleDirectEvent (const clap_event_header_t* event, int sampleOffset)
+{
+    if (event->space_id != CLAP_CORE_EVENT_SPACE_ID)
+        return;
+
+    if (event->type == CLAP_EVENT_PARAM_VALUE)
+    {
+        const auto* valueEvent = reinterpret_cast<const clap_event_param_value_t*> (event);
+        const auto paramIndex = getParameterIndexForCLAPID (valueEvent->param_id);
+        if (paramIndex < 0)
+            return;
+
+        addParameterEvent ({ sampleOffset, paramIndex, ParameterEvent::Type::Value, (float) valueEvent->value });
+    }
+    else if (event->type == CLAP_EVENT_PARAM_MOD)
+    {
+        const auto* modEvent = reinterpret_cast<const clap_event_param_mod_t*> (event);
+        const auto paramIndex = getParameterIndexForCLAPID (modEvent->param_id);
+        if (paramIndex < 0)
+            return;
+
+        addParameterEvent ({ sampleOffset,
+                             paramIndex,
+                             ParameterEvent::Type::Modulation,
+                             (float) modEvent->amount,
+                             modEvent->note_id,
+                             modEvent->port_index,
+                             modEvent->channel,
+                             modEvent->key });
+    }
+}
+#endif
+
 #if JUCE_MODULE_AVAILABLE_chowdsp_plugin_state
 template <class State>
 void PluginBase<State>::getStateInformation (juce::MemoryBlock& data)
@@ -100,6 +100,11 @@ namespace PluginDiagnosticInfo
                       + " running at sample rate " + getSampleRateString()
                       + " with block size " + getBlockSizeString() + "\n";
 
+        // audio callback timing info
+        const auto& callbackTimingMonitor = plugin.getCallbackTimingMonitor();
+        if (callbackTimingMonitor.isEnabled())
+            diagString += "Audio Callbacks: " + callbackTimingMonitor.getStats().toString() + "\n";
+
         return diagString;
     }
 } // namespace PluginDiagnosticInfo
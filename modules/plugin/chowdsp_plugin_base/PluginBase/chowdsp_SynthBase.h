@@ -8,6 +8,11 @@ namespace chowdsp
  * Derived classes must override `prepareToPlay` and `releaseResources`
  * (from `juce::AudioProcessor`), as well as `processSynth`, and
  * `addParameters`.
+ *
+ * Parameter events are applied to the parameters after `processSynth()`
+ * returns, so synths that need sample-accurate parameter changes or
+ * polyphonic modulation should handle `getParameterEvents()` themselves,
+ * e.g. by passing them to `SynthVoiceEngine::process()`.
 */
 template <class Processor>
 class SynthBase : public PluginBase<Processor>
@@ -25,18 +30,11 @@ public:
 
     void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) override
     {
-        juce::ScopedNoDenormals noDenormals;
-
-#if JUCE_MODULE_AVAILABLE_chowdsp_plugin_state
-        this->state.getParameterListeners().callAudioThreadBroadcasters();
-#endif
-
-#if JUCE_MODULE_AVAILABLE_foleys_gui_magic
-        this->magicState.processMidiBuffer (midi, buffer.getNumSamples(), true);
-#endif
-
-        buffer.clear();
-        processSynth (buffer, midi);
+        CHOWDSP_PROFILE_ZONE ("SynthBase::processBlock");
+        this->getCallbackTimingMonitor().measureCallback (buffer.getNumSamples(),
+                                                          this->getSampleRate(),
+                                                          [this, &buffer, &midi]
+                                                          { processSynthBlock (buffer, midi); });
     }
 
 #if JUCE_MODULE_AVAILABLE_chowdsp_clap_extensions
@@ -56,6 +54,23 @@ private:
 
     void processAudioBlock (juce::AudioBuffer<float>&) override {}
 
+    void processSynthBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+    {
+        juce::ScopedNoDenormals noDenormals;
+
+#if JUCE_MODULE_AVAILABLE_chowdsp_plugin_state
+        this->state.getParameterListeners().callAudioThreadBroadcasters();
+#endif
+
+#if JUCE_MODULE_AVAILABLE_foleys_gui_magic
+        this->magicState.processMidiBuffer (midi, buffer.getNumSamples(), true);
+#endif
+
+        buffer.clear();
+        processSynth (buffer, midi);
+        this->applyParameterEvents();
+    }
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SynthBase)
 };
 } // namespace chowdsp
@@ -0,0 +1,249 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Stores the polyphonic (per-note) modulation amounts for a set of parameters,
+ * for each voice of a polyphonic synth.
+ *
+ * The modulation amounts are stored in flat arrays, indexed by parameter and voice.
+ * The modulation events for each block are kept with their sample offsets, so that
+ * voices can either read the modulated parameter value at a given sample, or render
+ * a sample-accurate buffer of modulated values. Polyphonic modulation events are
+ * routed to voices by chowdsp::SynthVoiceEngine, which matches the events' note IDs
+ * (or channels and keys) to the voices that are playing those notes.
+ *
+ * Memory is only allocated by `prepare()`, so the rest of the class is safe
+ * to use on the audio thread.
+ */
+class PolyphonicModulationStore
+{
+public:
+    static constexpr int defaultEventCapacity = 1024;
+
+    PolyphonicModulationStore() = default;
+
+    /**
+     * Allocates storage for the given parameters, and numVoices voices. The event capacity
+     * is the maximum number of modulation events that can be stored for a single block.
+     */
+    void prepare (const std::vector<const FloatParameter*>& parameters, int numVoices, int eventCapacity = defaultEventCapacity)
+    {
+        std::vector<int> parameterIndices;
+        for (const auto* param : parameters)
+        {
+            jassert (param->getParameterIndex() >= 0); // parameter must be added to the processor first!
+            parameterIndices.push_back (param->getParameterIndex());
+        }
+
+        prepare (parameterIndices, numVoices, eventCapacity);
+    }
+
+    /** Allocates storage for the parameters with the given indices (in the processor's parameter list), and numVoices voices. */
+    void prepare (const std::vector<int>& parameterIndices, int numVoices, int eventCapacity = defaultEventCapacity)
+    {
+        numSlots = (int) parameterIndices.size();
+        numStoredVoices = numVoices;
+
+        slotForParameter.clear();
+        for (auto [slot, paramIndex] : enumerate (parameterIndices))
+        {
+            if ((int) slotForParameter.size() <= paramIndex)
+                slotForParameter.resize ((size_t) paramIndex + 1, -1);
+            slotForParameter[(size_t) paramIndex] = (int) slot;
+        }
+
+        const auto numCells = (size_t) numSlots * (size_t) numVoices;
+        blockStartAmounts.assign (numCells, 0.0f);
+        firstEvent.assign (numCells, -1);
+        lastEvent.assign (numCells, -1);
+
+        events.resize ((size_t) eventCapacity);
+        cellsWithEvents.resize ((size_t) eventCapacity);
+        numEvents = 0;
+        numCellsWithEvents = 0;
+    }
+
+    /** Returns true if polyphonic modulation is being stored for this parameter. */
+    [[nodiscard]] bool hasParameter (int parameterIndex) const noexcept { return getSlot (parameterIndex) >= 0; }
+
+    /** Returns the number of voices being stored. */
+    [[nodiscard]] int getNumVoices() const noexcept { return numStoredVoices; }
+
+    /**
+     * Adds a modulation event for a voice, at a sample offset relative to the start of the
+     * current block. Events for each voice and parameter must be added in time order.
+     *
+     * If the parameter isn't in the store, the event is ignored. If the event list is full,
+     * the event replaces the voice's previous event for this parameter in the current block
+     * (or is applied from the start of the block, if there is no previous event).
+     */
+    void addModulationEvent (int voiceIndex, int parameterIndex, float modulationAmount, int sampleOffset) noexcept
+    {
+        const auto slot = getSlot (parameterIndex);
+        if (slot < 0)
+            return;
+
+        const auto cell = getCell (slot, voiceIndex);
+        if (numEvents >= (int) events.size())
+        {
+            // the previous event would override the block start amount, so it needs to take the new amount instead
+            if (lastEvent[cell] >= 0)
+                events[(size_t) lastEvent[cell]].amount = modulationAmount;
+            else
+                blockStartAmounts[cell] = modulationAmount;
+            return;
+        }
+
+        const auto eventIndex = numEvents++;
+        events[(size_t) eventIndex] = { sampleOffset, modulationAmount, -1 };
+
+        if (lastEvent[cell] < 0)
+        {
+            firstEvent[cell] = eventIndex;
+            cellsWithEvents[(size_t) numCellsWithEvents++] = cell;
+        }
+        else
+        {
+            events[(size_t) lastEvent[cell]].next = eventIndex;
+        }
+        lastEvent[cell] = eventIndex;
+    }
+
+    /** Clears the modulation for a voice, e.g. when the voice starts playing a new note. */
+    void resetVoice (int voiceIndex) noexcept
+    {
+        for (int slot = 0; slot < numSlots; ++slot)
+        {
+            const auto cell = getCell (slot, voiceIndex);
+            blockStartAmounts[cell] = 0.0f;
+            firstEvent[cell] = -1;
+            lastEvent[cell] = -1;
+        }
+    }
+
+    /** Clears the modulation for every voice. */
+    void resetAllVoices() noexcept
+    {
+        std::fill (blockStartAmounts.begin(), blockStartAmounts.end(), 0.0f);
+        std::fill (firstEvent.begin(), firstEvent.end(), -1);
+        std::fill (lastEvent.begin(), lastEvent.end(), -1);
+        numEvents = 0;
+        numCellsWithEvents = 0;
+    }
+
+    /** Applies the modulation events from the current block, and clears the event list. This should be called at the end of each block. */
+    void endBlock() noexcept
+    {
+        for (int i = 0; i < numCellsWithEvents; ++i)
+        {
+            const auto cell = cellsWithEvents[(size_t) i];
+            if (lastEvent[cell] < 0)
+                continue; // the voice was reset after this event was added
+
+            blockStartAmounts[cell] = events[(size_t) lastEvent[cell]].amount;
+            firstEvent[cell] = -1;
+            lastEvent[cell] = -1;
+        }
+
+        numEvents = 0;
+        numCellsWithEvents = 0;
+    }
+
+    /** Returns the (normalised) polyphonic modulation amount for a voice at a sample offset in the current block. */
+    [[nodiscard]] float getModulationAmount (int parameterIndex, int voiceIndex, int sampleOffset = 0) const noexcept
+    {
+        const auto slot = getSlot (parameterIndex);
+        if (slot < 0)
+            return 0.0f;
+
+        const auto cell = getCell (slot, voiceIndex);
+        auto amount = blockStartAmounts[cell];
+        for (auto eventIndex = firstEvent[cell]; eventIndex >= 0 && events[(size_t) eventIndex].sampleOffset <= sampleOffset; eventIndex = events[(size_t) eventIndex].next)
+            amount = events[(size_t) eventIndex].amount;
+
+        return amount;
+    }
+
+    /** Returns the parameter's value for a voice, including the monophonic and polyphonic modulation, at a sample offset in the current block. */
+    [[nodiscard]] float getModulatedValue (const FloatParameter& param, int voiceIndex, int sampleOffset = 0) const noexcept
+    {
+        return param.getValueWithModulation (param.getValue(), param.getModulationAmount() + getModulationAmount (param.getParameterIndex(), voiceIndex, sampleOffset));
+    }
+
+    /**
+     * Renders a buffer of the parameter's value for a voice (as in getModulatedValue()),
+     * from startSample to startSample + numSamples in the current block.
+     *
+     * Returns false (without writing to the buffer) if the voice's modulation doesn't
+     * change in that range, in which case `getModulatedValue (param, voiceIndex, startSample)`
+     * can be used for the whole range.
+     */
+    bool renderModulatedValues (const FloatParameter& param, int voiceIndex, float* data, int startSample, int numSamples) const noexcept
+    {
+        const auto slot = getSlot (param.getParameterIndex());
+        if (slot < 0)
+            return false;
+
+        const auto cell = getCell (slot, voiceIndex);
+        const auto endSample = startSample + numSamples;
+        auto amount = blockStartAmounts[cell];
+        auto eventIndex = firstEvent[cell];
+        for (; eventIndex >= 0 && events[(size_t) eventIndex].sampleOffset <= startSample; eventIndex = events[(size_t) eventIndex].next)
+            amount = events[(size_t) eventIndex].amount;
+
+        if (eventIndex < 0 || events[(size_t) eventIndex].sampleOffset >= endSample)
+            return false;
+
+        const auto normalisedValue = param.getValue();
+        const auto monoModulation = param.getModulationAmount();
+        auto sample = startSample;
+        while (sample < endSample)
+        {
+            const auto nextChange = eventIndex >= 0 ? juce::jmin (events[(size_t) eventIndex].sampleOffset, endSample) : endSample;
+            std::fill (data + (sample - startSample), data + (nextChange - startSample), param.getValueWithModulation (normalisedValue, monoModulation + amount));
+            sample = nextChange;
+
+            if (eventIndex >= 0)
+            {
+                amount = events[(size_t) eventIndex].amount;
+                eventIndex = events[(size_t) eventIndex].next;
+            }
+        }
+
+        return true;
+    }
+
+private:
+    struct Event
+    {
+        int sampleOffset;
+        float amount;
+        int next; // the next event for the same voice and parameter
+    };
+
+    [[nodiscard]] int getSlot (int parameterIndex) const noexcept
+    {
+        if (parameterIndex < 0 || parameterIndex >= (int) slotForParameter.size())
+            return -1;
+        return slotForParameter[(size_t) parameterIndex];
+    }
+
+    [[nodiscard]] size_t getCell (int slot, int voiceIndex) const noexcept { return (size_t) slot * (size_t) numStoredVoices + (size_t) voiceIndex; }
+
+    int numSlots = 0;
+    int numStoredVoices = 0;
+    std::vector<int> slotForParameter;
+
+    std::vector<float> blockStartAmounts;
+    std::vector<int> firstEvent;
+    std::vector<int> lastEvent;
+
+    std::vector<Event> events;
+    int numEvents = 0;
+    std::vector<size_t> cellsWithEvents;
+    int numCellsWithEvents = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PolyphonicModulationStore)
+};
+} // namespace chowdsp
@@ -0,0 +1,220 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Base class for the voice processing in a polyphonic synth.
+ *
+ * The engine splits each block at the MIDI events, so that notes start and stop with
+ * sample accuracy. For each sub-block, the derived class's `processVoiceGroup()` is called
+ * for every group of voices with at least one active voice. Derived classes should store
+ * their voice state as structure-of-arrays (e.g. one `xsimd::batch<float>` per group for
+ * each oscillator phase or filter state), so that all the voices in a group can be
+ * processed together.
+ *
+ * Polyphonic modulation events are routed to the voices playing the notes that they
+ * target, and stored (with their sample offsets) in the engine's PolyphonicModulationStore,
+ * which the voices can read from while processing.
+ *
+ * MIDI messages don't have note IDs, so voices started from MIDI note-on messages can
+ * only be targeted by channel and key. Notes with IDs (e.g. from CLAP note events) can
+ * be started and released with `startNote()` and `releaseNote()`.
+ *
+ * @code
+ * struct MyVoices : chowdsp::SynthVoiceEngine
+ * {
+ *     MyVoices() : chowdsp::SynthVoiceEngine (128, (int) xsimd::batch<float>::size) {}
+ *     void startVoice (int voiceIndex) override { ... }
+ *     void processVoiceGroup (int groupIndex, uint32_t voiceMask, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) override { ... }
+ * };
+ *
+ * void MySynth::processSynth (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi)
+ * {
+ *     voices.process (buffer, midi, &getParameterEvents());
+ * }
+ * @endcode
+ */
+class SynthVoiceEngine
+{
+public:
+    /** Creates an engine for maxNumVoices voices, in groups of voicesPerGroup. */
+    SynthVoiceEngine (int maxNumVoices, int voicesPerGroup) : voiceAllocator (maxNumVoices, voicesPerGroup) {}
+
+    virtual ~SynthVoiceEngine() = default;
+
+    /**
+     * Sets the parameters that can be modulated polyphonically. This will allocate
+     * memory, so it should not be called while the engine is processing audio.
+     */
+    void setPolyphonicModulationParameters (const std::vector<const FloatParameter*>& parameters, int eventCapacity = PolyphonicModulationStore::defaultEventCapacity)
+    {
+        polyphonicModulation.prepare (parameters, voiceAllocator.getNumVoices(), eventCapacity);
+    }
+
+    /**
+     * Processes a block of audio. The output from the voices should be added to the buffer.
+     *
+     * If a list of parameter events is provided, any polyphonic modulation events for
+     * the parameters in the PolyphonicModulationStore will be added to the store,
+     * for the voices that they target.
+     */
+    void process (juce::AudioBuffer<float>& buffer, const juce::MidiBuffer& midi, const ParameterEventList* parameterEvents = nullptr)
+    {
+        const auto numSamples = buffer.getNumSamples();
+        auto midiIter = midi.cbegin();
+        auto paramEventIter = parameterEvents != nullptr ? parameterEvents->begin() : nullptr;
+        const auto paramEventsEnd = parameterEvents != nullptr ? parameterEvents->end() : nullptr;
+
+        int startSample = 0;
+        while (true)
+        {
+            // handle all the events at the start of this sub-block (or any events past the end of the block)
+            const auto isEndOfBlock = startSample >= numSamples;
+            while (midiIter != midi.cend() && (isEndOfBlock || (*midiIter).samplePosition <= startSample))
+                handleMidiMessage ((*midiIter++).getMessage());
+
+            auto endSample = numSamples;
+            if (midiIter != midi.cend() && ! isEndOfBlock)
+                endSample = juce::jmin (endSample, (*midiIter).samplePosition);
+
+            // the voices can't change during a sub-block, so the modulation events for the sub-block can be routed now
+            while (paramEventIter != paramEventsEnd && (isEndOfBlock || paramEventIter->sampleOffset < endSample))
+                handleParameterEvent (*paramEventIter++);
+
+            if (isEndOfBlock)
+                break;
+
+            processVoices (buffer, startSample, endSample - startSample);
+            startSample = endSample;
+        }
+
+        polyphonicModulation.endBlock();
+    }
+
+    /**
+     * Starts a voice for a note with a note ID (e.g. from a CLAP note event), so that
+     * polyphonic modulation events can target the voice by its note ID. Call this from
+     * the audio thread before process(), for notes that start at the beginning of the block.
+     */
+    void startNote (int32_t noteID, int16_t channel, int16_t key, float velocity)
+    {
+        bool stolenVoice = false;
+        const auto voiceIndex = voiceAllocator.startNote (noteID, channel, key, velocity, stolenVoice);
+        if (stolenVoice)
+            stopVoice (voiceIndex);
+        polyphonicModulation.resetVoice (voiceIndex);
+        startVoice (voiceIndex);
+    }
+
+    /**
+     * Releases the voices matching a note. Following the CLAP conventions, a note ID,
+     * channel, or key of -1 is a wildcard. Call this from the audio thread before process(),
+     * for notes that end at the beginning of the block.
+     */
+    void releaseNote (int32_t noteID, int16_t channel, int16_t key)
+    {
+        voiceAllocator.forEachMatchingVoice (noteID, channel, key, [this] (int voiceIndex)
+                                             { releaseVoiceInternal (voiceIndex); },
+                                             false);
+    }
+
+    /** Releases all the voices, or stops them immediately if allowTailOff is false. */
+    void allNotesOff (bool allowTailOff)
+    {
+        for (int voiceIndex = 0; voiceIndex < voiceAllocator.getNumVoices(); ++voiceIndex)
+        {
+            if (voiceAllocator.getVoiceState (voiceIndex) == VoiceAllocator::VoiceState::Idle)
+                continue;
+
+            if (allowTailOff)
+            {
+                releaseVoiceInternal (voiceIndex);
+            }
+            else
+            {
+                stopVoice (voiceIndex);
+                voiceAllocator.freeVoice (voiceIndex);
+            }
+        }
+    }
+
+    /** Returns the engine's voice allocator. */
+    [[nodiscard]] const VoiceAllocator& getVoiceAllocator() const noexcept { return voiceAllocator; }
+
+    /** Returns the engine's polyphonic modulation store. */
+    [[nodiscard]] PolyphonicModulationStore& getPolyphonicModulation() noexcept { return polyphonicModulation; }
+
+protected:
+    /** Called when a voice should start playing a note. The note details are available from the voice allocator. */
+    virtual void startVoice (int voiceIndex) = 0;
+
+    /** Called when a voice's note is released. The voice should call `voiceFinished()` once its tail is over. */
+    virtual void releaseVoice (int /*voiceIndex*/) {}
+
+    /** Called when a voice should stop immediately, e.g. because it is being stolen for a new note. */
+    virtual void stopVoice (int /*voiceIndex*/) {}
+
+    /**
+     * Called to process a group of voices. Bit n of voiceMask is set if voice
+     * (groupIndex * voicesPerGroup + n) is active. The output from the voices
+     * should be added to the buffer, from startSample to startSample + numSamples.
+     */
+    virtual void processVoiceGroup (int groupIndex, uint32_t voiceMask, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) = 0;
+
+    /** Called for MIDI messages other than note on/off messages (e.g. pitch bend, or controllers). */
+    virtual void handleOtherMidiMessage (const juce::MidiMessage&) {}
+
+    /** Derived classes should call this once a voice has finished playing, so that it can be re-used. */
+    void voiceFinished (int voiceIndex) noexcept { voiceAllocator.freeVoice (voiceIndex); }
+
+    VoiceAllocator voiceAllocator;
+    PolyphonicModulationStore polyphonicModulation;
+
+private:
+    void handleMidiMessage (const juce::MidiMessage& message)
+    {
+        const auto channel = (int16_t) (message.getChannel() - 1);
+        if (message.isNoteOn())
+            startNote (-1, channel, (int16_t) message.getNoteNumber(), message.getFloatVelocity());
+        else if (message.isNoteOff())
+            releaseNote (-1, channel, (int16_t) message.getNoteNumber());
+        else if (message.isAllNotesOff() || message.isAllSoundOff())
+            allNotesOff (message.isAllNotesOff());
+        else
+            handleOtherMidiMessage (message);
+    }
+
+    void handleParameterEvent (const ParameterEvent& event)
+    {
+        if (! event.isPolyphonic() || ! polyphonicModulation.hasParameter (event.parameterIndex))
+            return;
+
+        voiceAllocator.forEachMatchingVoice (event.noteID, event.channel, event.key, [this, &event] (int voiceIndex)
+                                             { polyphonicModulation.addModulationEvent (voiceIndex, event.parameterIndex, event.value, event.sampleOffset); });
+    }
+
+    void releaseVoiceInternal (int voiceIndex)
+    {
+        if (voiceAllocator.getVoiceState (voiceIndex) != VoiceAllocator::VoiceState::Held)
+            return;
+
+        voiceAllocator.releaseVoice (voiceIndex);
+        releaseVoice (voiceIndex);
+    }
+
+    void processVoices (juce::AudioBuffer<float>& buffer, int startSample, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        for (int groupIndex = 0; groupIndex < voiceAllocator.getNumGroups(); ++groupIndex)
+        {
+            // skip groups with no active voices
+            if (const auto voiceMask = voiceAllocator.getGroupMask (groupIndex); voiceMask != 0)
+                processVoiceGroup (groupIndex, voiceMask, buffer, startSample, numSamples);
+        }
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SynthVoiceEngine)
+};
+} // namespace chowdsp
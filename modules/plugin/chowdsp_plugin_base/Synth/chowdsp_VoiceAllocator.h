@@ -0,0 +1,192 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Keeps track of the voices in a polyphonic synth.
+ *
+ * The voices are arranged in groups of voicesPerGroup voices (usually the SIMD
+ * register width), so that the voice state can be stored as a structure-of-arrays,
+ * and each group of voices can be processed together in SIMD lanes. New notes are
+ * allocated to the lowest free voice, which keeps the active voices packed into as
+ * few groups as possible, and groups with no active voices can be skipped entirely.
+ *
+ * When every voice is in use, the oldest released voice is stolen, or the oldest
+ * held voice if no voices have been released.
+ *
+ * Memory is only allocated by the constructor, so the rest of the class is safe
+ * to use on the audio thread.
+ */
+class VoiceAllocator
+{
+public:
+    /** The maximum number of voices in a group (the size of the group masks). */
+    static constexpr int maxVoicesPerGroup = 32;
+
+    enum class VoiceState : uint8_t
+    {
+        Idle, /**< The voice is not playing */
+        Held, /**< The voice's note is still being held */
+        Released, /**< The voice's note has been released, but the voice is still playing its tail */
+    };
+
+    /** Creates an allocator for maxNumVoices voices, in groups of voicesPerGroup. */
+    VoiceAllocator (int maxNumVoices, int voicesPerGroup)
+        : numVoices (juce::jmax (1, maxNumVoices)),
+          groupSize (juce::jlimit (1, maxVoicesPerGroup, voicesPerGroup)),
+          numGroups ((numVoices + groupSize - 1) / groupSize)
+    {
+        states.resize ((size_t) numVoices, VoiceState::Idle);
+        noteIDs.resize ((size_t) numVoices, -1);
+        channels.resize ((size_t) numVoices, -1);
+        keys.resize ((size_t) numVoices, -1);
+        velocities.resize ((size_t) numVoices, 0.0f);
+        startTimes.resize ((size_t) numVoices, 0);
+        groupMasks.resize ((size_t) numGroups, 0);
+    }
+
+    /** Returns the total number of voices. */
+    [[nodiscard]] int getNumVoices() const noexcept { return numVoices; }
+
+    /** Returns the number of voices in each group. */
+    [[nodiscard]] int getNumVoicesPerGroup() const noexcept { return groupSize; }
+
+    /** Returns the number of voice groups. */
+    [[nodiscard]] int getNumGroups() const noexcept { return numGroups; }
+
+    /**
+     * Allocates a voice for a new note, stealing a voice if needed, and returns its index.
+     * If a voice was stolen, stolenVoice will be set to true.
+     *
+     * The note ID should be -1 if it is not known (e.g. for MIDI notes),
+     * and the channel should be in the range [0, 16).
+     */
+    int startNote (int32_t noteID, int16_t channel, int16_t key, float velocity, bool& stolenVoice) noexcept
+    {
+        auto voiceIndex = findFreeVoice();
+        stolenVoice = voiceIndex < 0;
+        if (stolenVoice)
+            voiceIndex = findVoiceToSteal();
+
+        const auto v = (size_t) voiceIndex;
+        states[v] = VoiceState::Held;
+        noteIDs[v] = noteID;
+        channels[v] = channel;
+        keys[v] = key;
+        velocities[v] = velocity;
+        startTimes[v] = ++currentTime;
+        groupMasks[(size_t) (voiceIndex / groupSize)] |= (1u << (voiceIndex % groupSize));
+
+        return voiceIndex;
+    }
+
+    /** Marks a held voice as released. */
+    void releaseVoice (int voiceIndex) noexcept
+    {
+        if (states[(size_t) voiceIndex] == VoiceState::Held)
+            states[(size_t) voiceIndex] = VoiceState::Released;
+    }
+
+    /** Marks a voice as idle, once it has finished playing. */
+    void freeVoice (int voiceIndex) noexcept
+    {
+        states[(size_t) voiceIndex] = VoiceState::Idle;
+        noteIDs[(size_t) voiceIndex] = -1;
+        groupMasks[(size_t) (voiceIndex / groupSize)] &= ~(1u << (voiceIndex % groupSize));
+    }
+
+    /**
+     * Calls voiceCallback (int voiceIndex) for each voice in the given state that matches
+     * the note. Following the CLAP conventions, a note ID, channel, or key of -1 is a
+     * wildcard, and voices without a note ID (e.g. from MIDI notes) are matched by
+     * their channel and key.
+     */
+    template <typename Callback>
+    void forEachMatchingVoice (int32_t noteID, int16_t channel, int16_t key, Callback&& voiceCallback, bool includeReleasedVoices = true) const
+    {
+        for (int voiceIndex = 0; voiceIndex < numVoices; ++voiceIndex)
+        {
+            const auto v = (size_t) voiceIndex;
+            if (states[v] == VoiceState::Idle || (! includeReleasedVoices && states[v] == VoiceState::Released))
+                continue;
+
+            if (noteID >= 0 && noteIDs[v] >= 0)
+            {
+                if (noteIDs[v] != noteID)
+                    continue;
+            }
+            else if ((channel >= 0 && channels[v] != channel) || (key >= 0 && keys[v] != key))
+            {
+                continue;
+            }
+
+            voiceCallback (voiceIndex);
+        }
+    }
+
+    /** Returns a bit mask of the active (held or released) voices in a group. */
+    [[nodiscard]] uint32_t getGroupMask (int groupIndex) const noexcept { return groupMasks[(size_t) groupIndex]; }
+
+    /** Returns the number of active (held or released) voices. */
+    [[nodiscard]] int getNumActiveVoices() const noexcept
+    {
+        int count = 0;
+        for (auto mask : groupMasks)
+            count += juce::countNumberOfBits (mask);
+        return count;
+    }
+
+    [[nodiscard]] VoiceState getVoiceState (int voiceIndex) const noexcept { return states[(size_t) voiceIndex]; }
+    [[nodiscard]] int32_t getNoteID (int voiceIndex) const noexcept { return noteIDs[(size_t) voiceIndex]; }
+    [[nodiscard]] int16_t getChannel (int voiceIndex) const noexcept { return channels[(size_t) voiceIndex]; }
+    [[nodiscard]] int16_t getKey (int voiceIndex) const noexcept { return keys[(size_t) voiceIndex]; }
+    [[nodiscard]] float getVelocity (int voiceIndex) const noexcept { return velocities[(size_t) voiceIndex]; }
+
+private:
+    int findFreeVoice() const noexcept
+    {
+        const auto fullGroupMask = groupSize == maxVoicesPerGroup ? ~0u : ((1u << groupSize) - 1u);
+        for (int groupIndex = 0; groupIndex < numGroups; ++groupIndex)
+        {
+            const auto freeMask = ~groupMasks[(size_t) groupIndex] & fullGroupMask;
+            if (freeMask == 0)
+                continue;
+
+            const auto voiceIndex = groupIndex * groupSize + juce::findHighestSetBit (freeMask & (~freeMask + 1u)); // lowest free voice
+            if (voiceIndex < numVoices)
+                return voiceIndex;
+        }
+
+        return -1;
+    }
+
+    int findVoiceToSteal() const noexcept
+    {
+        int oldestReleased = -1;
+        int oldestHeld = -1;
+        for (int voiceIndex = 0; voiceIndex < numVoices; ++voiceIndex)
+        {
+            auto& oldest = states[(size_t) voiceIndex] == VoiceState::Released ? oldestReleased : oldestHeld;
+            if (oldest < 0 || startTimes[(size_t) voiceIndex] < startTimes[(size_t) oldest])
+                oldest = voiceIndex;
+        }
+
+        return oldestReleased >= 0 ? oldestReleased : oldestHeld;
+    }
+
+    const int numVoices;
+    const int groupSize;
+    const int numGroups;
+
+    std::vector<VoiceState> states;
+    std::vector<int32_t> noteIDs;
+    std::vector<int16_t> channels;
+    std::vector<int16_t> keys;
+    std::vector<float> velocities;
+    std::vector<uint64_t> startTimes;
+    std::vector<uint32_t> groupMasks;
+    uint64_t currentTime = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VoiceAllocator)
+};
+} // namespace chowdsp
@@ -33,6 +33,8 @@ BEGIN_JUCE_MODULE_DECLARATION
 #endif
 
 #include "PluginBase/chowdsp_ProgramAdapter.h"
+#include "PluginBase/chowdsp_ParameterEventList.h"
+#include "PluginBase/chowdsp_CallbackTimingMonitor.h"
 
 JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wzero-as-null-pointer-constant", // Clang doesn't like HasAddParameters checker
                                      "-Winconsistent-missing-destructor-override")
@@ -41,4 +43,7 @@ JUCE_END_IGNORE_WARNINGS_GCC_LIKE
 
 #include "PluginBase/chowdsp_DummySynthSound.h"
 #include "PluginBase/chowdsp_SynthBase.h"
+#include "Synth/chowdsp_VoiceAllocator.h"
+#include "Synth/chowdsp_PolyphonicModulationStore.h"
+#include "Synth/chowdsp_SynthVoiceEngine.h"
 #include "PluginBase/chowdsp_PluginDiagnosticInfo.h"
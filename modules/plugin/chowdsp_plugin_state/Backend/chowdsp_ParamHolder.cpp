@@ -4,6 +4,11 @@ inline ParamHolder::ParamHolder (const juce::String& paramHolderName) : name (pa
 {
 }
 
+inline ParamHolder::~ParamHolder()
+{
+    destructionBroadcaster();
+}
+
 template <typename ParamType, typename... OtherParams>
 std::enable_if_t<std::is_base_of_v<FloatParameter, ParamType>, void>
     ParamHolder::add (OptionalPointer<ParamType>& floatParam, OtherParams&... others)
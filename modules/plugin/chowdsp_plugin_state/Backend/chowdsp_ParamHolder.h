@@ -11,6 +11,9 @@ public:
     ParamHolder (ParamHolder&&) noexcept = default;
     ParamHolder& operator= (ParamHolder&&) noexcept = default;
 
+    /** Destructor */
+    ~ParamHolder();
+
     /** Adds parameters to the ParamHolder. */
     template <typename ParamType, typename... OtherParams>
     std::enable_if_t<std::is_base_of_v<FloatParameter, ParamType>, void>
@@ -81,6 +84,12 @@ public:
     /** Assign this function to apply version streaming to your non-parameter state. */
     std::function<void (const Version&)> versionStreamingCallback = nullptr;
 
+    /**
+     * Internal use only!
+     * Called when the ParamHolder is being destroyed, before the parameters it owns are destroyed.
+     */
+    Broadcaster<void()> destructionBroadcaster;
+
 private:
     void add() const
     {
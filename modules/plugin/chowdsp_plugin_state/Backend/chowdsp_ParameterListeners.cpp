@@ -2,38 +2,124 @@
 
 namespace chowdsp
 {
-ParameterListeners::ParameterListeners (ParamHolder& parameters, int interval)
-    : totalNumParams ((size_t) parameters.count())
+ParameterListeners::ParamChangeListener::ParamChangeListener (ParameterListeners& listeners, juce::RangedAudioParameter& parameter, size_t paramIndex)
+    : owner (listeners),
+      param (parameter),
+      index (paramIndex)
 {
-    parameters.doForAllParameters (
-        [this] (auto& param, size_t index)
+    param.addListener (this);
+}
+
+ParameterListeners::ParamChangeListener::~ParamChangeListener()
+{
+    param.removeListener (this);
+}
+
+ParameterListeners::ParameterListeners (ParamHolder& parameters, int interval, ChangeDetectionMode changeDetectionMode)
+    : totalNumParams ((size_t) parameters.count()),
+      mode (changeDetectionMode),
+      changedFlags ((totalNumParams + bitsPerWord - 1) / bitsPerWord)
+{
+    size_t index = 0;
+    addParameters (parameters, index);
+    jassert (index == totalNumParams);
+
+    startTimer (interval);
+}
+
+void ParameterListeners::addParameters (ParamHolder& parameters, size_t& index)
+{
+    // parameters are visited in the same order as ParamHolder::doForAllParameters()
+    const auto startIndex = index;
+    auto endIndex = index;
+    parameters.doForAllParameterContainers (
+        [this, &index, &endIndex] (auto& paramVector)
         {
-            const auto* rangedParam = static_cast<juce::RangedAudioParameter*> (&param);
-            paramInfoList[index] = ParamInfo { rangedParam, rangedParam->getValue() };
+            for (auto& param : paramVector)
+            {
+                auto* rangedParam = static_cast<juce::RangedAudioParameter*> (param.get());
+                paramInfoList[index] = ParamInfo { rangedParam, rangedParam->getValue() };
+
+                if (mode == ChangeDetectionMode::PushNotifications)
+                    paramChangeListeners[index] = std::make_unique<ParamChangeListener> (*this, *rangedParam, index);
+
+                endIndex = ++index;
+            }
+        },
+        [this, &index] (ParamHolder& holder)
+        {
+            addParameters (holder, index);
         });
 
-    startTimer (interval);
+    paramHolderDestructionCallbacks.push_back (parameters.destructionBroadcaster.connect (
+        [this, startIndex, endIndex]
+        { removeParameters (startIndex, endIndex); }));
+}
+
+void ParameterListeners::removeParameters (size_t startIndex, size_t endIndex)
+{
+    for (auto index = startIndex; index < endIndex; ++index)
+    {
+        paramChangeListeners[index].reset();
+        paramInfoList[index].paramCookie = nullptr;
+    }
+}
+
+ParameterListeners::~ParameterListeners()
+{
+    stopTimer();
 }
 
 void ParameterListeners::timerCallback()
 {
-    updateBroadcastersFromMessageThread();
+    if (mode == ChangeDetectionMode::PushNotifications)
+        updateChangedBroadcasters();
+    else
+        updateBroadcastersFromMessageThread();
 }
 
-void ParameterListeners::updateBroadcastersFromMessageThread()
+void ParameterListeners::markParameterChanged (size_t index) noexcept
+{
+    changedFlags[index / bitsPerWord].fetch_or (uint64_t (1) << (index % bitsPerWord), std::memory_order_release);
+    anyParametersChanged.store (true, std::memory_order_release);
+}
+
+void ParameterListeners::updateChangedBroadcasters()
 {
     jassert (juce::MessageManager::existsAndIsCurrentThread());
-    for (const auto [index, paramInfo] : enumerate (paramInfoList))
+    if (! anyParametersChanged.exchange (false, std::memory_order_acq_rel))
+        return;
+
+    for (size_t wordIndex = 0; wordIndex < changedFlags.size(); ++wordIndex)
     {
-        if (paramInfo.paramCookie->getValue() == paramInfo.value)
-            continue;
+        auto changedBits = changedFlags[wordIndex].exchange (0, std::memory_order_acquire);
+        while (changedBits != 0)
+        {
+            const auto bitIndex = (size_t) juce::countNumberOfBits ((juce::uint64) ((changedBits & (~changedBits + 1)) - 1)); // index of the lowest set bit
+            changedBits &= changedBits - 1;
+            updateBroadcaster (wordIndex * bitsPerWord + bitIndex);
+        }
+    }
+}
 
-        paramInfo.value = paramInfo.paramCookie->getValue();
+void ParameterListeners::updateBroadcastersFromMessageThread()
+{
+    jassert (juce::MessageManager::existsAndIsCurrentThread());
+    for (size_t index = 0; index < totalNumParams; ++index)
+        updateBroadcaster (index);
+}
 
-        audioThreadBroadcastQueue.try_enqueue ([this, i = index]
-                                               { callAudioThreadBroadcaster (i); });
-        callMessageThreadBroadcaster (index);
-    }
+void ParameterListeners::updateBroadcaster (size_t index)
+{
+    auto& paramInfo = paramInfoList[index];
+    if (paramInfo.paramCookie == nullptr || paramInfo.paramCookie->getValue() == paramInfo.value)
+        return;
+
+    paramInfo.value = paramInfo.paramCookie->getValue();
+
+    audioThreadBroadcastQueue.try_enqueue ([this, i = index]
+                                           { callAudioThreadBroadcaster (i); });
+    callMessageThreadBroadcaster (index);
 }
 
 void ParameterListeners::callAudioThreadBroadcasters()
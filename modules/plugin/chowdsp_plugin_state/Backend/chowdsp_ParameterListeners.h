@@ -27,8 +27,29 @@ enum class ParameterListenerThread
 class ParameterListeners : private juce::Timer
 {
 public:
+    /** Options for how parameter changes should be detected. */
+    enum class ChangeDetectionMode
+    {
+        /**
+         * Parameter changes are pushed into a lock-free "dirty" bitset,
+         * so the message thread only needs to visit parameters that have
+         * actually changed. Note that this mode requires parameter changes
+         * to be broadcast to the parameter's listeners (e.g. via `setValueNotifyingHost()`),
+         * which is the case for changes made by the host, or by chowdsp's parameter attachments.
+         */
+        PushNotifications,
+
+        /** The message thread compares the value of every parameter on each timer callback. */
+        Polling,
+    };
+
     /** Initialises the listeners with a set of parameters. */
-    explicit ParameterListeners (ParamHolder& parameters, int intervalMilliseconds = 10);
+    explicit ParameterListeners (ParamHolder& parameters,
+                                 int intervalMilliseconds = 10,
+                                 ChangeDetectionMode changeDetectionMode = ChangeDetectionMode::Polling);
+
+    /** Destructor */
+    ~ParameterListeners() override;
 
     /**
      * Runs any queued listeners on the audio thread.
@@ -64,9 +85,14 @@ public:
     }
 
 private:
+    void updateChangedBroadcasters();
+    void updateBroadcaster (size_t index);
+    void markParameterChanged (size_t index) noexcept;
     void callMessageThreadBroadcaster (size_t index);
     void callAudioThreadBroadcaster (size_t index);
     void timerCallback() override;
+    void addParameters (ParamHolder& parameters, size_t& index);
+    void removeParameters (size_t startIndex, size_t endIndex);
 
     struct ParamInfo
     {
@@ -74,9 +100,31 @@ private:
         float value = 0.0f;
     };
 
+    struct ParamChangeListener : juce::AudioProcessorParameter::Listener
+    {
+        ParamChangeListener (ParameterListeners& owner, juce::RangedAudioParameter& param, size_t index);
+        ~ParamChangeListener() override;
+        void parameterValueChanged (int, float) override { owner.markParameterChanged (index); }
+        void parameterGestureChanged (int, bool) override {}
+
+        ParameterListeners& owner;
+        juce::RangedAudioParameter& param;
+        const size_t index;
+    };
+
     const size_t totalNumParams;
+    const ChangeDetectionMode mode;
     std::vector<ParamInfo> paramInfoList { totalNumParams };
 
+    // one bit per parameter, set (possibly from the audio thread) when the parameter changes
+    static constexpr size_t bitsPerWord = 64;
+    std::vector<std::atomic<uint64_t>> changedFlags;
+    std::atomic_bool anyParametersChanged { false };
+    std::vector<std::unique_ptr<ParamChangeListener>> paramChangeListeners { totalNumParams };
+
+    // detaches from the parameters if their ParamHolder is destroyed before these listeners
+    std::vector<ScopedCallback> paramHolderDestructionCallbacks;
+
     std::vector<Broadcaster<void()>> messageThreadBroadcasters { totalNumParams };
 
     static constexpr size_t actionSize = 16; // sizeof ([this, i = index] { callMessageThreadBroadcaster (i); })
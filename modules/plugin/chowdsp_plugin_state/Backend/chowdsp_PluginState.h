@@ -18,11 +18,12 @@ public:
     /** Initialises the plugin state with a given set of parameters. */
     void initialise (ParamHolder& parameters,
                      juce::AudioProcessor* processor = nullptr,
-                     juce::UndoManager* um = nullptr)
+                     juce::UndoManager* um = nullptr,
+                     ParameterListeners::ChangeDetectionMode changeDetectionMode = ParameterListeners::ChangeDetectionMode::Polling)
     {
         params = &parameters;
         undoManager = um;
-        listeners.emplace (parameters);
+        listeners.emplace (parameters, 10, changeDetectionMode);
         if (processor != nullptr)
             parameters.connectParametersToProcessor (*processor);
     }
@@ -13,6 +13,9 @@ struct StateValueBase
     virtual void serialize (JSONSerializer::SerializedType&) const {}
     virtual void deserialize (JSONSerializer::DeserializedType) {}
 
+    virtual void serialize (BinarySerializer::SerializedType&) const {}
+    virtual void deserialize (BinarySerializer::DeserializedType) {}
+
     const std::string_view name;
     Broadcaster<void()> changeBroadcaster;
 };
@@ -67,6 +70,18 @@ struct StateValue : StateValueBase
         deserialize<JSONSerializer> (deserial, *this);
     }
 
+    /** Binary Serializer */
+    void serialize (BinarySerializer::SerializedType& serial) const override
+    {
+        serialize<BinarySerializer> (serial, *this);
+    }
+
+    /** Binary Deserializer */
+    void deserialize (BinarySerializer::DeserializedType deserial) override
+    {
+        deserialize<BinarySerializer> (deserial, *this);
+    }
+
     const T defaultValue;
 
 private:
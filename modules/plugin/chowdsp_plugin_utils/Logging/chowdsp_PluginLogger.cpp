@@ -1,5 +1,6 @@
 #include "chowdsp_PluginLogger.h"
 
+#include <cstring>
 #include <utility>
 
 namespace chowdsp
@@ -11,6 +12,7 @@ namespace logger_detail
     const juce::String exitString = "Exiting gracefully...";
     const juce::String crashString = "Plugin crashing!!!";
     const juce::String crashExaminedString = "The crash in this log file is now being examined!";
+    const juce::String audioThreadPrefix = "[Audio Thread] ";
 
     struct LogFileComparator
     {
@@ -95,7 +97,8 @@ PluginLogger::PluginLogger (const juce::String& logFileSubDir, const juce::Strin
 {
 }
 
-PluginLogger::PluginLogger (LoggerParams loggerParams) : params (std::move (loggerParams))
+PluginLogger::PluginLogger (LoggerParams loggerParams) : params (std::move (loggerParams)),
+                                                          audioThreadLogQueue ((size_t) params.audioThreadLogQueueSize)
 {
     using namespace logger_detail;
 
@@ -105,16 +108,124 @@ PluginLogger::PluginLogger (LoggerParams loggerParams) : params (std::move (logg
 
     fileLogger.reset (juce::FileLogger::createDateStampedLogger (
         params.logFileSubDir, params.logFileNameRoot, params.logFileExtension, openString));
-    juce::Logger::setCurrentLogger (fileLogger.get());
+    juce::Logger::setCurrentLogger (&loggerProxy);
 
     juce::SystemStats::setApplicationCrashHandler (signalHandler);
+
+    logWriterThread.startThread();
 }
 
 PluginLogger::~PluginLogger()
 {
+    logWriterThread.stopThread (-1);
+    flush(); // flush any remaining messages
+
     logger_detail::shutdownLogger();
 }
 
+juce::File PluginLogger::getLogFile() const
+{
+    std::lock_guard lock { fileLoggerMutex };
+    return fileLogger->getLogFile();
+}
+
+juce::String PluginLogger::formatLogRecord (const AudioThreadLogRecord& record)
+{
+    const auto formatArgument = [] (const LogArgument& arg)
+    {
+        return std::visit (
+            [] (auto x) -> juce::String
+            {
+                if constexpr (std::is_same_v<decltype (x), bool>)
+                    return x ? "true" : "false";
+                else
+                    return juce::String (x);
+            },
+            arg.value);
+    };
+
+    juce::String result;
+    const auto* formatPtr = record.format != nullptr ? record.format : "";
+
+    size_t argIndex = 0;
+    for (; argIndex < record.numArguments; ++argIndex)
+    {
+        const auto* placeholder = std::strstr (formatPtr, "{}");
+        if (placeholder == nullptr)
+            break;
+
+        result << juce::String::fromUTF8 (formatPtr, (int) (placeholder - formatPtr)) << formatArgument (record.arguments[argIndex]);
+        formatPtr = placeholder + 2;
+    }
+    result << juce::String::fromUTF8 (formatPtr);
+
+    // any leftover arguments get tacked on the end
+    for (; argIndex < record.numArguments; ++argIndex)
+        result << " " << formatArgument (record.arguments[argIndex]);
+
+    return result;
+}
+
+void PluginLogger::LogWriterThread::run()
+{
+    while (! threadShouldExit())
+    {
+        wait (writeIntervalMilliseconds);
+        logger.flush();
+    }
+}
+
+void PluginLogger::flush()
+{
+    std::lock_guard lock { logWriterMutex };
+    writeAudioThreadLogs();
+    rotateLogFileIfNeeded();
+}
+
+void PluginLogger::logToFile (const juce::String& message)
+{
+    std::lock_guard lock { fileLoggerMutex };
+    fileLogger->logMessage (message);
+}
+
+void PluginLogger::writeAudioThreadLogs()
+{
+    using namespace logger_detail;
+
+    // all the messages that are ready get written in one batch
+    juce::StringArray messages;
+    AudioThreadLogRecord record;
+    while (audioThreadLogQueue.try_dequeue (record))
+        messages.add (audioThreadPrefix + "(" + juce::String (record.timeMilliseconds, 3) + " ms) " + formatLogRecord (record));
+
+    if (const auto numDropped = numDroppedLogRecords.exchange (0, std::memory_order_relaxed); numDropped > 0)
+        messages.add (audioThreadPrefix + juce::String (numDropped) + " messages were dropped because the log queue was full!");
+
+    if (messages.isEmpty())
+        return;
+
+    logToFile (messages.joinIntoString (juce::newLine));
+}
+
+void PluginLogger::rotateLogFileIfNeeded()
+{
+    using namespace logger_detail;
+
+    if (params.maxLogFileSizeBytes <= 0 || getLogFile().getSize() < params.maxLogFileSizeBytes)
+        return;
+
+    {
+        // juce::Logger only knows about the logger proxy, so the old file logger
+        // can be safely deleted once it has been swapped out.
+        std::lock_guard lock { fileLoggerMutex };
+        fileLogger.reset (juce::FileLogger::createDateStampedLogger (
+            params.logFileSubDir, params.logFileNameRoot, params.logFileExtension, openString + juce::newLine + "Continued from: " + fileLogger->getLogFile().getFileName()));
+    }
+
+    auto&& logFiles = getLogFilesSorted (params);
+    pruneOldLogFiles (logFiles, params);
+}
+
 void PluginLogger::handleCrashWithSignal (int signal)
 {
     JUCE_BEGIN_IGNORE_WARNINGS_GCC_LIKE ("-Wint-to-void-pointer-cast",
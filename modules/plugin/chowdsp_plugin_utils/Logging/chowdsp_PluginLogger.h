@@ -8,6 +8,14 @@ namespace chowdsp
  * To use this class, create an instance of it in your plugin class,
  * and provide the subdirectory path to use for storing log files.
  * Log files will be stored in `juce::FileLogger::getSystemLogFileFolder().getChildFile (yourPath)`.
+ *
+ * Messages can also be logged from the audio thread with `logFromAudioThread()`.
+ * These messages are stored as fixed-size records in a lock-free queue, and are
+ * formatted and written to the log file on a background thread. For example:
+ * @code
+ * if (! chowdsp::BufferMath::sanitizeBuffer (buffer))
+ *     logger.logFromAudioThread ("Invalid samples detected! Block size: {}", buffer.getNumSamples());
+ * @endcode
  */
 class PluginLogger
 {
@@ -18,6 +26,8 @@ public:
         juce::String logFileNameRoot;
         juce::String logFileExtension = ".log";
         int maxNumLogFiles = 50;
+        juce::int64 maxLogFileSizeBytes = 0; // when the log file gets larger than this, a new log file will be started (0 means no limit)
+        int audioThreadLogQueueSize = 512; // the maximum number of audio thread messages that can be waiting to be written
         std::function<void (const juce::File&)> crashLogAnalysisCallback = [] (const juce::File& logFile)
         { PluginLogger::defaultCrashLogAnalyzer (logFile); };
     };
@@ -26,16 +36,117 @@ public:
     explicit PluginLogger (LoggerParams loggerParams);
     ~PluginLogger();
 
-    [[nodiscard]] const juce::File& getLogFile() const { return fileLogger->getLogFile(); }
+    /** Returns the file that is currently being logged to. */
+    [[nodiscard]] juce::File getLogFile() const;
+
     static void handleCrashWithSignal (int signal);
 
+    /** An argument for an audio thread log message. */
+    struct LogArgument
+    {
+        LogArgument() = default;
+
+        template <typename T, std::enable_if_t<std::is_integral_v<T> && ! std::is_same_v<T, bool>>* = nullptr>
+        LogArgument (T x) : value ((juce::int64) x) // NOLINT(google-explicit-constructor)
+        {
+        }
+
+        template <typename T, std::enable_if_t<std::is_floating_point_v<T>>* = nullptr>
+        LogArgument (T x) : value ((double) x) // NOLINT(google-explicit-constructor)
+        {
+        }
+
+        LogArgument (bool x) : value (x) {} // NOLINT(google-explicit-constructor)
+
+        /** String arguments must be string literals (or otherwise outlive the logger). */
+        LogArgument (const char* x) : value (x) {} // NOLINT(google-explicit-constructor)
+
+        std::variant<juce::int64, double, bool, const char*> value;
+    };
+
+    static constexpr size_t maxNumLogArguments = 6;
+
+    /** A log message from the audio thread, which can be formatted later. */
+    struct AudioThreadLogRecord
+    {
+        const char* format = nullptr;
+        double timeMilliseconds = 0.0;
+        std::array<LogArgument, maxNumLogArguments> arguments {};
+        size_t numArguments = 0;
+    };
+
+    /**
+     * Logs a message from the audio thread, without allocating memory or doing any I/O.
+     *
+     * The format string must be a string literal (or otherwise outlive the logger),
+     * with a `{}` placeholder for each argument. Arguments may be numbers, bools, or
+     * string literals.
+     *
+     * This method should only be called from one thread at a time. Returns false if
+     * the message could not be logged because the queue is full.
+     */
+    template <typename... Args>
+    bool logFromAudioThread (const char* format, Args... args) noexcept
+    {
+        static_assert (sizeof...(Args) <= maxNumLogArguments, "Too many arguments for an audio thread log message!");
+
+        AudioThreadLogRecord record { format, juce::Time::getMillisecondCounterHiRes(), { LogArgument { args }... }, sizeof...(Args) };
+        if (audioThreadLogQueue.try_enqueue (record))
+            return true;
+
+        numDroppedLogRecords.fetch_add (1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /** Formats an audio thread log message. */
+    static juce::String formatLogRecord (const AudioThreadLogRecord& record);
+
+    /**
+     * Writes any pending audio thread messages to the log file, and starts a new log file
+     * if the current one has grown too large. This happens periodically on a background
+     * thread, but can also be called from any thread other than the audio thread.
+     */
+    void flush();
+
 private:
     static void defaultCrashLogAnalyzer (const juce::File& logFile);
 
+    void writeAudioThreadLogs();
+    void rotateLogFileIfNeeded();
+    void logToFile (const juce::String& message);
+
     const LoggerParams params;
 
+    mutable std::mutex fileLoggerMutex;
     std::unique_ptr<juce::FileLogger> fileLogger;
 
+    /**
+     * The logger that is registered with juce::Logger. This forwards messages to the current file logger,
+     * so that the file logger can be swapped out when the log file is rotated, without calling
+     * juce::Logger::setCurrentLogger() while other threads may be logging.
+     */
+    struct LoggerProxy : juce::Logger
+    {
+        explicit LoggerProxy (PluginLogger& pluginLogger) : logger (pluginLogger) {}
+        void logMessage (const juce::String& message) override { logger.logToFile (message); }
+
+        PluginLogger& logger;
+    } loggerProxy { *this };
+
+    std::mutex logWriterMutex; // the audio thread log queue only supports a single consumer
+
+    moodycamel::ReaderWriterQueue<AudioThreadLogRecord> audioThreadLogQueue;
+    std::atomic<int> numDroppedLogRecords { 0 };
+
+    struct LogWriterThread : juce::Thread
+    {
+        explicit LogWriterThread (PluginLogger& pluginLogger) : juce::Thread ("Plugin Logger"), logger (pluginLogger) {}
+        void run() override;
+
+        PluginLogger& logger;
+        static constexpr int writeIntervalMilliseconds = 100;
+    } logWriterThread { *this };
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PluginLogger)
 };
 } // namespace chowdsp
@@ -0,0 +1,178 @@
+#include "chowdsp_ProfilingSession.h"
+
+namespace chowdsp
+{
+ProfilingSession::ProfilingSession (size_t maxTraceEvents, size_t maxDurationsPerZone)
+    : juce::Thread ("Profiling Session"),
+      maxNumTraceEvents (maxTraceEvents),
+      maxNumDurationsPerZone (juce::jmax ((size_t) 1, maxDurationsPerZone))
+{
+    jassert (! profiler.isRecording()); // only one profiling session should be running at a time!
+
+    // throw away any measurements left over from a previous session
+    profiler.collectRecords ([] (size_t, const Profiler::Record&) {});
+
+    numDroppedRecordsAtStart = profiler.getNumDroppedRecords();
+    sessionStartTicks = Profiler::Clock::now().time_since_epoch().count();
+    profiler.setRecording (true);
+
+    startThread();
+}
+
+ProfilingSession::~ProfilingSession()
+{
+    profiler.setRecording (false);
+    stopThread (-1);
+}
+
+void ProfilingSession::run()
+{
+    while (! threadShouldExit())
+    {
+        wait (collectionIntervalMilliseconds);
+        collectRecords();
+    }
+}
+
+void ProfilingSession::collectRecords()
+{
+    std::lock_guard lock { dataMutex };
+    profiler.collectRecords (
+        [this] (size_t threadIndex, const Profiler::Record& record)
+        {
+            const auto durationMicroseconds = Profiler::ticksToMicroseconds (record.endTicks - record.startTicks);
+
+            auto& zoneData = zones[record.zone];
+            zoneData.count++;
+            zoneData.totalMicroseconds += durationMicroseconds;
+            zoneData.maxMicroseconds = juce::jmax (zoneData.maxMicroseconds, durationMicroseconds);
+
+            if (zoneData.recentDurations.size() < maxNumDurationsPerZone)
+            {
+                zoneData.recentDurations.push_back ((float) durationMicroseconds);
+            }
+            else
+            {
+                zoneData.recentDurations[zoneData.recentDurationsIndex] = (float) durationMicroseconds;
+                zoneData.recentDurationsIndex = (zoneData.recentDurationsIndex + 1) % maxNumDurationsPerZone;
+            }
+
+            if (traceEvents.size() < maxNumTraceEvents)
+                traceEvents.push_back ({ record.zone, threadIndex, record.startTicks, record.endTicks });
+            else
+                numDroppedTraceEvents++;
+        });
+}
+
+std::vector<ProfilingSession::ZoneStats> ProfilingSession::getZoneStats()
+{
+    collectRecords();
+
+    std::vector<std::pair<double, ZoneStats>> statsWithTotals;
+    {
+        std::lock_guard lock { dataMutex };
+        statsWithTotals.reserve (zones.size());
+
+        std::vector<float> sortedDurations;
+        for (const auto& [zone, zoneData] : zones)
+        {
+            sortedDurations = zoneData.recentDurations;
+            std::sort (sortedDurations.begin(), sortedDurations.end());
+            const auto getPercentile = [&sortedDurations] (double percentile)
+            {
+                if (sortedDurations.empty())
+                    return 0.0;
+
+                const auto index = (size_t) std::round (percentile * double (sortedDurations.size() - 1));
+                return (double) sortedDurations[index];
+            };
+
+            ZoneStats stats;
+            stats.name = zone->name;
+            stats.file = zone->file;
+            stats.line = zone->line;
+            stats.count = zoneData.count;
+            stats.meanMicroseconds = zoneData.totalMicroseconds / (double) zoneData.count;
+            stats.p50Microseconds = getPercentile (0.5);
+            stats.p90Microseconds = getPercentile (0.9);
+            stats.p99Microseconds = getPercentile (0.99);
+            stats.maxMicroseconds = zoneData.maxMicroseconds;
+            statsWithTotals.emplace_back (zoneData.totalMicroseconds, std::move (stats));
+        }
+    }
+
+    std::sort (statsWithTotals.begin(), statsWithTotals.end(), [] (const auto& s1, const auto& s2)
+               { return s1.first > s2.first; });
+
+    std::vector<ZoneStats> zoneStats;
+    zoneStats.reserve (statsWithTotals.size());
+    for (auto& [total, stats] : statsWithTotals)
+        zoneStats.push_back (std::move (stats));
+    return zoneStats;
+}
+
+json ProfilingSession::getChromeTrace()
+{
+    collectRecords();
+
+    std::lock_guard lock { dataMutex };
+    auto events = json::array();
+
+    std::vector<bool> threadsUsed (Profiler::maxNumThreads, false);
+    for (const auto& event : traceEvents)
+    {
+        threadsUsed[event.threadIndex] = true;
+        events.push_back ({
+            { "name", event.zone->name },
+            { "cat", "dsp" },
+            { "ph", "X" },
+            { "ts", Profiler::ticksToMicroseconds (event.startTicks - sessionStartTicks) },
+            { "dur", Profiler::ticksToMicroseconds (event.endTicks - event.startTicks) },
+            { "pid", 1 },
+            { "tid", event.threadIndex },
+            { "args", { { "file", event.zone->file }, { "line", event.zone->line } } },
+        });
+    }
+
+    for (size_t threadIndex = 0; threadIndex < threadsUsed.size(); ++threadIndex)
+    {
+        if (! threadsUsed[threadIndex])
+            continue;
+
+        events.push_back ({
+            { "name", "thread_name" },
+            { "ph", "M" },
+            { "pid", 1 },
+            { "tid", threadIndex },
+            { "args", { { "name", "Thread " + std::to_string (threadIndex) } } },
+        });
+    }
+
+    return {
+        { "traceEvents", std::move (events) },
+        { "displayTimeUnit", "ns" },
+    };
+}
+
+void ProfilingSession::exportChromeTrace (const juce::File& traceFile)
+{
+    JSONUtils::toFile (getChromeTrace(), traceFile);
+}
+
+void ProfilingSession::clear()
+{
+    collectRecords();
+
+    std::lock_guard lock { dataMutex };
+    zones.clear();
+    traceEvents.clear();
+    numDroppedTraceEvents = 0;
+    numDroppedRecordsAtStart = profiler.getNumDroppedRecords();
+}
+
+uint64_t ProfilingSession::getNumDroppedRecords() const
+{
+    std::lock_guard lock { dataMutex };
+    return profiler.getNumDroppedRecords() - numDroppedRecordsAtStart + numDroppedTraceEvents;
+}
+} // namespace chowdsp
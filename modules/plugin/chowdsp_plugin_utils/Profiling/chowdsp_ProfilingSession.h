@@ -0,0 +1,98 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Records measurements from the profiling zones marked with `CHOWDSP_PROFILE_ZONE()`.
+ *
+ * While the session exists, the `chowdsp::Profiler` will be recording, and the
+ * measurements are collected from each thread's buffer on a background thread.
+ * The session keeps statistics for each zone, and a timeline of every measurement,
+ * which can be exported as a Chrome trace file (and viewed with Perfetto or
+ * `chrome://tracing`).
+ *
+ * Only one profiling session should exist at a time. Remember that the profiling
+ * zones will only be compiled if `CHOWDSP_ENABLE_PROFILING` is enabled!
+ */
+class ProfilingSession : private juce::Thread
+{
+public:
+    /**
+     * Starts a profiling session.
+     *
+     * At most maxNumTraceEvents measurements will be kept for exporting as a
+     * trace, and the percentiles for each zone are computed from the most
+     * recent maxNumDurationsPerZone measurements.
+     */
+    explicit ProfilingSession (size_t maxNumTraceEvents = 1 << 20, size_t maxNumDurationsPerZone = 1 << 14);
+
+    /** Stops the profiling session. */
+    ~ProfilingSession() override;
+
+    /** Timing statistics for one profiling zone. */
+    struct ZoneStats
+    {
+        juce::String name;
+        juce::String file;
+        int line = 0;
+
+        size_t count = 0;
+        double meanMicroseconds = 0.0;
+        double p50Microseconds = 0.0;
+        double p90Microseconds = 0.0;
+        double p99Microseconds = 0.0;
+        double maxMicroseconds = 0.0;
+    };
+
+    /** Returns the timing statistics for each zone, sorted by the total time spent in the zone. */
+    std::vector<ZoneStats> getZoneStats();
+
+    /** Returns the recorded measurements in the Chrome trace event format. */
+    json getChromeTrace();
+
+    /** Writes the recorded measurements to a Chrome trace file. */
+    void exportChromeTrace (const juce::File& traceFile);
+
+    /** Clears all the measurements recorded so far. */
+    void clear();
+
+    /** Returns the number of measurements that have been dropped, either because a thread's buffer was full, or the trace was full. */
+    [[nodiscard]] uint64_t getNumDroppedRecords() const;
+
+private:
+    void run() override;
+    void collectRecords();
+
+    struct ZoneData
+    {
+        size_t count = 0;
+        double totalMicroseconds = 0.0;
+        double maxMicroseconds = 0.0;
+        std::vector<float> recentDurations; // circular buffer of the most recent durations (microseconds)
+        size_t recentDurationsIndex = 0;
+    };
+
+    struct TraceEvent
+    {
+        const Profiler::Zone* zone = nullptr;
+        size_t threadIndex = 0;
+        Profiler::Clock::rep startTicks = 0;
+        Profiler::Clock::rep endTicks = 0;
+    };
+
+    Profiler& profiler = Profiler::getInstance();
+    const size_t maxNumTraceEvents;
+    const size_t maxNumDurationsPerZone;
+
+    mutable std::mutex dataMutex;
+    std::unordered_map<const Profiler::Zone*, ZoneData> zones;
+    std::vector<TraceEvent> traceEvents;
+    uint64_t numDroppedTraceEvents = 0;
+    uint64_t numDroppedRecordsAtStart = 0;
+    Profiler::Clock::rep sessionStartTicks = 0;
+
+    static constexpr int collectionIntervalMilliseconds = 20;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProfilingSession)
+};
+} // namespace chowdsp
@@ -0,0 +1,364 @@
+#include "chowdsp_OfflineRender.h"
+
+namespace chowdsp::OfflineRender
+{
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    int getNumProcessorChannels (const juce::AudioProcessor& processor)
+    {
+        return juce::jmax (processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+    }
+
+    void prepareProcessor (juce::AudioProcessor& processor, const Params& params)
+    {
+        processor.setNonRealtime (true);
+        processor.prepareToPlay (params.sampleRate, params.blockSize);
+    }
+
+    /**
+     * Sets up the processor's input channels in the buffer, when the first numValidChannels
+     * channels of the buffer contain the incoming audio. If the processor has more inputs
+     * than the number of valid channels, the valid channels are repeated. Any other
+     * channels used by the processor are cleared.
+     */
+    void prepareInputChannels (juce::AudioBuffer<float>& buffer, const juce::AudioProcessor& processor, int numValidChannels, int numSamples)
+    {
+        const auto numInputChannels = processor.getTotalNumInputChannels();
+        for (int ch = 0; ch < getNumProcessorChannels (processor); ++ch)
+        {
+            if (ch < numInputChannels && ch < numValidChannels)
+                continue;
+
+            if (ch < numInputChannels && numValidChannels > 0)
+                buffer.copyFrom (ch, 0, buffer, ch % numValidChannels, 0, numSamples);
+            else
+                buffer.clear (ch, 0, numSamples);
+        }
+    }
+
+    /** Processes a block, and returns the processing time in microseconds. */
+    double processBlock (juce::AudioProcessor& processor, juce::AudioBuffer<float>& buffer, int numSamples, juce::MidiBuffer& midi)
+    {
+        juce::AudioBuffer<float> processorBuffer { buffer.getArrayOfWritePointers(), getNumProcessorChannels (processor), numSamples };
+        midi.clear();
+
+        const auto blockStart = Clock::now();
+        processor.processBlock (processorBuffer, midi);
+        return std::chrono::duration<double, std::micro> (Clock::now() - blockStart).count();
+    }
+
+    void computeResults (Results& results, std::vector<double>& blockTimesMicroseconds, int numSamples, const Params& params)
+    {
+        results.blockSize = params.blockSize;
+        results.numBlocks = (int) blockTimesMicroseconds.size();
+        results.audioLengthSeconds = (double) numSamples / params.sampleRate;
+        if (results.renderTimeSeconds > 0.0)
+            results.realTimeFactor = results.audioLengthSeconds / results.renderTimeSeconds;
+
+        if (! blockTimesMicroseconds.empty())
+        {
+            results.meanBlockMicroseconds = std::accumulate (blockTimesMicroseconds.begin(), blockTimesMicroseconds.end(), 0.0)
+                                            / (double) blockTimesMicroseconds.size();
+
+            std::sort (blockTimesMicroseconds.begin(), blockTimesMicroseconds.end());
+            const auto getPercentile = [&blockTimesMicroseconds] (double percentile)
+            {
+                const auto index = (size_t) std::round (percentile * double (blockTimesMicroseconds.size() - 1));
+                return blockTimesMicroseconds[index];
+            };
+
+            results.p50BlockMicroseconds = getPercentile (0.5);
+            results.p90BlockMicroseconds = getPercentile (0.9);
+            results.p99BlockMicroseconds = getPercentile (0.99);
+            results.maxBlockMicroseconds = blockTimesMicroseconds.back();
+        }
+
+        results.checksum = getChecksum (results.output);
+    }
+
+    /** Renders the input through a prepared processor, and appends the block processing times. */
+    juce::AudioBuffer<float> renderBlocks (juce::AudioProcessor& processor,
+                                           const juce::AudioBuffer<float>& input,
+                                           const Params& params,
+                                           std::vector<double>& blockTimesMicroseconds)
+    {
+        const auto numSamples = input.getNumSamples();
+        const auto numOutputChannels = processor.getTotalNumOutputChannels();
+        juce::AudioBuffer<float> output { numOutputChannels, numSamples };
+
+        const auto numInputChannels = juce::jmin (input.getNumChannels(), processor.getTotalNumInputChannels());
+        juce::AudioBuffer<float> blockBuffer { juce::jmax (getNumProcessorChannels (processor), 1), params.blockSize };
+        juce::MidiBuffer midi;
+
+        for (int sampleIndex = 0; sampleIndex < numSamples; sampleIndex += params.blockSize)
+        {
+            const auto blockNumSamples = juce::jmin (params.blockSize, numSamples - sampleIndex);
+            for (int ch = 0; ch < numInputChannels; ++ch)
+                blockBuffer.copyFrom (ch, 0, input, ch, sampleIndex, blockNumSamples);
+            prepareInputChannels (blockBuffer, processor, input.getNumChannels(), blockNumSamples);
+
+            blockTimesMicroseconds.push_back (processBlock (processor, blockBuffer, blockNumSamples, midi));
+
+            for (int ch = 0; ch < numOutputChannels; ++ch)
+                output.copyFrom (ch, sampleIndex, blockBuffer, ch, 0, blockNumSamples);
+        }
+
+        return output;
+    }
+} // namespace
+
+juce::String Results::toString() const
+{
+    return "Rendered " + juce::String (audioLengthSeconds, 2) + " s of audio in "
+           + juce::String (renderTimeSeconds, 3) + " s ("
+           + juce::String (realTimeFactor, 1) + "x real-time)\n"
+           + "Block size " + juce::String (blockSize) + ": " + juce::String (numBlocks) + " blocks, "
+           + "mean " + juce::String (meanBlockMicroseconds, 2) + " us"
+           + " / p50 " + juce::String (p50BlockMicroseconds, 2) + " us"
+           + " / p90 " + juce::String (p90BlockMicroseconds, 2) + " us"
+           + " / p99 " + juce::String (p99BlockMicroseconds, 2) + " us"
+           + " / max " + juce::String (maxBlockMicroseconds, 2) + " us\n"
+           + "Checksum: " + juce::String::toHexString ((juce::int64) checksum);
+}
+
+bool setMainBusChannels (juce::AudioProcessor& processor, int numChannels)
+{
+    const auto channelSet = juce::AudioChannelSet::canonicalChannelSet (numChannels);
+    auto layout = processor.getBusesLayout();
+    if (! layout.inputBuses.isEmpty())
+        layout.inputBuses.getReference (0) = channelSet;
+    if (! layout.outputBuses.isEmpty())
+        layout.outputBuses.getReference (0) = channelSet;
+
+    return processor.setBusesLayout (layout);
+}
+
+Results render (juce::AudioProcessor& processor, const juce::AudioBuffer<float>& input, const Params& params)
+{
+    jassert (params.blockSize > 0 && params.sampleRate > 0.0);
+    prepareProcessor (processor, params);
+
+    Results results;
+    std::vector<double> blockTimesMicroseconds;
+    blockTimesMicroseconds.reserve ((size_t) (input.getNumSamples() / params.blockSize + 1));
+
+    const auto renderStart = Clock::now();
+    results.output = renderBlocks (processor, input, params, blockTimesMicroseconds);
+    results.renderTimeSeconds = std::chrono::duration<double> (Clock::now() - renderStart).count();
+
+    processor.releaseResources();
+
+    computeResults (results, blockTimesMicroseconds, input.getNumSamples(), params);
+    return results;
+}
+
+Results renderChannelGroups (const ProcessorFactory& createProcessor,
+                             const juce::AudioBuffer<float>& input,
+                             int channelsPerGroup,
+                             const Params& params,
+                             int numThreads)
+{
+    jassert (params.blockSize > 0 && params.sampleRate > 0.0 && channelsPerGroup > 0);
+
+    const auto numChannels = input.getNumChannels();
+    const auto numSamples = input.getNumSamples();
+    const auto numGroups = (size_t) ((numChannels + channelsPerGroup - 1) / channelsPerGroup);
+    if (numThreads <= 0)
+        numThreads = juce::SystemStats::getNumCpus();
+    numThreads = juce::jlimit (1, juce::jmax ((int) numGroups, 1), numThreads);
+
+    // the processors are created and configured on this thread, since that might not be thread-safe
+    std::vector<std::unique_ptr<juce::AudioProcessor>> processors (numGroups);
+    for (auto [groupIndex, processor] : enumerate (processors))
+    {
+        processor = createProcessor();
+        setMainBusChannels (*processor, juce::jmin (channelsPerGroup, numChannels - (int) groupIndex * channelsPerGroup));
+    }
+
+    Results results;
+    results.output.setSize (numChannels, numSamples);
+    auto* const* outputData = results.output.getArrayOfWritePointers();
+    std::vector<std::vector<double>> groupBlockTimesMicroseconds (numGroups);
+
+    // each group writes to its own channels of the output, so the groups can all be rendered at the same time
+    std::atomic<size_t> nextGroupIndex { 0 };
+    const auto renderGroups = [&]
+    {
+        for (auto groupIndex = nextGroupIndex.fetch_add (1); groupIndex < numGroups; groupIndex = nextGroupIndex.fetch_add (1))
+        {
+            const auto startChannel = (int) groupIndex * channelsPerGroup;
+            const auto groupNumChannels = juce::jmin (channelsPerGroup, numChannels - startChannel);
+
+            juce::AudioBuffer<float> groupInput { groupNumChannels, numSamples };
+            for (int ch = 0; ch < groupNumChannels; ++ch)
+                groupInput.copyFrom (ch, 0, input, startChannel + ch, 0, numSamples);
+
+            auto& processor = processors[groupIndex];
+            prepareProcessor (*processor, params);
+
+            auto& blockTimesMicroseconds = groupBlockTimesMicroseconds[groupIndex];
+            blockTimesMicroseconds.reserve ((size_t) (numSamples / params.blockSize + 1));
+            const auto groupOutput = renderBlocks (*processor, groupInput, params, blockTimesMicroseconds);
+            processor->releaseResources();
+
+            for (int ch = 0; ch < groupNumChannels; ++ch)
+            {
+                if (ch < groupOutput.getNumChannels())
+                    juce::FloatVectorOperations::copy (outputData[startChannel + ch], groupOutput.getReadPointer (ch), numSamples);
+                else
+                    juce::FloatVectorOperations::clear (outputData[startChannel + ch], numSamples);
+            }
+        }
+    };
+
+    const auto renderStart = Clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve ((size_t) numThreads - 1);
+    for (int i = 1; i < numThreads; ++i)
+        threads.emplace_back (renderGroups);
+    renderGroups();
+    for (auto& thread : threads)
+        thread.join();
+    results.renderTimeSeconds = std::chrono::duration<double> (Clock::now() - renderStart).count();
+
+    std::vector<double> blockTimesMicroseconds;
+    for (auto& groupBlockTimes : groupBlockTimesMicroseconds)
+        blockTimesMicroseconds.insert (blockTimesMicroseconds.end(), groupBlockTimes.begin(), groupBlockTimes.end());
+
+    computeResults (results, blockTimesMicroseconds, numSamples, params);
+    return results;
+}
+
+Results renderChain (const std::vector<juce::AudioProcessor*>& stages,
+                     const juce::AudioBuffer<float>& input,
+                     const Params& params,
+                     int pipelineDepth)
+{
+    jassert (params.blockSize > 0 && params.sampleRate > 0.0 && ! stages.empty());
+
+    const auto numSamples = input.getNumSamples();
+    const auto numStages = stages.size();
+    const auto numBlocks = (numSamples + params.blockSize - 1) / params.blockSize;
+
+    int numPipelineChannels = juce::jmax (input.getNumChannels(), 1);
+    for (auto* stage : stages)
+    {
+        prepareProcessor (*stage, params);
+        numPipelineChannels = juce::jmax (numPipelineChannels, getNumProcessorChannels (*stage));
+    }
+
+    // Blocks are passed from stage to stage through single-producer/single-consumer queues. The
+    // last stage returns the blocks to the first stage, so there are never more than pipelineDepth
+    // blocks in the pipeline.
+    struct PipelineBlock
+    {
+        juce::AudioBuffer<float> buffer;
+        int startSample = 0;
+        int numSamples = 0;
+    };
+    using BlockQueue = moodycamel::BlockingReaderWriterQueue<PipelineBlock*>;
+
+    pipelineDepth = juce::jmax (pipelineDepth, 1);
+    std::vector<PipelineBlock> pipelineBlocks ((size_t) pipelineDepth);
+    BlockQueue freeBlocks { (size_t) pipelineDepth };
+    for (auto& block : pipelineBlocks)
+    {
+        block.buffer.setSize (numPipelineChannels, params.blockSize);
+        freeBlocks.enqueue (&block);
+    }
+
+    std::vector<std::unique_ptr<BlockQueue>> stageQueues; // stageQueues[i] holds the blocks processed by stage i
+    for (size_t i = 0; i + 1 < numStages; ++i)
+        stageQueues.push_back (std::make_unique<BlockQueue> ((size_t) pipelineDepth));
+
+    Results results;
+    results.output.setSize (stages.back()->getTotalNumOutputChannels(), numSamples);
+    std::vector<std::vector<double>> stageBlockTimesMicroseconds (numStages);
+
+    const auto runStage = [&] (size_t stageIndex)
+    {
+        auto& processor = *stages[stageIndex];
+        const auto isFirstStage = stageIndex == 0;
+        const auto isLastStage = stageIndex == numStages - 1;
+        auto& blockTimesMicroseconds = stageBlockTimesMicroseconds[stageIndex];
+        blockTimesMicroseconds.reserve ((size_t) numBlocks);
+        juce::MidiBuffer midi;
+
+        for (int blockIndex = 0; blockIndex < numBlocks; ++blockIndex)
+        {
+            PipelineBlock* block = nullptr;
+            int numValidChannels = 0;
+            if (isFirstStage)
+            {
+                freeBlocks.wait_dequeue (block);
+                block->startSample = blockIndex * params.blockSize;
+                block->numSamples = juce::jmin (params.blockSize, numSamples - block->startSample);
+
+                numValidChannels = input.getNumChannels();
+                for (int ch = 0; ch < juce::jmin (numValidChannels, processor.getTotalNumInputChannels()); ++ch)
+                    block->buffer.copyFrom (ch, 0, input, ch, block->startSample, block->numSamples);
+            }
+            else
+            {
+                stageQueues[stageIndex - 1]->wait_dequeue (block);
+                numValidChannels = stages[stageIndex - 1]->getTotalNumOutputChannels();
+            }
+
+            prepareInputChannels (block->buffer, processor, numValidChannels, block->numSamples);
+            blockTimesMicroseconds.push_back (processBlock (processor, block->buffer, block->numSamples, midi));
+
+            if (isLastStage)
+            {
+                for (int ch = 0; ch < results.output.getNumChannels(); ++ch)
+                    results.output.copyFrom (ch, block->startSample, block->buffer, ch, 0, block->numSamples);
+                freeBlocks.enqueue (block);
+            }
+            else
+            {
+                stageQueues[stageIndex]->enqueue (block);
+            }
+        }
+    };
+
+    const auto renderStart = Clock::now();
+    std::vector<std::thread> threads;
+    threads.reserve (numStages);
+    for (size_t stageIndex = 0; stageIndex < numStages; ++stageIndex)
+        threads.emplace_back (runStage, stageIndex);
+    for (auto& thread : threads)
+        thread.join();
+    results.renderTimeSeconds = std::chrono::duration<double> (Clock::now() - renderStart).count();
+
+    for (auto* stage : stages)
+        stage->releaseResources();
+
+    std::vector<double> blockTimesMicroseconds;
+    for (auto& stageBlockTimes : stageBlockTimesMicroseconds)
+        blockTimesMicroseconds.insert (blockTimesMicroseconds.end(), stageBlockTimes.begin(), stageBlockTimes.end());
+
+    computeResults (results, blockTimesMicroseconds, numSamples, params);
+    return results;
+}
+
+uint64_t getChecksum (const juce::AudioBuffer<float>& buffer) noexcept
+{
+    // 64-bit FNV-1a hash of the raw sample data
+    static constexpr uint64_t fnvOffsetBasis = 0xcbf29ce484222325;
+    static constexpr uint64_t fnvPrime = 0x100000001b3;
+
+    auto hash = fnvOffsetBasis;
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        const auto* bytes = reinterpret_cast<const uint8_t*> (buffer.getReadPointer (ch));
+        for (size_t i = 0; i < (size_t) buffer.getNumSamples() * sizeof (float); ++i)
+        {
+            hash ^= bytes[i];
+            hash *= fnvPrime;
+        }
+    }
+
+    return hash;
+}
+} // namespace chowdsp::OfflineRender
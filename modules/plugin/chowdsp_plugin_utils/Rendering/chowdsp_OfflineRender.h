@@ -0,0 +1,96 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Utilities for rendering audio through a processor offline (faster than real-time),
+ * for example, to measure the processor's throughput, or to check that the processor's
+ * output hasn't changed.
+ */
+namespace OfflineRender
+{
+    /** Parameters for an offline render. */
+    struct Params
+    {
+        double sampleRate = 48000.0;
+        int blockSize = 512;
+    };
+
+    /** The output and timing measurements from an offline render. */
+    struct Results
+    {
+        juce::AudioBuffer<float> output;
+        int blockSize = 0;
+        int numBlocks = 0;
+
+        double audioLengthSeconds = 0.0;
+        double renderTimeSeconds = 0.0;
+        double realTimeFactor = 0.0; // audio length / render time
+
+        // processing time per block
+        double meanBlockMicroseconds = 0.0;
+        double p50BlockMicroseconds = 0.0;
+        double p90BlockMicroseconds = 0.0;
+        double p99BlockMicroseconds = 0.0;
+        double maxBlockMicroseconds = 0.0;
+
+        uint64_t checksum = 0;
+
+        /** Returns a human-readable summary of the results. */
+        [[nodiscard]] juce::String toString() const;
+    };
+
+    /**
+     * Tries to set the main input and output buses of the processor to have
+     * the given number of channels. Returns false if the processor doesn't
+     * support that layout, in which case the current layout is kept.
+     */
+    bool setMainBusChannels (juce::AudioProcessor& processor, int numChannels);
+
+    /**
+     * Renders the input buffer through the processor, in blocks of params.blockSize.
+     *
+     * The processor is prepared (in non-realtime mode) before rendering, and its
+     * resources are released afterwards. If the processor has more input channels
+     * than the input buffer, the input channels are repeated. The output buffer
+     * will have the same number of channels as the processor's outputs.
+     */
+    Results render (juce::AudioProcessor& processor, const juce::AudioBuffer<float>& input, const Params& params);
+
+    /** Creates a new instance of a processor. */
+    using ProcessorFactory = std::function<std::unique_ptr<juce::AudioProcessor>()>;
+
+    /**
+     * Renders groups of channelsPerGroup input channels (e.g. the stereo pairs of a
+     * multi-channel file) through separate instances of a processor, in parallel.
+     *
+     * Each group is rendered as in `render()`, with its own processor instance, on one
+     * of numThreads threads (or one per CPU, if numThreads is 0). The output will have
+     * the same number of channels as the input, and will be bit-identical to rendering
+     * each group serially. The block timing results include the blocks from every group.
+     */
+    Results renderChannelGroups (const ProcessorFactory& createProcessor,
+                                 const juce::AudioBuffer<float>& input,
+                                 int channelsPerGroup,
+                                 const Params& params,
+                                 int numThreads = 0);
+
+    /**
+     * Renders the input buffer through a chain of processors, with each stage of the chain
+     * running on its own thread. While one stage is processing a block, the previous stage
+     * can be processing the next block.
+     *
+     * Blocks are passed between the stages through a bounded pipeline of pipelineDepth
+     * buffers. Each stage is prepared and processed as in `render()`, so the output will
+     * be bit-identical to rendering the input through each stage serially. The block
+     * timing results include the blocks from every stage.
+     */
+    Results renderChain (const std::vector<juce::AudioProcessor*>& stages,
+                         const juce::AudioBuffer<float>& input,
+                         const Params& params,
+                         int pipelineDepth = 4);
+
+    /** Returns a checksum of the buffer's samples, for checking if two renders are bit-identical. */
+    uint64_t getChecksum (const juce::AudioBuffer<float>& buffer) noexcept;
+} // namespace OfflineRender
+} // namespace chowdsp
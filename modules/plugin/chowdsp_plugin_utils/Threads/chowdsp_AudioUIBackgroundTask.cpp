@@ -54,6 +54,25 @@ namespace detail
         if (timeSliceThreadToUse->getNumClients() == 0)
             timeSliceThreadToUse->stopThread (-1);
     }
+
+    void ScheduledBackgroundTask::setSchedulerToUse (BackgroundTaskScheduler* newSchedulerToUse)
+    {
+        const auto wasRunning = isBackgroundTaskRunning();
+        if (wasRunning)
+            stopTask();
+
+        schedulerToUse = newSchedulerToUse;
+
+        if (wasRunning)
+            startTask();
+    }
+
+    void ScheduledBackgroundTask::startTask()
+    {
+        // run the task once when it starts, even if no new data has arrived yet
+        markNewData();
+        schedulerToUse->addTask (*this);
+    }
 } // namespace detail
 #endif // DOXYGEN
 
@@ -83,20 +102,22 @@ void AudioUIBackgroundTask<BackgroundTaskType>::prepare (double sampleRate, int
     waitMilliseconds = -1;
     prepareTask (sampleRate, samplesPerBlock, requestedDataSize, waitMilliseconds);
 
-    data.clear();
+    // one ring buffer per channel, since samples may be pushed one channel at a time
+    data = std::vector<AudioRingBuffer<float>> ((size_t) numChannels);
     const auto dataSize = 2 * juce::jmax (requestedDataSize, samplesPerBlock);
-    for (int ch = 0; ch < numChannels; ++ch)
-        data.emplace_back (dataSize);
+    for (auto& channelData : data)
+        channelData.prepare (1, dataSize, AudioRingBuffer<float>::OverrunPolicy::OverwriteOldest, requestedDataSize);
 
-    latestData.setSize (numChannels, requestedDataSize);
+    latestRegions.clear();
+    latestRegions.reserve ((size_t) numChannels);
+    latestDataPointers = std::vector<float*> ((size_t) numChannels, nullptr);
 
     if (waitMilliseconds < 0)
     {
-        auto refreshTime = (double) data[0].size() / sampleRate; // time (seconds) for the whole buffer to be refreshed
+        auto refreshTime = (double) data[0].getCapacity() / sampleRate; // time (seconds) for the whole buffer to be refreshed
         waitMilliseconds = int (1000.0 * refreshTime);
     }
 
-    writePosition = 0;
     isPrepared = true;
 
     if (shouldBeRunning)
@@ -106,27 +127,29 @@ void AudioUIBackgroundTask<BackgroundTaskType>::prepare (double sampleRate, int
 template <typename BackgroundTaskType>
 void AudioUIBackgroundTask<BackgroundTaskType>::reset()
 {
-    for (auto& buffer : data)
-        buffer.clear();
+    for (auto& channelData : data)
+        channelData.reset();
 
-    writePosition = 0;
     resetTask();
 }
 
 template <typename BackgroundTaskType>
 void AudioUIBackgroundTask<BackgroundTaskType>::pushSamples (int channel, const float* samples, int numSamples)
 {
-    data[(size_t) channel].push (samples, numSamples);
-    writePosition = data[(size_t) channel].getWritePointer();
+    data[(size_t) channel].push ({ &samples, 1, numSamples });
+
+    if constexpr (std::is_same_v<BackgroundTaskType, detail::ScheduledBackgroundTask>)
+        this->notifyNewData();
 }
 
 template <typename BackgroundTaskType>
 void AudioUIBackgroundTask<BackgroundTaskType>::pushSamples (const juce::AudioBuffer<float>& buffer)
 {
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
-        data[(size_t) ch].push (buffer.getReadPointer (ch), buffer.getNumSamples());
+        data[(size_t) ch].push ({ buffer, 0, buffer.getNumSamples(), ch, 1 });
 
-    writePosition = data[0].getWritePointer();
+    if constexpr (std::is_same_v<BackgroundTaskType, detail::ScheduledBackgroundTask>)
+        this->notifyNewData();
 }
 
 template <typename BackgroundTaskType>
@@ -150,16 +173,36 @@ void AudioUIBackgroundTask<BackgroundTaskType>::setShouldBeRunning (bool shouldR
 template <typename BackgroundTaskType>
 int AudioUIBackgroundTask<BackgroundTaskType>::runTaskOnBackgroundThread()
 {
-    latestData.clear();
-    const auto dataOffset = writePosition - requestedDataSize;
-    for (int ch = 0; ch < latestData.getNumChannels(); ++ch)
-        latestData.copyFrom (ch, 0, data[(size_t) ch].data (dataOffset), requestedDataSize);
+    // The ring buffers keep the latest data contiguous, so the task can read it in place.
+    // The ring buffers hold twice as much data as the task needs, so the producer would
+    // need to push a lot of data while the task is running before the data is overwritten.
+    // If that does happen, the task is run again with the latest data, so that the task
+    // results don't come from partially overwritten data.
+    static constexpr int maxNumAttempts = 3;
+    for (int attempt = 0; attempt < maxNumAttempts; ++attempt)
+    {
+        latestRegions.clear();
+        for (auto [ch, channelPointer] : enumerate (latestDataPointers))
+        {
+            const auto& region = latestRegions.emplace_back (data[ch].getLatestRegion (requestedDataSize));
+            channelPointer = const_cast<float*> (region.block1.getReadPointer (0)); // NOLINT(cppcoreguidelines-pro-type-const-cast): runTask() only gets const access to the data
+        }
+
+        latestData.setDataToReferTo (latestDataPointers.data(), (int) latestDataPointers.size(), requestedDataSize);
+        runTask (latestData);
 
-    runTask (latestData);
+        bool isDataIntact = true;
+        for (auto [ch, region] : enumerate (latestRegions))
+            isDataIntact = isDataIntact && data[ch].isRegionValid (region);
+
+        if (isDataIntact)
+            break;
+    }
 
     return waitMilliseconds;
 }
 
 template class AudioUIBackgroundTask<detail::SingleThreadBackgroundTask>;
 template class AudioUIBackgroundTask<detail::TimeSliceBackgroundTask>;
+template class AudioUIBackgroundTask<detail::ScheduledBackgroundTask>;
 } // namespace chowdsp
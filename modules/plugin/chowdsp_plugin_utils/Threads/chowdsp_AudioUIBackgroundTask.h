@@ -41,6 +41,26 @@ namespace detail
         juce::SharedResourcePointer<TimeSliceThread> sharedTimeSliceThread;
         juce::TimeSliceThread* timeSliceThreadToUse = sharedTimeSliceThread;
     };
+
+    /** BackgroundTaskScheduler::Task that is compatible with AudioUIBackgroundTask */
+    struct ScheduledBackgroundTask : private BackgroundTaskScheduler::Task
+    {
+        explicit ScheduledBackgroundTask (const juce::String&) {}
+
+        void setSchedulerToUse (BackgroundTaskScheduler* newSchedulerToUse);
+
+        int runScheduledTask() override { return runTaskOnBackgroundThread(); }
+        virtual int runTaskOnBackgroundThread() = 0;
+
+        [[nodiscard]] bool isBackgroundTaskRunning() const { return schedulerToUse->containsTask (*this); }
+        void startTask();
+        void stopTask() { schedulerToUse->removeTask (*this); }
+        void notifyNewData() noexcept { markNewData(); }
+
+    private:
+        juce::SharedResourcePointer<BackgroundTaskScheduler> sharedScheduler;
+        BackgroundTaskScheduler* schedulerToUse = sharedScheduler;
+    };
 } // namespace detail
 #endif // DOXYGEN
 
@@ -51,8 +71,9 @@ namespace detail
  *
  * The common scenario here is when you need a meter, or other audio visualization.
  *
- * It is recommended to use a type alias, like `SingleThreadAudioUIBackgroundTask`
- * or `TimeSliceAudioUIBackgroundTask` instead of using this class directly.
+ * It is recommended to use a type alias, like `SingleThreadAudioUIBackgroundTask`,
+ * `TimeSliceAudioUIBackgroundTask`, or `ScheduledAudioUIBackgroundTask` instead of
+ * using this class directly.
  */
 template <typename BackgroundTaskType>
 class AudioUIBackgroundTask : private BackgroundTaskType
@@ -90,6 +111,14 @@ public:
         detail::TimeSliceBackgroundTask::setTimeSliceThreadToUse (thread);
     }
 
+    /** Assigns this task to use a custom BackgroundTaskScheduler, rather than the default shared scheduler */
+    template <typename Type = BackgroundTaskType>
+    typename std::enable_if_t<std::is_same_v<Type, detail::ScheduledBackgroundTask>, void>
+        setSchedulerToUse (BackgroundTaskScheduler* scheduler)
+    {
+        detail::ScheduledBackgroundTask::setSchedulerToUse (scheduler);
+    }
+
 protected:
     /**
      * Override this method to prepare the child class.
@@ -114,8 +143,7 @@ protected:
 private:
     int runTaskOnBackgroundThread() override;
 
-    std::vector<DoubleBuffer<float>> data;
-    std::atomic<int> writePosition { 0 };
+    std::vector<AudioRingBuffer<float>> data;
 
     std::atomic_bool shouldBeRunning { false };
     std::atomic_bool isPrepared { false };
@@ -123,6 +151,8 @@ private:
     int requestedDataSize = 0;
     int waitMilliseconds = 0;
 
+    std::vector<AudioRingBuffer<float>::ReadRegion> latestRegions;
+    std::vector<float*> latestDataPointers;
     juce::AudioBuffer<float> latestData;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AudioUIBackgroundTask)
@@ -133,4 +163,10 @@ using SingleThreadAudioUIBackgroundTask = AudioUIBackgroundTask<detail::SingleTh
 
 /** AudioUIBackgroundTask that will run in a time slice */
 using TimeSliceAudioUIBackgroundTask = AudioUIBackgroundTask<detail::TimeSliceBackgroundTask>;
+
+/**
+ * AudioUIBackgroundTask that will run on a shared BackgroundTaskScheduler.
+ * The task will only run when new samples have been pushed since the last run.
+ */
+using ScheduledAudioUIBackgroundTask = AudioUIBackgroundTask<detail::ScheduledBackgroundTask>;
 } // namespace chowdsp
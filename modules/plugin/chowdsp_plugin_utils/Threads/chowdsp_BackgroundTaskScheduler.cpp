@@ -0,0 +1,211 @@
+#include "chowdsp_BackgroundTaskScheduler.h"
+
+namespace chowdsp
+{
+BackgroundTaskScheduler::Worker::Worker (BackgroundTaskScheduler& taskScheduler, size_t workerIndex)
+    : juce::Thread ("Background Task Worker " + juce::String (workerIndex)),
+      scheduler (taskScheduler),
+      index (workerIndex)
+{
+}
+
+void BackgroundTaskScheduler::Worker::run()
+{
+    while (! threadShouldExit())
+    {
+        Task* task = nullptr;
+        if (auto runLock = scheduler.popTask (index, task); task != nullptr)
+        {
+            scheduler.runTask (*task);
+            continue;
+        }
+
+        scheduler.dispatchTasksOrWait (index);
+    }
+}
+
+BackgroundTaskScheduler::BackgroundTaskScheduler (int numWorkers)
+{
+    jassert (numWorkers > 0);
+    for (size_t i = 0; i < (size_t) juce::jmax (1, numWorkers); ++i)
+        workers.push_back (std::make_unique<Worker> (*this, i));
+
+    for (auto& worker : workers)
+        worker->startThread();
+}
+
+BackgroundTaskScheduler::~BackgroundTaskScheduler()
+{
+    jassert (tasks.empty()); // all the tasks should be removed before the scheduler is destroyed!
+
+    for (auto& worker : workers)
+        worker->signalThreadShouldExit();
+
+    {
+        std::lock_guard lock { tasksMutex };
+        shouldExit = true;
+    }
+    tasksCondition.notify_all();
+
+    for (auto& worker : workers)
+        worker->stopThread (-1);
+}
+
+int BackgroundTaskScheduler::getDefaultNumWorkers()
+{
+    // visualizers shouldn't compete with the audio threads for too many cores
+    return juce::jlimit (1, 4, juce::SystemStats::getNumCpus() / 2);
+}
+
+void BackgroundTaskScheduler::addTask (Task& task)
+{
+    {
+        std::lock_guard lock { tasksMutex };
+        if (std::find (tasks.begin(), tasks.end(), &task) != tasks.end())
+            return;
+
+        task.isQueued = false;
+        task.deadlineTicks = Clock::now().time_since_epoch().count();
+        tasks.push_back (&task);
+    }
+
+    tasksCondition.notify_all();
+}
+
+void BackgroundTaskScheduler::removeTask (Task& task)
+{
+    {
+        std::lock_guard lock { tasksMutex };
+        VectorHelpers::erase_if (tasks, [&task] (const Task* t)
+                                 { return t == &task; });
+    }
+
+    for (auto& worker : workers)
+    {
+        std::lock_guard lock { worker->queueMutex };
+        const auto taskIter = std::find (worker->queue.begin(), worker->queue.end(), &task);
+        if (taskIter != worker->queue.end())
+        {
+            worker->queue.erase (taskIter);
+            numQueuedTasks.fetch_sub (1);
+        }
+    }
+
+    // if a worker has already taken the task, wait for it to finish running
+    std::lock_guard runLock { task.runMutex };
+}
+
+bool BackgroundTaskScheduler::containsTask (const Task& task) const
+{
+    std::lock_guard lock { tasksMutex };
+    return std::find (tasks.begin(), tasks.end(), &task) != tasks.end();
+}
+
+std::unique_lock<std::mutex> BackgroundTaskScheduler::popTask (size_t workerIndex, Task*& task)
+{
+    // take the next task from this worker's queue, or steal the last task from another worker's queue
+    for (size_t i = 0; i < workers.size(); ++i)
+    {
+        const auto isOwnQueue = i == 0;
+        auto& worker = *workers[(workerIndex + i) % workers.size()];
+
+        std::lock_guard lock { worker.queueMutex };
+        if (worker.queue.empty())
+            continue;
+
+        if (isOwnQueue)
+        {
+            task = worker.queue.front();
+            worker.queue.pop_front();
+        }
+        else
+        {
+            task = worker.queue.back();
+            worker.queue.pop_back();
+        }
+        numQueuedTasks.fetch_sub (1);
+
+        // lock the task before releasing the queue, so that removeTask() can wait for the task to finish
+        return std::unique_lock { task->runMutex };
+    }
+
+    return {};
+}
+
+void BackgroundTaskScheduler::runTask (Task& task)
+{
+    // any data that arrives while the task is running will be handled next time
+    task.hasNewData.store (false, std::memory_order_relaxed);
+    const auto waitMilliseconds = task.runScheduledTask();
+
+    // late tasks are not run again to "catch up", so missed frames are just skipped
+    const auto nextDeadline = Clock::now() + std::chrono::milliseconds (juce::jmax (0, waitMilliseconds));
+    task.deadlineTicks.store (nextDeadline.time_since_epoch().count(), std::memory_order_relaxed);
+    task.isQueued.store (false, std::memory_order_release);
+}
+
+BackgroundTaskScheduler::Clock::time_point BackgroundTaskScheduler::getDeadline (const Task& task)
+{
+    return Clock::time_point { Clock::duration { task.deadlineTicks.load (std::memory_order_relaxed) } };
+}
+
+void BackgroundTaskScheduler::dispatchTasksOrWait (size_t workerIndex)
+{
+    std::unique_lock lock { tasksMutex };
+    if (shouldExit || numQueuedTasks.load() > 0)
+        return;
+
+    const auto now = Clock::now();
+    auto nextCheckTime = Clock::time_point::max();
+
+    dueTasks.clear();
+    for (auto* task : tasks)
+    {
+        if (task->isQueued.load (std::memory_order_acquire))
+            continue;
+
+        const auto deadline = getDeadline (*task);
+        if (deadline > now)
+        {
+            nextCheckTime = juce::jmin (nextCheckTime, deadline);
+            continue;
+        }
+
+        if (task->hasNewData.load (std::memory_order_acquire))
+            dueTasks.push_back (task);
+        else
+            nextCheckTime = juce::jmin (nextCheckTime, now + pollInterval);
+    }
+
+    if (dueTasks.empty())
+    {
+        // the worker loop will check for new tasks after any wake-up, so we don't need a predicate here
+        if (nextCheckTime == Clock::time_point::max())
+            tasksCondition.wait (lock);
+        else
+            tasksCondition.wait_until (lock, nextCheckTime);
+        return;
+    }
+
+    // the most overdue tasks go first, spread across all the workers
+    std::sort (dueTasks.begin(), dueTasks.end(), [] (const Task* t1, const Task* t2)
+               { return t1->deadlineTicks.load() < t2->deadlineTicks.load(); });
+
+    for (auto [taskIndex, task] : enumerate (dueTasks))
+    {
+        auto& worker = *workers[(workerIndex + taskIndex) % workers.size()];
+        task->isQueued = true;
+
+        std::lock_guard queueLock { worker.queueMutex };
+        worker.queue.push_back (task);
+        numQueuedTasks.fetch_add (1);
+    }
+
+    const auto numDueTasks = dueTasks.size();
+    lock.unlock();
+
+    // this worker will pick up the first task, the others need to be woken up
+    if (numDueTasks > 1)
+        tasksCondition.notify_all();
+}
+} // namespace chowdsp
@@ -0,0 +1,100 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Runs periodic background tasks (e.g. audio meters and visualizers)
+ * on a fixed number of worker threads.
+ *
+ * A task is only run when it has new data to process, and at most once
+ * per refresh interval. If a task receives several blocks of new data
+ * between runs, it is only run once. The tasks that are due are run in
+ * order of their deadlines, and idle workers will steal queued tasks
+ * from busy workers.
+ *
+ * Usually this class is used via `ScheduledAudioUIBackgroundTask`, where
+ * all the tasks in the process share a single scheduler.
+ */
+class BackgroundTaskScheduler
+{
+public:
+    /** A task that can be run by the scheduler. */
+    class Task
+    {
+    public:
+        Task() = default;
+        virtual ~Task() = default;
+
+        /** Runs the task, and returns the number of milliseconds to wait before the task is run again. */
+        virtual int runScheduledTask() = 0;
+
+        /** Call this when the task has new data to process. This is safe to call from the audio thread. */
+        void markNewData() noexcept { hasNewData.store (true, std::memory_order_release); }
+
+    private:
+        friend class BackgroundTaskScheduler;
+
+        std::atomic_bool hasNewData { false };
+        std::atomic_bool isQueued { false };
+        std::atomic<std::chrono::steady_clock::rep> deadlineTicks { 0 };
+        std::mutex runMutex;
+
+        JUCE_DECLARE_NON_COPYABLE (Task)
+    };
+
+    /** Creates a scheduler with a fixed number of worker threads. */
+    explicit BackgroundTaskScheduler (int numWorkers = getDefaultNumWorkers());
+
+    /** Destructor. All tasks should be removed before the scheduler is destroyed! */
+    ~BackgroundTaskScheduler();
+
+    /** Adds a task to the scheduler. The task will be run as soon as it has some new data. */
+    void addTask (Task& task);
+
+    /** Removes a task from the scheduler. When this method returns, the task is guaranteed not to be running. */
+    void removeTask (Task& task);
+
+    /** Returns true if the task has been added to this scheduler. */
+    [[nodiscard]] bool containsTask (const Task& task) const;
+
+    /** Returns the number of worker threads used by the scheduler. */
+    [[nodiscard]] int getNumWorkers() const noexcept { return (int) workers.size(); }
+
+    /** Returns the default number of worker threads, based on the number of CPU cores. */
+    static int getDefaultNumWorkers();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Worker : juce::Thread
+    {
+        Worker (BackgroundTaskScheduler& scheduler, size_t workerIndex);
+        void run() override;
+
+        BackgroundTaskScheduler& scheduler;
+        const size_t index;
+
+        std::mutex queueMutex;
+        std::deque<Task*> queue;
+    };
+
+    std::unique_lock<std::mutex> popTask (size_t workerIndex, Task*& task);
+    void runTask (Task& task);
+    static Clock::time_point getDeadline (const Task& task);
+    void dispatchTasksOrWait (size_t workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    mutable std::mutex tasksMutex;
+    std::condition_variable tasksCondition;
+    std::vector<Task*> tasks;
+    std::vector<Task*> dueTasks;
+    std::atomic<size_t> numQueuedTasks { 0 };
+    bool shouldExit = false;
+
+    // how often to check for new data, for tasks that are past their deadline
+    static constexpr auto pollInterval = std::chrono::milliseconds (5);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BackgroundTaskScheduler)
+};
+} // namespace chowdsp
@@ -4,6 +4,9 @@
 #include "Files/chowdsp_FileListener.cpp"
 #include "Files/chowdsp_TweaksFile.cpp"
 #include "Logging/chowdsp_PluginLogger.cpp"
+#include "Profiling/chowdsp_ProfilingSession.cpp"
+#include "Rendering/chowdsp_OfflineRender.cpp"
 #include "SharedUtils/chowdsp_GlobalPluginSettings.cpp"
 #include "State/chowdsp_UIState.cpp"
+#include "Threads/chowdsp_BackgroundTaskScheduler.cpp"
 #include "Threads/chowdsp_AudioUIBackgroundTask.cpp"
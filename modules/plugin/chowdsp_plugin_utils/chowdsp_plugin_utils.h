@@ -9,7 +9,8 @@
     name:          ChowDSP Plugin Utilities
     description:   Utilities for creating ChowDSP plugins
     dependencies:  juce_events, juce_audio_basics, juce_audio_formats,
-                   juce_gui_basics, juce_audio_processors, chowdsp_core, chowdsp_json, chowdsp_listeners
+                   juce_gui_basics, juce_audio_processors, chowdsp_core, chowdsp_json, chowdsp_listeners,
+                   chowdsp_dsp_data_structures
 
     website:       https://ccrma.stanford.edu/~jatin/chowdsp
     license:       GPLv3
@@ -31,7 +32,11 @@
 #endif
 
 // STL includes
+#include <condition_variable>
+#include <deque>
+#include <numeric>
 #include <unordered_map>
+#include <variant>
 
 // JUCE includes
 #include <juce_events/juce_events.h>
@@ -42,6 +47,7 @@
 #include <chowdsp_core/chowdsp_core.h>
 #include <chowdsp_json/chowdsp_json.h>
 #include <chowdsp_listeners/chowdsp_listeners.h>
+#include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
 
 #include "Files/chowdsp_AudioFileSaveLoadHelper.h"
 #include "Files/chowdsp_FileListener.h"
@@ -49,11 +55,16 @@
 
 #include "Logging/chowdsp_PluginLogger.h"
 
+#include "Profiling/chowdsp_ProfilingSession.h"
+
+#include "Rendering/chowdsp_OfflineRender.h"
+
 #include "SharedUtils/chowdsp_GlobalPluginSettings.h"
 #include "SharedUtils/chowdsp_LNFAllocator.h"
 
 #include "State/chowdsp_UIState.h"
 
+#include "Threads/chowdsp_BackgroundTaskScheduler.h"
 #include "Threads/chowdsp_AudioUIBackgroundTask.h"
 
 #include "Threads/chowdsp_DeferredMainThreadAction.h"
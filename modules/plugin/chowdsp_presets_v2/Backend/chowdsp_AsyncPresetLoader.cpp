@@ -0,0 +1,106 @@
+#include "chowdsp_AsyncPresetLoader.h"
+
+namespace chowdsp
+{
+AsyncPresetLoader::AsyncPresetLoader (PresetLoadedCallback&& onPresetLoaded)
+    : juce::Thread ("Async Preset Loader"),
+      callback (std::move (onPresetLoaded))
+{
+}
+
+AsyncPresetLoader::~AsyncPresetLoader()
+{
+    stop();
+}
+
+void AsyncPresetLoader::loadPreset (const Preset& preset)
+{
+    if (preset.isStateLoaded())
+    {
+        // nothing to load, so we can skip the background thread
+        cancel();
+        callback (preset);
+        return;
+    }
+
+    Preset presetCopy { preset };
+    {
+        std::lock_guard lock { requestMutex };
+        pendingRequest.emplace (Request { std::move (presetCopy), ++latestRequestID });
+        loadedState.reset();
+    }
+    requestedPreset = &preset;
+
+    if (! isThreadRunning())
+        startThread();
+    notify();
+}
+
+void AsyncPresetLoader::cancel()
+{
+    {
+        std::lock_guard lock { requestMutex };
+        pendingRequest.reset();
+        loadedState.reset();
+        ++latestRequestID;
+    }
+
+    cancelPendingUpdate();
+    requestedPreset = nullptr;
+}
+
+void AsyncPresetLoader::stop()
+{
+    cancel();
+    signalThreadShouldExit();
+    notify();
+    stopThread (-1);
+}
+
+void AsyncPresetLoader::run()
+{
+    while (! threadShouldExit())
+    {
+        std::optional<Request> request;
+        {
+            std::lock_guard lock { requestMutex };
+            std::swap (request, pendingRequest);
+        }
+
+        if (! request.has_value())
+        {
+            wait (-1);
+            continue;
+        }
+
+        auto state = request->preset.getState();
+
+        {
+            std::lock_guard lock { requestMutex };
+            if (request->requestID != latestRequestID)
+                continue; // a newer preset has been requested, so this state is no longer needed
+
+            loadedState.emplace (LoadedState { std::move (state), request->requestID });
+        }
+        triggerAsyncUpdate();
+    }
+}
+
+void AsyncPresetLoader::handleAsyncUpdate()
+{
+    std::optional<LoadedState> result;
+    {
+        std::lock_guard lock { requestMutex };
+        std::swap (result, loadedState);
+        if (result.has_value() && result->requestID != latestRequestID)
+            return;
+    }
+
+    if (! result.has_value() || requestedPreset == nullptr)
+        return;
+
+    const auto& preset = *std::exchange (requestedPreset, nullptr);
+    preset.setLoadedState (std::move (result->state));
+    callback (preset);
+}
+} // namespace chowdsp
@@ -0,0 +1,75 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Loads the state of lazily-loaded presets on a background thread.
+ *
+ * Only the most recently requested preset is loaded: if a new preset is
+ * requested while another preset is still loading (e.g. when the user is
+ * quickly browsing through presets), the older request is discarded.
+ */
+class AsyncPresetLoader : private juce::Thread,
+                          private juce::AsyncUpdater
+{
+public:
+    /** Called on the message thread, once the preset state is ready. */
+    using PresetLoadedCallback = std::function<void (const Preset&)>;
+
+    /** Creates a preset loader with a callback for when the preset state has been loaded. */
+    explicit AsyncPresetLoader (PresetLoadedCallback&& onPresetLoaded);
+
+    /** The destructor will cancel any load that is in progress. */
+    ~AsyncPresetLoader() override;
+
+    /**
+     * Loads the preset state on the background thread, and then calls
+     * the callback on the message thread. If the preset state has already
+     * been loaded, the callback will be called immediately.
+     *
+     * The preset must not be deleted or moved until the callback has
+     * been called, or the request has been cancelled.
+     */
+    void loadPreset (const Preset& preset);
+
+    /** Cancels the current request (if any). */
+    void cancel();
+
+    /**
+     * Cancels the current request (if any), and waits for the background thread to stop.
+     * The thread will be restarted by the next call to loadPreset().
+     */
+    void stop();
+
+    /** Returns true if a preset is currently being loaded. */
+    [[nodiscard]] bool isLoading() const noexcept { return requestedPreset != nullptr; }
+
+private:
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    PresetLoadedCallback callback;
+
+    // the preset being loaded (only accessed from the message thread)
+    const Preset* requestedPreset = nullptr;
+
+    struct Request
+    {
+        Preset preset; // a copy of the requested preset, so that the background thread can load the state safely
+        uint64_t requestID;
+    };
+
+    struct LoadedState
+    {
+        nlohmann::json state;
+        uint64_t requestID;
+    };
+
+    std::mutex requestMutex;
+    std::optional<Request> pendingRequest {};
+    std::optional<LoadedState> loadedState {};
+    uint64_t latestRequestID = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AsyncPresetLoader)
+};
+} // namespace chowdsp
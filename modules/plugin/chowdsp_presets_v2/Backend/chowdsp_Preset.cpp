@@ -34,6 +34,21 @@ Preset::Preset (const void* presetData, size_t presetDataSize) // NOSONAR
                     "binary data");
 }
 
+Preset::Preset (const juce::String& pName,
+                const juce::String& pVendor,
+                const juce::String& pCategory,
+                const Version& pVersion,
+                const juce::File& pFile,
+                std::function<nlohmann::json()>&& pStateLoader)
+    : name (pName),
+      vendor (pVendor),
+      category (pCategory),
+      version (pVersion),
+      stateLoader (std::move (pStateLoader)),
+      file (pFile)
+{
+}
+
 template <typename JSONGetType>
 void Preset::initialiseSafe (JSONGetType jsonGetter, const juce::String& source)
 {
@@ -78,6 +93,37 @@ void Preset::initialise (const nlohmann::json& presetJson)
     state = presetJson.at (stateTag);
 }
 
+const nlohmann::json& Preset::getState() const
+{
+    if (stateLoader != nullptr)
+    {
+        const auto loader = std::move (stateLoader);
+        stateLoader = nullptr;
+
+        try
+        {
+            state = loader();
+        }
+        catch (const std::exception& exception) // NOSONAR
+        {
+            juce::Logger::writeToLog ("Error loading preset state for " + name + ": " + juce::String { exception.what() });
+            jassertfalse;
+            state = {};
+        }
+    }
+
+    return state;
+}
+
+void Preset::setLoadedState (nlohmann::json&& loadedState) const
+{
+    if (stateLoader == nullptr)
+        return;
+
+    stateLoader = nullptr;
+    state = std::move (loadedState);
+}
+
 nlohmann::json Preset::toJson() const
 {
     if (! isValid())
@@ -93,7 +139,7 @@ nlohmann::json Preset::toJson() const
             { categoryTag, category },
             { versionTag, version.getVersionString() },
             { fileTag, file.getFullPathName() },
-            { stateTag, state },
+            { stateTag, getState() },
     };
 }
 
@@ -112,22 +158,24 @@ void Preset::toFile (const juce::File& presetFile)
 
 bool Preset::isValid() const
 {
-    return ! state.is_null();
+    // presets with a lazily-loaded state are assumed to be valid until the state is loaded
+    return stateLoader != nullptr || ! state.is_null();
 }
 
-bool Preset::operator== (const Preset& other) const noexcept
+bool Preset::operator== (const Preset& other) const
 {
-    if (state.is_null() || other.state.is_null())
+    if (! isValid() || ! other.isValid())
         return false;
 
+    // compare the state last, so that lazily-loaded states are only loaded if needed
     return name == other.name
            && vendor == other.vendor
            && category == other.category
            && version == other.version
-           && state == other.state;
+           && getState() == other.getState();
 }
 
-bool Preset::operator!= (const Preset& other) const noexcept
+bool Preset::operator!= (const Preset& other) const
 {
     return ! (*this == other);
 }
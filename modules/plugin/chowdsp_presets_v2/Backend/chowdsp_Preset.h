@@ -24,6 +24,20 @@ public:
     /** Create a preset from BinaryData */
     Preset (const void* presetData, size_t presetDataSize);
 
+    /**
+     * Create a preset from the preset info, without loading the preset state.
+     * The state will be loaded with the stateLoader, the first time it is needed.
+     *
+     * Note that loading the state is not thread-safe, so the state should only
+     * be accessed from one thread (usually the message thread).
+     */
+    Preset (const juce::String& name,
+            const juce::String& vendor,
+            const juce::String& category,
+            const Version& version,
+            const juce::File& file,
+            std::function<nlohmann::json()>&& stateLoader);
+
     Preset (const Preset&) = default;
     Preset& operator= (const Preset&) = default;
     Preset (Preset&&) noexcept = default;
@@ -56,17 +70,28 @@ public:
      */
     [[nodiscard]] juce::File getPresetFile() const noexcept { return file; }
 
-    /** Returns the preset state */
-    [[nodiscard]] const auto& getState() const noexcept { return state; }
+    /** Returns the preset state, loading it first if needed. */
+    [[nodiscard]] const nlohmann::json& getState() const;
+
+    /** Returns true if the preset state has been loaded, or was never loaded lazily. */
+    [[nodiscard]] bool isStateLoaded() const noexcept { return stateLoader == nullptr; }
+
+    /**
+     * Sets the state of a lazily-loaded preset, if the state has not been loaded yet.
+     * This can be used to hand over a state that was loaded from a copy of this
+     * preset on another thread (see AsyncPresetLoader).
+     */
+    void setLoadedState (nlohmann::json&& loadedState) const;
 
     /**
      * Returns true if the two presets are equivalent.
-     * Note that this compares the entire preset state.
+     * Note that this compares the entire preset state, so the states
+     * of lazily-loaded presets may be loaded from their files.
      */
-    bool operator== (const Preset& other) const noexcept;
+    bool operator== (const Preset& other) const;
 
     /** Returns true if the two presets are NOT equivalent. */
-    bool operator!= (const Preset& other) const noexcept;
+    bool operator!= (const Preset& other) const;
 
     static constexpr std::string_view presetTag { "preset" };
     static constexpr std::string_view nameTag { "name" };
@@ -93,7 +118,8 @@ private:
 #endif
     Version version { versionString };
 
-    nlohmann::json state {};
+    mutable nlohmann::json state {};
+    mutable std::function<nlohmann::json()> stateLoader = nullptr;
 
     juce::File file {};
 
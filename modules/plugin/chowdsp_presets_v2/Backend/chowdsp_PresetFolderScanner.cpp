@@ -0,0 +1,181 @@
+#include "chowdsp_PresetFolderScanner.h"
+
+namespace chowdsp
+{
+PresetFolderScanner::PresetFolderScanner (const juce::String& presetFileExtension)
+    : juce::Thread ("Preset Folder Scanner"),
+      fileExtension (presetFileExtension)
+{
+}
+
+PresetFolderScanner::~PresetFolderScanner()
+{
+    cancelScan();
+}
+
+juce::File PresetFolderScanner::getIndexFile (const juce::File& folder)
+{
+    return folder.getChildFile (".chowdsp_preset_index");
+}
+
+Preset PresetFolderScanner::createLazyPreset (const PresetIndex::Entry& entry) const
+{
+    juce::File presetFile { entry.path };
+    return Preset {
+        entry.name,
+        entry.vendor,
+        entry.category,
+        Version { entry.version },
+        presetFile,
+        [presetLoader = loader, presetFile]
+        {
+            return presetLoader (presetFile).getState();
+        }
+    };
+}
+
+template <typename BatchCallback>
+void PresetFolderScanner::scan (const juce::File& folder, size_t scanBatchSize, BatchCallback&& onBatch)
+{
+    const auto indexFile = getIndexFile (folder);
+    PresetIndex oldIndex;
+    oldIndex.loadFromFile (indexFile);
+
+    PresetIndex newIndex;
+    bool indexNeedsSaving = false;
+
+    const auto isBackgroundScan = juce::Thread::getCurrentThread() == this;
+
+    std::vector<Preset> batch;
+    for (const auto& entry : juce::RangedDirectoryIterator (folder, true, "*" + fileExtension, juce::File::findFiles))
+    {
+        if (isBackgroundScan && threadShouldExit())
+            return;
+
+        const auto& file = entry.getFile();
+        if (file.getFileExtension() != fileExtension)
+            continue;
+
+        const auto modificationTime = entry.getModificationTime().toMilliseconds();
+        const auto fileSize = entry.getFileSize();
+        if (const auto* indexEntry = oldIndex.findEntry (file, modificationTime, fileSize))
+        {
+            batch.push_back (createLazyPreset (*indexEntry));
+            newIndex.addEntry (PresetIndex::Entry { *indexEntry });
+        }
+        else
+        {
+            // new or modified preset, so we need to parse the file
+            const auto preset = loader (file);
+            if (! preset.isValid())
+                continue;
+
+            auto newEntry = PresetIndex::createEntry (file, modificationTime, fileSize, preset);
+            batch.push_back (createLazyPreset (newEntry));
+            newIndex.addEntry (std::move (newEntry));
+            indexNeedsSaving = true;
+        }
+
+        if (batch.size() >= scanBatchSize)
+        {
+            onBatch (std::move (batch));
+            batch = {};
+        }
+    }
+
+    if (! batch.empty())
+        onBatch (std::move (batch));
+
+    // presets that have been removed need to be cleared from the index as well
+    if (indexNeedsSaving || newIndex.size() != oldIndex.size())
+        newIndex.saveToFile (indexFile);
+}
+
+std::vector<Preset> PresetFolderScanner::scanFolder (const juce::File& folder, PresetLoader&& presetLoader)
+{
+    jassert (! isThreadRunning()); // can't do a synchronous scan while a background scan is running!
+
+    loader = std::move (presetLoader);
+    std::vector<Preset> presets;
+    scan (folder,
+          std::numeric_limits<size_t>::max(),
+          [&presets] (std::vector<Preset>&& batch)
+          { presets = std::move (batch); });
+    return presets;
+}
+
+void PresetFolderScanner::scanFolderAsync (const juce::File& folder,
+                                           PresetLoader&& presetLoader,
+                                           std::function<void (std::vector<Preset>&&)>&& onPresetsFound,
+                                           std::function<void()>&& onScanFinished)
+{
+    cancelScan();
+
+    folderToScan = folder;
+    loader = std::move (presetLoader);
+    presetsFoundCallback = std::move (onPresetsFound);
+    scanFinishedCallback = std::move (onScanFinished);
+    scanIsComplete = false;
+    scanInProgress = true;
+
+    startThread();
+}
+
+void PresetFolderScanner::cancelScan()
+{
+    stopThread (-1);
+    cancelPendingUpdate();
+
+    std::lock_guard lock { pendingBatchesMutex };
+    pendingBatches.clear();
+    scanIsComplete = false;
+    scanInProgress = false;
+}
+
+void PresetFolderScanner::run()
+{
+    scan (folderToScan,
+          batchSize,
+          [this] (std::vector<Preset>&& batch)
+          {
+              {
+                  std::lock_guard lock { pendingBatchesMutex };
+                  pendingBatches.push_back (std::move (batch));
+              }
+              triggerAsyncUpdate();
+          });
+
+    if (threadShouldExit())
+        return;
+
+    {
+        std::lock_guard lock { pendingBatchesMutex };
+        scanIsComplete = true;
+    }
+    triggerAsyncUpdate();
+}
+
+void PresetFolderScanner::handleAsyncUpdate()
+{
+    std::vector<std::vector<Preset>> batches;
+    bool isComplete;
+    {
+        std::lock_guard lock { pendingBatchesMutex };
+        std::swap (batches, pendingBatches);
+        isComplete = std::exchange (scanIsComplete, false);
+    }
+
+    for (auto& batch : batches)
+    {
+        if (presetsFoundCallback != nullptr)
+            presetsFoundCallback (std::move (batch));
+    }
+
+    if (isComplete)
+    {
+        scanInProgress = false;
+        if (scanFinishedCallback != nullptr)
+            scanFinishedCallback();
+    }
+}
+} // namespace chowdsp
@@ -0,0 +1,85 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * Scans a folder (and sub-folders) for preset files.
+ *
+ * The info for each preset is cached in a PresetIndex, which is stored
+ * in the preset folder, so that only new or modified preset files need
+ * to be parsed. The presets returned by the scanner don't load their
+ * state until it is needed (i.e. when the preset is selected).
+ *
+ * Scanning can be done synchronously, or on a background thread, in which
+ * case the presets are delivered to the message thread in batches.
+ */
+class PresetFolderScanner : private juce::Thread,
+                            private juce::AsyncUpdater
+{
+public:
+    /**
+     * Method used to load a preset from a file. This may be called from the background thread,
+     * and will be copied into the lazily-loaded presets, so it should not refer to any objects
+     * that may be destroyed before the presets.
+     */
+    using PresetLoader = std::function<Preset (const juce::File&)>;
+
+    /** Creates a scanner for preset files with the given file extension. */
+    explicit PresetFolderScanner (const juce::String& presetFileExtension);
+
+    /** The destructor will cancel any scan that is in progress. */
+    ~PresetFolderScanner() override;
+
+    /** Scans a folder for presets, on the calling thread. */
+    std::vector<Preset> scanFolder (const juce::File& folder, PresetLoader&& presetLoader);
+
+    /**
+     * Scans a folder for presets on a background thread.
+     *
+     * As the presets are found, they will be passed to `onPresetsFound`
+     * on the message thread, in batches of batchSize presets. When the scan
+     * is complete, `onScanFinished` will be called on the message thread.
+     *
+     * Starting a new scan will cancel any scan that is in progress.
+     */
+    void scanFolderAsync (const juce::File& folder,
+                          PresetLoader&& presetLoader,
+                          std::function<void (std::vector<Preset>&&)>&& onPresetsFound,
+                          std::function<void()>&& onScanFinished = nullptr);
+
+    /** Cancels the current background scan, and discards any presets that have not been delivered yet. */
+    void cancelScan();
+
+    /** Returns true if a background scan is in progress. */
+    [[nodiscard]] bool isScanning() const noexcept { return scanInProgress; }
+
+    /** Returns the file used to store the index for a preset folder. */
+    [[nodiscard]] static juce::File getIndexFile (const juce::File& folder);
+
+    /** The number of presets to deliver in each batch, during a background scan. */
+    size_t batchSize = 256;
+
+private:
+    void run() override;
+    void handleAsyncUpdate() override;
+
+    template <typename BatchCallback>
+    void scan (const juce::File& folder, size_t scanBatchSize, BatchCallback&& onBatch);
+
+    Preset createLazyPreset (const PresetIndex::Entry& entry) const;
+
+    const juce::String fileExtension;
+    PresetLoader loader;
+
+    juce::File folderToScan {};
+    std::function<void (std::vector<Preset>&&)> presetsFoundCallback = nullptr;
+    std::function<void()> scanFinishedCallback = nullptr;
+
+    std::mutex pendingBatchesMutex;
+    std::vector<std::vector<Preset>> pendingBatches;
+    bool scanIsComplete = false;
+    std::atomic_bool scanInProgress { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetFolderScanner)
+};
+} // namespace chowdsp
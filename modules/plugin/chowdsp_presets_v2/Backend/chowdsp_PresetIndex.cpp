@@ -0,0 +1,106 @@
+#include "chowdsp_PresetIndex.h"
+
+namespace chowdsp
+{
+namespace PresetIndexTags
+{
+    static constexpr std::string_view indexVersionTag { "index_version" };
+    static constexpr std::string_view entriesTag { "entries" };
+    static constexpr std::string_view pathTag { "path" };
+    static constexpr std::string_view modificationTimeTag { "mod_time" };
+    static constexpr std::string_view fileSizeTag { "size" };
+} // namespace PresetIndexTags
+
+bool PresetIndex::loadFromFile (const juce::File& indexFile)
+{
+    entries.clear();
+    if (! indexFile.existsAsFile())
+        return false;
+
+    try
+    {
+        const auto indexJson = JSONUtils::fromFile (indexFile);
+        if (indexJson.value (PresetIndexTags::indexVersionTag, 0) != indexFormatVersion)
+            return false;
+
+        for (const auto& entryJson : indexJson.at (PresetIndexTags::entriesTag))
+        {
+            addEntry ({
+                entryJson.at (PresetIndexTags::pathTag).get<juce::String>(),
+                entryJson.at (PresetIndexTags::modificationTimeTag).get<juce::int64>(),
+                entryJson.at (PresetIndexTags::fileSizeTag).get<juce::int64>(),
+                entryJson.at (Preset::nameTag).get<juce::String>(),
+                entryJson.at (Preset::vendorTag).get<juce::String>(),
+                entryJson.at (Preset::categoryTag).get<juce::String>(),
+                entryJson.at (Preset::versionTag).get<juce::String>(),
+            });
+        }
+    }
+    catch (const std::exception& exception) // NOSONAR
+    {
+        // the index is just a cache, so if it's corrupted we can re-build it from scratch
+        juce::Logger::writeToLog ("Error loading preset index from " + indexFile.getFullPathName() + ": " + juce::String { exception.what() });
+        entries.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void PresetIndex::saveToFile (const juce::File& indexFile) const
+{
+    const auto indexFolder = indexFile.getParentDirectory();
+    if (! indexFolder.isDirectory() || ! indexFolder.hasWriteAccess())
+        return;
+
+    auto entriesJson = nlohmann::json::array();
+    for (const auto& [_, entry] : entries)
+    {
+        entriesJson.push_back ({
+            { PresetIndexTags::pathTag, entry.path },
+            { PresetIndexTags::modificationTimeTag, entry.modificationTime },
+            { PresetIndexTags::fileSizeTag, entry.fileSize },
+            { Preset::nameTag, entry.name },
+            { Preset::vendorTag, entry.vendor },
+            { Preset::categoryTag, entry.category },
+            { Preset::versionTag, entry.version },
+        });
+    }
+
+    JSONUtils::toFile ({ { PresetIndexTags::indexVersionTag, indexFormatVersion },
+                         { PresetIndexTags::entriesTag, std::move (entriesJson) } },
+                       indexFile);
+}
+
+const PresetIndex::Entry* PresetIndex::findEntry (const juce::File& presetFile, juce::int64 modificationTime, juce::int64 fileSize) const
+{
+    const auto entryIter = entries.find (presetFile.getFullPathName());
+    if (entryIter == entries.end())
+        return nullptr;
+
+    const auto& entry = entryIter->second;
+    if (entry.modificationTime != modificationTime || entry.fileSize != fileSize)
+        return nullptr;
+
+    return &entry;
+}
+
+void PresetIndex::addEntry (Entry&& entry)
+{
+    auto path = entry.path;
+    entries.insert_or_assign (std::move (path), std::move (entry));
+}
+
+PresetIndex::Entry PresetIndex::createEntry (const juce::File& presetFile, juce::int64 modificationTime, juce::int64 fileSize, const Preset& preset)
+{
+    return {
+        presetFile.getFullPathName(),
+        modificationTime,
+        fileSize,
+        preset.getName(),
+        preset.getVendor(),
+        preset.getCategory(),
+        preset.getVersion().getVersionString(),
+    };
+}
+} // namespace chowdsp
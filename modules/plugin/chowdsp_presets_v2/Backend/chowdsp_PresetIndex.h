@@ -0,0 +1,62 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * A cache of the info for a folder of preset files, which can be saved to disk,
+ * so that presets which have not changed don't need to be re-parsed when the
+ * folder is scanned again.
+ *
+ * Presets are considered unchanged if their modification time and size
+ * match the values stored in the index.
+ */
+class PresetIndex
+{
+public:
+    /** The cached info for a single preset file. */
+    struct Entry
+    {
+        juce::String path;
+        juce::int64 modificationTime = 0;
+        juce::int64 fileSize = 0;
+
+        juce::String name;
+        juce::String vendor;
+        juce::String category;
+        juce::String version;
+    };
+
+    PresetIndex() = default;
+
+    /** Loads the index from a file, returning false if the file could not be loaded. */
+    bool loadFromFile (const juce::File& indexFile);
+
+    /** Saves the index to a file. */
+    void saveToFile (const juce::File& indexFile) const;
+
+    /**
+     * Returns the entry for a preset file, or nullptr if the file is not in the
+     * index, or if the file has been modified since it was added to the index.
+     */
+    [[nodiscard]] const Entry* findEntry (const juce::File& presetFile, juce::int64 modificationTime, juce::int64 fileSize) const;
+
+    /** Adds an entry to the index, replacing any existing entry for the same file. */
+    void addEntry (Entry&& entry);
+
+    /** Creates an index entry from a preset that has been loaded from a file. */
+    static Entry createEntry (const juce::File& presetFile, juce::int64 modificationTime, juce::int64 fileSize, const Preset& preset);
+
+    /** Returns the number of entries in the index. */
+    [[nodiscard]] size_t size() const noexcept { return entries.size(); }
+
+    /** Removes all the entries from the index. */
+    void clear() { entries.clear(); }
+
+    static constexpr int indexFormatVersion = 1;
+
+private:
+    std::unordered_map<juce::String, Entry> entries;
+
+    JUCE_LEAK_DETECTOR (PresetIndex)
+};
+} // namespace chowdsp
@@ -38,6 +38,7 @@ void PresetManager::initializeListeners (ParamHolder& params, ParameterListeners
 
                     juce::ScopedValueSetter svs { areWeInTheMidstOfAPresetChange, true };
 
+                    presetAboutToChangeBroadcaster();
                     loadPresetState (currentPreset->getState()); // @TODO: could this throw?
                     pluginState.getParameterListeners().updateBroadcastersFromMessageThread();
                     isPresetDirty.set (false);
@@ -106,6 +107,12 @@ void PresetManager::loadPreset (const Preset& preset)
         });
 }
 
+void PresetManager::loadPresetAsync (const Preset& preset)
+{
+    jassert (juce::MessageManager::existsAndIsCurrentThread()); // presets should be loaded asynchronously from the message thread!
+    asyncPresetLoader.loadPreset (preset);
+}
+
 bool PresetManager::isPresetAgnosticParameter (const juce::RangedAudioParameter& param) const
 {
     return std::find_if (
@@ -147,29 +154,44 @@ void PresetManager::loadPresetState (const nlohmann::json& state)
         .doForAllParameters (
             [this, &state] (auto& param, size_t)
             {
+                using ParamType = std::decay_t<decltype (param)>;
+
                 if (isPresetAgnosticParameter (param))
                     return;
 
-                if (state.contains (param.paramID.toStdString()))
+                // only set the parameters that are changing, so the host and listeners
+                // don't get notified about every parameter for every preset change
+                const auto paramStateIter = state.find (param.paramID.toStdString());
+                if (paramStateIter != state.end())
                 {
-                    ParameterTypeHelpers::setValue (state[param.paramID.toStdString()], param);
+                    const auto newValue = paramStateIter->template get<ParameterTypeHelpers::ParameterElementType<ParamType>>();
+                    if (newValue != ParameterTypeHelpers::getValue (param))
+                        ParameterTypeHelpers::setValue (newValue, param);
                     return;
                 }
 
-                ParameterTypeHelpers::resetParameter (param);
+                if (param.getValue() != param.getDefaultValue())
+                    ParameterTypeHelpers::resetParameter (param);
             });
 }
 
 void PresetManager::addPresets (std::vector<Preset>&& presets, bool areFactoryPresets)
 {
-    for (auto& preset : std::move (presets))
+    // inserting presets can move the presets that are already in the tree
+    asyncPresetLoader.cancel();
+
+    VectorHelpers::erase_if (presets, [] (const Preset& preset)
+                             { return ! preset.isValid(); });
+
+    if (areFactoryPresets)
     {
-        if (preset.isValid())
-        {
-            const auto& justAddedPreset = presetTree.insertPreset (std::move (preset));
-            if (areFactoryPresets)
-                factoryPresets.emplace_back (&justAddedPreset);
-        }
+        for (auto& preset : std::move (presets))
+            factoryPresets.emplace_back (&presetTree.insertPreset (std::move (preset)));
+    }
+    else
+    {
+        // user preset libraries can be large, so it's faster to insert them all at once
+        presetTree.insertPresets (std::move (presets));
     }
 
     presetListUpdatedBroadcaster();
@@ -227,13 +249,16 @@ bool PresetManager::isFactoryPreset (const Preset& preset) const
     return std::find (factoryPresets.begin(), factoryPresets.end(), &preset) != factoryPresets.end();
 }
 
-void PresetManager::setUserPresetPath (const juce::File& file)
+void PresetManager::setUserPresetPath (const juce::File& file, bool loadPresetsAsync)
 {
     if (file == juce::File())
         return;
 
     userPresetPath = file;
-    loadUserPresetsFromFolder (file);
+    if (loadPresetsAsync)
+        loadUserPresetsFromFolderAsync (file);
+    else
+        loadUserPresetsFromFolder (file);
 }
 
 juce::File PresetManager::getUserPresetPath() const
@@ -241,28 +266,59 @@ juce::File PresetManager::getUserPresetPath() const
     return userPresetPath;
 }
 
-Preset PresetManager::loadUserPresetFromFile (const juce::File& file)
+PresetFolderScanner::PresetLoader PresetManager::getUserPresetLoader() const
+{
+    return [] (const juce::File& file)
+    { return Preset { file }; };
+}
+
+void PresetManager::removeUserPresets()
 {
-    return Preset { file };
+    // the current preset might be about to be deleted, so let's hold onto a copy of it
+    if (currentPreset != nullptr && ! isFactoryPreset (*currentPreset))
+        currentPreset.assumeOwnership();
+
+    asyncPresetLoader.cancel();
+    presetTree.removePresets ([this] (const Preset& preset)
+                              { return ! isFactoryPreset (preset); });
 }
 
 void PresetManager::loadUserPresetsFromFolder (const juce::File& file)
 {
     jassert (file != juce::File {}); // can't load a non-existent folder!
 
-    std::vector<Preset> presets;
-    for (const auto& f : file.findChildFiles (juce::File::findFiles, true))
+    if (shouldLoadUserPresetsAsync)
     {
-        if (f.getFileExtension() != presetFileExt)
-            continue;
-
-        presets.push_back (loadUserPresetFromFile (f));
+        scanUserPresetsFolderAsync (file);
+        return;
     }
 
-    // delete old user presets
-    presetTree.removePresets ([this] (const Preset& preset)
-                              { return ! isFactoryPreset (preset); });
+    userPresetScanner.cancelScan();
+    auto presets = userPresetScanner.scanFolder (file, getUserPresetLoader());
 
+    removeUserPresets();
     addPresets (std::move (presets), false);
+    userPresetsLoadedBroadcaster();
+}
+
+void PresetManager::loadUserPresetsFromFolderAsync (const juce::File& file)
+{
+    // go through loadUserPresetsFromFolder(), in case it has been overridden
+    juce::ScopedValueSetter svs { shouldLoadUserPresetsAsync, true };
+    loadUserPresetsFromFolder (file);
+}
+
+void PresetManager::scanUserPresetsFolderAsync (const juce::File& file)
+{
+    removeUserPresets();
+    presetListUpdatedBroadcaster();
+
+    userPresetScanner.scanFolderAsync (
+        file,
+        getUserPresetLoader(),
+        [this] (std::vector<Preset>&& presets)
+        { addPresets (std::move (presets), false); },
+        [this]
+        { userPresetsLoadedBroadcaster(); });
 }
 } // namespace chowdsp
@@ -17,7 +17,8 @@ public:
           pluginState (state),
           presetAgnosticParameters (std::move (presetAgnosticParams)),
           presetTree (&currentPreset, std::move (insertionHelper)),
-          presetFileExt (presetFileExtension)
+          presetFileExt (presetFileExtension),
+          userPresetScanner (presetFileExt)
     {
         jassert (presetFileExt[0] == '.'); // invalid file extension!
         state.nonParams.addStateValues ({ &currentPreset, &isPresetDirty });
@@ -29,6 +30,19 @@ public:
     /** Loads a preset by reference. */
     void loadPreset (const Preset& preset);
 
+    /**
+     * Loads a preset by reference, loading the preset state on a background thread if needed.
+     *
+     * Once the preset state is ready, the preset will be loaded on the message thread, just
+     * like with loadPreset(). If another preset is requested before the state is ready,
+     * the previous request is discarded. The preset must remain in the preset tree while
+     * it is being loaded (changing the preset list will cancel the request).
+     */
+    void loadPresetAsync (const Preset& preset);
+
+    /** Returns true if a preset is currently being loaded asynchronously. */
+    [[nodiscard]] bool isLoadingPreset() const noexcept { return asyncPresetLoader.isLoading(); }
+
     /** Returns the currently loaded preset, or nullptr if no preset is loaded. */
     [[nodiscard]] const Preset* getCurrentPreset() const { return currentPreset.get(); }
 
@@ -74,8 +88,11 @@ public:
     /** Returns the internal preset tree. */
     [[nodiscard]] const auto& getPresetTree() const { return presetTree; }
 
-    /** Set's the user preset path. This will force any user presets to be re-scanned. */
-    void setUserPresetPath (const juce::File& file);
+    /**
+     * Set's the user preset path. This will force any user presets to be re-scanned.
+     * If loadPresetsAsync is true, the presets will be scanned on a background thread.
+     */
+    void setUserPresetPath (const juce::File& file, bool loadPresetsAsync = false);
 
     /** Returns the user preset path. */
     [[nodiscard]] juce::File getUserPresetPath() const;
@@ -86,27 +103,68 @@ public:
     /** Returns the "Vendor" name used for user presets. */
     [[nodiscard]] juce::String getUserPresetVendorName() const noexcept { return userPresetsVendor; }
 
-    /** Loads a set of user presets from the given folder path. */
+    /**
+     * Loads a set of user presets from the given folder path.
+     *
+     * The folder is indexed, so that only new or modified preset files are
+     * parsed when the folder is re-scanned. The user presets won't load their
+     * state until they are selected.
+     *
+     * This method is also used by loadUserPresetsFromFolderAsync(), so if you
+     * override it, make sure to call the base class implementation to load the presets.
+     */
     virtual void loadUserPresetsFromFolder (const juce::File& file);
 
+    /**
+     * Loads a set of user presets from the given folder path, on a background thread.
+     * The presets will be added to the preset tree in batches, on the message thread.
+     */
+    void loadUserPresetsFromFolderAsync (const juce::File& file);
+
+    /** Returns true if the user presets are currently being loaded on a background thread. */
+    [[nodiscard]] bool isLoadingUserPresets() const noexcept { return userPresetScanner.isScanning(); }
+
     /** Called whenever the preset lsit has changed. */
     Broadcaster<void()> presetListUpdatedBroadcaster {};
 
+    /**
+     * Called on the message thread, just before the new preset state is applied.
+     * Processors can use this to prepare for the parameter changes, e.g. by
+     * starting a short crossfade from their previous output.
+     */
+    Broadcaster<void()> presetAboutToChangeBroadcaster {};
+
     /** Called when the current preset has changed. */
     Broadcaster<void()> presetChangedBroadcaster {};
 
     /** Called whenever the current preset's "dirty" status has changed. */
     Broadcaster<void()> presetDirtyStatusBroadcaster {};
 
+    /** Called when the user presets have finished loading (either synchronously or asynchronously). */
+    Broadcaster<void()> userPresetsLoadedBroadcaster {};
+
 protected:
-    /** Override this if your presets need custom state-loading behaviour */
+    /**
+     * Override this if your presets need custom state-loading behaviour.
+     *
+     * By default, only the parameters whose values are changed by the preset
+     * will be set, so that the host and parameter listeners are only notified
+     * about the parameters that have actually changed.
+     */
     virtual void loadPresetState (const nlohmann::json& state);
 
     /** Returns true if the given parameter is preset-agnostic */
     [[nodiscard]] bool isPresetAgnosticParameter (const juce::RangedAudioParameter& param) const;
 
-    /** Override this to support backwards compatibility for user presets */
-    [[nodiscard]] virtual Preset loadUserPresetFromFile (const juce::File& file);
+    /**
+     * Override this to support backwards compatibility for user presets.
+     *
+     * The returned method is used to load user presets from their files. It may be
+     * called from a background thread, and it is copied into the lazily-loaded presets,
+     * so it must not refer to the PresetManager (or anything else that might be
+     * destroyed before the presets).
+     */
+    [[nodiscard]] virtual PresetFolderScanner::PresetLoader getUserPresetLoader() const;
 
     PresetState currentPreset;
     StateValue<bool> isPresetDirty { "chowdsp_is_preset_dirty", false };
@@ -114,6 +172,8 @@ protected:
 
 private:
     void initializeListeners (ParamHolder& params, ParameterListeners& listeners);
+    void removeUserPresets();
+    void scanUserPresetsFolderAsync (const juce::File& file);
 
     juce::AudioProcessor* processor = nullptr;
     chowdsp::PluginState& pluginState;
@@ -127,8 +187,13 @@ private:
 
     juce::File userPresetPath {};
     const juce::String presetFileExt {};
+    PresetFolderScanner userPresetScanner;
+
+    AsyncPresetLoader asyncPresetLoader { [this] (const Preset& preset)
+                                          { loadPreset (preset); } };
 
     bool areWeInTheMidstOfAPresetChange = false;
+    bool shouldLoadUserPresetsAsync = false;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetManager)
 };
@@ -0,0 +1,221 @@
+#include "chowdsp_PresetSearchIndex.h"
+
+namespace chowdsp
+{
+namespace PresetSearchHelpers
+{
+    static constexpr size_t minFuzzyWordLength = 3;
+    static constexpr size_t maxFuzzyWordLength = 32;
+
+    /** Maximum number of edits allowed when matching a query word approximately. */
+    static int getMaxEdits (size_t queryWordLength)
+    {
+        return queryWordLength >= 6 ? 2 : 1;
+    }
+
+    /**
+     * Returns the edit distance between the query word and the closest prefix of
+     * the preset word, or maxEdits + 1 if the distance is larger than maxEdits.
+     */
+    static int getFuzzyPrefixDistance (const std::string& queryWord, const std::string& presetWord, int maxEdits)
+    {
+        const auto queryLength = queryWord.size();
+        const auto wordLength = juce::jmin (presetWord.size(), queryLength + (size_t) maxEdits);
+
+        std::array<int, maxFuzzyWordLength + 3> prevRow {};
+        std::array<int, maxFuzzyWordLength + 3> row {};
+        for (size_t j = 0; j <= wordLength; ++j)
+            prevRow[j] = (int) j;
+
+        for (size_t i = 1; i <= queryLength; ++i)
+        {
+            row[0] = (int) i;
+            auto rowMin = row[0];
+            for (size_t j = 1; j <= wordLength; ++j)
+            {
+                const auto substitutionCost = queryWord[i - 1] == presetWord[j - 1] ? 0 : 1;
+                row[j] = juce::jmin (prevRow[j] + 1, row[j - 1] + 1, prevRow[j - 1] + substitutionCost);
+                rowMin = juce::jmin (rowMin, row[j]);
+            }
+
+            if (rowMin > maxEdits)
+                return maxEdits + 1;
+
+            std::swap (row, prevRow);
+        }
+
+        return *std::min_element (prevRow.begin(), prevRow.begin() + (int) wordLength + 1);
+    }
+
+    /** Sorts the results by preset ID, keeping only the best score for each preset. */
+    static void collapseResults (std::vector<PresetSearchIndex::Result>& results)
+    {
+        std::sort (results.begin(), results.end(), [] (const auto& r1, const auto& r2)
+                   { return r1.presetID < r2.presetID || (r1.presetID == r2.presetID && r1.score > r2.score); });
+        results.erase (std::unique (results.begin(), results.end(), [] (const auto& r1, const auto& r2)
+                                    { return r1.presetID == r2.presetID; }),
+                       results.end());
+    }
+} // namespace PresetSearchHelpers
+
+std::vector<std::string> PresetSearchIndex::getWords (const juce::String& text)
+{
+    std::vector<std::string> words;
+
+    auto ptr = text.getCharPointer();
+    auto wordStart = ptr;
+    bool isInWord = false;
+    while (true)
+    {
+        const auto isEnd = ptr.isEmpty();
+        const auto isWordChar = ! isEnd && juce::CharacterFunctions::isLetterOrDigit (*ptr);
+        if (isWordChar && ! isInWord)
+        {
+            wordStart = ptr;
+            isInWord = true;
+        }
+        else if (! isWordChar && isInWord)
+        {
+            words.push_back (juce::String { wordStart, ptr }.toLowerCase().toStdString());
+            isInWord = false;
+        }
+
+        if (isEnd)
+            break;
+        ++ptr;
+    }
+
+    return words;
+}
+
+template <typename Callable>
+void PresetSearchIndex::doForAllPresetWords (const Preset& preset, Callable&& callable)
+{
+    auto words = getWords (preset.getName());
+    for (const auto& text : { preset.getVendor(), preset.getCategory(), preset.getPresetFile().getFileNameWithoutExtension() })
+    {
+        auto moreWords = getWords (text);
+        words.insert (words.end(), std::make_move_iterator (moreWords.begin()), std::make_move_iterator (moreWords.end()));
+    }
+
+    // each word should only be indexed once per preset
+    std::sort (words.begin(), words.end());
+    words.erase (std::unique (words.begin(), words.end()), words.end());
+
+    for (const auto& word : words)
+        callable (word);
+}
+
+void PresetSearchIndex::addPreset (int presetID, const Preset& preset)
+{
+    doForAllPresetWords (preset,
+                         [this, presetID] (const std::string& word)
+                         {
+                             auto& presetIDs = wordsIndex[word];
+                             if (presetIDs.empty() || presetIDs.back() < presetID)
+                             {
+                                 presetIDs.push_back (presetID);
+                                 return;
+                             }
+
+                             const auto idIter = std::lower_bound (presetIDs.begin(), presetIDs.end(), presetID);
+                             if (idIter == presetIDs.end() || *idIter != presetID)
+                                 presetIDs.insert (idIter, presetID);
+                         });
+}
+
+void PresetSearchIndex::removePreset (int presetID, const Preset& preset)
+{
+    doForAllPresetWords (preset,
+                         [this, presetID] (const std::string& word)
+                         {
+                             const auto wordIter = wordsIndex.find (word);
+                             if (wordIter == wordsIndex.end())
+                             {
+                                 jassertfalse; // this preset was not in the index!
+                                 return;
+                             }
+
+                             auto& presetIDs = wordIter->second;
+                             const auto idIter = std::lower_bound (presetIDs.begin(), presetIDs.end(), presetID);
+                             if (idIter != presetIDs.end() && *idIter == presetID)
+                                 presetIDs.erase (idIter);
+
+                             if (presetIDs.empty())
+                                 wordsIndex.erase (wordIter);
+                         });
+}
+
+void PresetSearchIndex::clear()
+{
+    wordsIndex.clear();
+}
+
+void PresetSearchIndex::searchWord (const std::string& queryWord, std::vector<Result>& wordResults) const
+{
+    const auto addResults = [&wordResults] (const std::vector<int>& presetIDs, int score)
+    {
+        for (auto presetID : presetIDs)
+            wordResults.push_back ({ presetID, score });
+    };
+
+    // words that start with the query word are contiguous in the index
+    auto wordIter = wordsIndex.lower_bound (queryWord);
+    for (; wordIter != wordsIndex.end() && wordIter->first.compare (0, queryWord.size(), queryWord) == 0; ++wordIter)
+        addResults (wordIter->second, wordIter->first.size() == queryWord.size() ? exactMatchScore : prefixMatchScore);
+
+    if (queryWord.size() < PresetSearchHelpers::minFuzzyWordLength || queryWord.size() > PresetSearchHelpers::maxFuzzyWordLength)
+        return;
+
+    const auto maxEdits = PresetSearchHelpers::getMaxEdits (queryWord.size());
+    for (const auto& [presetWord, presetIDs] : wordsIndex)
+    {
+        if (presetWord.size() + (size_t) maxEdits < queryWord.size() || presetWord.compare (0, queryWord.size(), queryWord) == 0)
+            continue; // the word is too short, or was already matched as a prefix
+
+        if (PresetSearchHelpers::getFuzzyPrefixDistance (queryWord, presetWord, maxEdits) <= maxEdits)
+            addResults (presetIDs, fuzzyMatchScore);
+    }
+}
+
+std::vector<PresetSearchIndex::Result> PresetSearchIndex::search (const juce::String& query) const
+{
+    const auto queryWords = getWords (query);
+    if (queryWords.empty())
+        return {};
+
+    std::vector<Result> results;
+    std::vector<Result> wordResults;
+    for (const auto [wordIndex, queryWord] : enumerate (queryWords))
+    {
+        wordResults.clear();
+        searchWord (queryWord, wordResults);
+        PresetSearchHelpers::collapseResults (wordResults);
+
+        if (wordIndex == 0)
+        {
+            std::swap (results, wordResults);
+        }
+        else
+        {
+            // only keep the presets that match every query word
+            size_t numMatches = 0;
+            auto wordResultIter = wordResults.begin();
+            for (const auto& result : results)
+            {
+                while (wordResultIter != wordResults.end() && wordResultIter->presetID < result.presetID)
+                    ++wordResultIter;
+
+                if (wordResultIter != wordResults.end() && wordResultIter->presetID == result.presetID)
+                    results[numMatches++] = { result.presetID, result.score + wordResultIter->score };
+            }
+            results.resize (numMatches);
+        }
+
+        if (results.empty())
+            break;
+    }
+
+    return results;
+}
+} // namespace chowdsp
@@ -0,0 +1,63 @@
+#pragma once
+
+namespace chowdsp
+{
+/**
+ * An inverted index of the words in a set of presets, used for searching presets.
+ *
+ * Each preset is identified by an integer ID, and is indexed by the words in
+ * the preset's name, vendor, category, and file name. Searches match presets
+ * containing all the words in the query, where each query word can match a
+ * preset word exactly, as a prefix (for search-as-you-type), or approximately
+ * (to allow for typos).
+ */
+class PresetSearchIndex
+{
+public:
+    PresetSearchIndex() = default;
+
+    /** Adds a preset to the index. */
+    void addPreset (int presetID, const Preset& preset);
+
+    /** Removes a preset from the index. The preset must be the same as when it was added! */
+    void removePreset (int presetID, const Preset& preset);
+
+    /** Removes all presets from the index. */
+    void clear();
+
+    /** A preset that matches a search query. */
+    struct Result
+    {
+        int presetID = -1;
+        int score = 0; /**< Higher scores are better matches */
+    };
+
+    /**
+     * Returns the presets that match all the words in the query, in no particular order.
+     * An empty query will not match any presets.
+     */
+    [[nodiscard]] std::vector<Result> search (const juce::String& query) const;
+
+    /** Returns the number of unique words in the index. */
+    [[nodiscard]] size_t getNumWords() const noexcept { return wordsIndex.size(); }
+
+    /** Splits some text into lower-case words for indexing or searching. */
+    static std::vector<std::string> getWords (const juce::String& text);
+
+    static constexpr int exactMatchScore = 4;
+    static constexpr int prefixMatchScore = 2;
+    static constexpr int fuzzyMatchScore = 1;
+
+private:
+    template <typename Callable>
+    static void doForAllPresetWords (const Preset& preset, Callable&& callable);
+
+    /** Appends the presets matching a single query word, with the best score for each preset. */
+    void searchWord (const std::string& queryWord, std::vector<Result>& wordResults) const;
+
+    // maps each word to the IDs of the presets containing that word (sorted)
+    std::map<std::string, std::vector<int>, std::less<>> wordsIndex;
+
+    JUCE_LEAK_DETECTOR (PresetSearchIndex)
+};
+} // namespace chowdsp
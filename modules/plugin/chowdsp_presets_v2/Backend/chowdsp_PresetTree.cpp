@@ -105,17 +105,20 @@ static void doForAllPresetItems (Callable&& callable, const std::vector<PresetTr
 }
 
 template <typename Callable>
-static void removePresetsGeneric (Callable&& shouldDeletePresetItem, std::vector<PresetTree::Item>& items, PresetState* presetState)
+static void removePresetsGeneric (Callable&& shouldDeletePresetItem, std::vector<PresetTree::Item>& items, PresetState* presetState, PresetSearchIndex& searchIndex)
 {
     VectorHelpers::erase_if (
         items,
-        [&presetState, shouldDelete = std::forward<Callable> (shouldDeletePresetItem)] (const PresetTree::Item& item)
+        [&presetState, &searchIndex, shouldDelete = std::forward<Callable> (shouldDeletePresetItem)] (const PresetTree::Item& item)
         {
             if (shouldDelete (item))
             {
                 if (presetState != nullptr && presetState->get() != nullptr && *presetState->get() == *item.preset)
                     presetState->assumeOwnership();
 
+                if (item.presetID >= 0)
+                    searchIndex.removePreset (item.presetID, *item.preset);
+
                 return true;
             }
 
@@ -125,7 +128,7 @@ static void removePresetsGeneric (Callable&& shouldDeletePresetItem, std::vector
     for (auto& item : items)
     {
         if (! item.preset.has_value())
-            removePresetsGeneric (std::forward<Callable> (shouldDeletePresetItem), item.subtree, presetState);
+            removePresetsGeneric (std::forward<Callable> (shouldDeletePresetItem), item.subtree, presetState, searchIndex);
     }
 
     // Remove empty sub-trees
@@ -145,25 +148,45 @@ PresetTree::PresetTree (PresetState* currentPresetState, InsertionHelper&& inser
         insertHelper.presetSortMethod = &PresetTreeInserters::defaultPresetComparator;
 
     if (insertHelper.insertItemIntoTree == nullptr)
+    {
+        usingDefaultItemInsertion = true;
         insertHelper.insertItemIntoTree = [this] (std::vector<Item>& vec, Item&& item) -> Item&
         {
             return *VectorHelpers::insert_sorted (vec,
                                                   std::move (item),
-                                                  [&tagComp = std::as_const (insertHelper.tagSortMethod),
-                                                   &presetComp = std::as_const (insertHelper.presetSortMethod)] (const Item& item1, const Item& item2)
-                                                  {
-                                                      if (item1.preset.has_value() && ! item2.preset.has_value())
-                                                          return false;
+                                                  [this] (const Item& item1, const Item& item2)
+                                                  { return compareItems (item1, item2); });
+        };
+    }
+}
+
+bool PresetTree::compareItems (const Item& item1, const Item& item2) const
+{
+    if (item1.preset.has_value() && ! item2.preset.has_value())
+        return false;
 
-                                                      if (! item1.preset.has_value() && item2.preset.has_value())
-                                                          return true;
+    if (! item1.preset.has_value() && item2.preset.has_value())
+        return true;
 
-                                                      if (item1.preset.has_value())
-                                                          return presetComp (*item1.preset, *item2.preset);
+    if (item1.preset.has_value())
+        return insertHelper.presetSortMethod (*item1.preset, *item2.preset);
 
-                                                      return tagComp (item1.tag, item2.tag);
-                                                  });
-        };
+    return insertHelper.tagSortMethod (item1.tag, item2.tag);
+}
+
+void PresetTree::sortItems (std::vector<Item>& itemsToSort) const
+{
+    // stable sort matches the ordering from inserting the items one at a time
+    std::stable_sort (itemsToSort.begin(),
+                      itemsToSort.end(),
+                      [this] (const Item& item1, const Item& item2)
+                      { return compareItems (item1, item2); });
+
+    for (auto& item : itemsToSort)
+    {
+        if (! item.preset.has_value())
+            sortItems (item.subtree);
+    }
 }
 
 PresetTree::~PresetTree() = default;
@@ -177,8 +200,25 @@ const Preset& PresetTree::insertPreset (Preset&& presetToInsert)
 
 void PresetTree::insertPresets (std::vector<Preset>&& presets)
 {
+    if (! usingDefaultItemInsertion)
+    {
+        for (auto& preset : std::move (presets))
+            treeInserter (std::move (preset), items, insertHelper);
+        refreshPresetIndexes();
+        return;
+    }
+
+    // With the default insertion method, it's much faster to append all the
+    // new items to the tree, and then sort the tree once at the end.
+    auto sortedInsertion = std::exchange (insertHelper.insertItemIntoTree,
+                                          [] (std::vector<Item>& vec, Item&& item) -> Item&
+                                          { return vec.emplace_back (std::move (item)); });
+
     for (auto& preset : std::move (presets))
         treeInserter (std::move (preset), items, insertHelper);
+
+    insertHelper.insertItemIntoTree = std::move (sortedInsertion);
+    sortItems (items);
     refreshPresetIndexes();
 }
 
@@ -187,7 +227,8 @@ void PresetTree::removePreset (int index)
     removePresetsGeneric ([index] (const Item& item)
                           { return item.preset.has_value() && item.presetIndex == index; },
                           items,
-                          presetState);
+                          presetState,
+                          searchIndex);
     refreshPresetIndexes();
 }
 
@@ -196,7 +237,8 @@ void PresetTree::removePreset (const Preset& preset)
     removePresetsGeneric ([&preset] (const Item& item)
                           { return item.preset.has_value() && item.preset == preset; },
                           items,
-                          presetState);
+                          presetState,
+                          searchIndex);
     refreshPresetIndexes();
 }
 
@@ -205,7 +247,8 @@ void PresetTree::removePresets (std::function<bool (const Preset& preset)>&& pre
     removePresetsGeneric ([&presetsToRemove] (const Item& item)
                           { return item.preset.has_value() && presetsToRemove (*item.preset); },
                           items,
-                          presetState);
+                          presetState,
+                          searchIndex);
     refreshPresetIndexes();
 }
 
@@ -245,11 +288,48 @@ const Preset* PresetTree::findPreset (const Preset& preset) const
     return result;
 }
 
+std::vector<const Preset*> PresetTree::searchPresets (const juce::String& query, size_t maxNumResults) const
+{
+    auto results = searchIndex.search (query);
+
+    const auto getPresetIndex = [this] (int presetID)
+    { return itemsByPresetID.at (presetID)->presetIndex; };
+
+    // best matches first, otherwise keep the tree order
+    const auto compareResults = [&getPresetIndex] (const PresetSearchIndex::Result& r1, const PresetSearchIndex::Result& r2)
+    {
+        if (r1.score != r2.score)
+            return r1.score > r2.score;
+        return getPresetIndex (r1.presetID) < getPresetIndex (r2.presetID);
+    };
+
+    const auto numResults = juce::jmin (maxNumResults, results.size());
+    std::partial_sort (results.begin(), results.begin() + (int) numResults, results.end(), compareResults);
+
+    std::vector<const Preset*> presets;
+    presets.reserve (numResults);
+    for (size_t i = 0; i < numResults; ++i)
+        presets.push_back (&(*itemsByPresetID.at (results[i].presetID)->preset));
+
+    return presets;
+}
+
 void PresetTree::refreshPresetIndexes()
 {
     int index = 0;
-    doForAllPresetItems ([&index] (Item& item) mutable
-                         { item.presetIndex = index++; },
+    itemsByPresetID.clear();
+    doForAllPresetItems ([this, &index] (Item& item) mutable
+                         {
+                             item.presetIndex = index++;
+
+                             // new presets need to be added to the search index
+                             if (item.presetID < 0)
+                             {
+                                 item.presetID = nextPresetID++;
+                                 searchIndex.addPreset (item.presetID, *item.preset);
+                             }
+
+                             itemsByPresetID[item.presetID] = &item; },
                          items);
     totalNumPresets = index;
 }
@@ -11,6 +11,7 @@ public:
     {
         std::optional<Preset> preset {}; // preset field
         int presetIndex = -1; // index for the preset in the tree
+        int presetID = -1; // stable ID for the preset, used by the search index
 
         std::vector<Item> subtree {}; // nested tree field
         juce::String tag; // tag for the nested tree
@@ -36,6 +37,9 @@ public:
     /**
      * Inserts a bunch of presets into the tree.
      * Calling this invalidates any existing preset indices.
+     *
+     * If the tree is using the default method for inserting items,
+     * the items will be sorted once, after all the presets have been inserted.
      */
     void insertPresets (std::vector<Preset>&& presets);
 
@@ -60,6 +64,15 @@ public:
     /** Checks if the tree currently contains a preset. If true, then return the preset, else return nullptr. */
     [[nodiscard]] const Preset* findPreset (const Preset& preset) const;
 
+    /**
+     * Searches the presets in the tree by name, vendor, category, and file name.
+     *
+     * Returns the presets that match all the words in the query, with the
+     * best matches first. Words in the query can match preset words exactly,
+     * as a prefix, or approximately (see PresetSearchIndex).
+     */
+    [[nodiscard]] std::vector<const Preset*> searchPresets (const juce::String& query, size_t maxNumResults = std::numeric_limits<size_t>::max()) const;
+
     /**
      * Method for inserting presets into the tree.
      *
@@ -72,10 +85,17 @@ public:
 
 private:
     void refreshPresetIndexes();
+    [[nodiscard]] bool compareItems (const Item& item1, const Item& item2) const;
+    void sortItems (std::vector<Item>& itemsToSort) const;
 
     std::vector<Item> items;
     int totalNumPresets = 0;
 
+    PresetSearchIndex searchIndex;
+    std::unordered_map<int, const Item*> itemsByPresetID;
+    int nextPresetID = 0;
+    bool usingDefaultItemInsertion = false;
+
     PresetState* presetState = nullptr;
 
     InsertionHelper insertHelper;
@@ -2,7 +2,11 @@
 
 #include "Backend/chowdsp_Preset.cpp"
 #include "Backend/chowdsp_PresetState.cpp"
+#include "Backend/chowdsp_PresetSearchIndex.cpp"
 #include "Backend/chowdsp_PresetTree.cpp"
+#include "Backend/chowdsp_PresetIndex.cpp"
+#include "Backend/chowdsp_PresetFolderScanner.cpp"
+#include "Backend/chowdsp_AsyncPresetLoader.cpp"
 #include "Backend/chowdsp_PresetManager.cpp"
 
 #include "Frontend/chowdsp_PresetsProgramAdapter.cpp"
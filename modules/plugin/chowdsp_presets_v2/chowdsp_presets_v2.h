@@ -28,7 +28,11 @@ BEGIN_JUCE_MODULE_DECLARATION
 
 #include "Backend/chowdsp_Preset.h"
 #include "Backend/chowdsp_PresetState.h"
+#include "Backend/chowdsp_PresetSearchIndex.h"
 #include "Backend/chowdsp_PresetTree.h"
+#include "Backend/chowdsp_PresetIndex.h"
+#include "Backend/chowdsp_PresetFolderScanner.h"
+#include "Backend/chowdsp_AsyncPresetLoader.h"
 #include "Backend/chowdsp_PresetManager.h"
 
 namespace chowdsp
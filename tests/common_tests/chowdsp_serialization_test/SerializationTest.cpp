@@ -35,7 +35,7 @@ struct CustomTest
     static_assert (chowdsp::serialization_detail::HasCustomDeserializer<CustomTest>);
 };
 
-TEMPLATE_TEST_CASE ("Serialization Test", "[common][serialization]", chowdsp::JSONSerializer, chowdsp::XMLSerializer)
+TEMPLATE_TEST_CASE ("Serialization Test", "[common][serialization]", chowdsp::JSONSerializer, chowdsp::XMLSerializer, chowdsp::BinarySerializer)
 {
     using Serializer = TestType;
 
@@ -210,10 +210,145 @@ TEMPLATE_TEST_CASE ("Serialization Test", "[common][serialization]", chowdsp::JS
 
         Test actual;
         if constexpr (std::is_same_v<Serializer, chowdsp::JSONSerializer>)
+        {
             chowdsp::Serialization::deserialize<Serializer> (BinaryData::test_json_json, BinaryData::test_json_jsonSize, actual);
-        else
+        }
+        else if constexpr (std::is_same_v<Serializer, chowdsp::XMLSerializer>)
+        {
             chowdsp::Serialization::deserialize<Serializer> (BinaryData::test_xml_xml, BinaryData::test_xml_xmlSize, actual);
+        }
+        else
+        {
+            juce::MemoryBlock block;
+            chowdsp::Serialization::serialize<Serializer> (expected, block);
+            chowdsp::Serialization::deserialize<Serializer> (block.getData(), (int) block.getSize(), actual);
+        }
 
         REQUIRE_MESSAGE (pfr::eq_fields (expected, actual), "Binary Data Deserialization is incorrect");
     }
 }
+
+TEST_CASE ("Binary Streaming Serialization Test", "[common][serialization]")
+{
+    struct Band
+    {
+        float freq = 1000.0f;
+        float gain = 0.0f;
+        bool onOff = true;
+        std::array<double, 2> extra { 1.0, 2.0 };
+    };
+
+    struct Wavetable
+    {
+        std::string name;
+        std::vector<float> data;
+    };
+
+    struct Test
+    {
+        int version = 3;
+        std::vector<Band> bands;
+        std::vector<Wavetable> wavetables;
+        std::map<std::string, int> tags;
+        CustomTest custom;
+    };
+
+    Test test;
+    test.bands.resize (8);
+    juce::Random rand { 0x1234 };
+    for (int i = 0; i < 4; ++i)
+    {
+        auto& table = test.wavetables.emplace_back();
+        table.name = "Table " + std::to_string (i);
+        table.data.resize (2048);
+        std::generate (table.data.begin(), table.data.end(), [&rand]
+                       { return rand.nextFloat() * 2.0f - 1.0f; });
+    }
+    test.tags = { { "one", 1 }, { "two", 2 } };
+
+    SECTION ("Matches Element Serialization")
+    {
+        // the base serializer builds the data one element at a time
+        const auto streamed = chowdsp::BinarySerializer::toString (chowdsp::Serialization::serialize<chowdsp::BinarySerializer> (test));
+        const auto built = chowdsp::BinarySerializer::toString (chowdsp::BaseSerializer::serialize<chowdsp::BinarySerializer> (test));
+        REQUIRE_MESSAGE (streamed == built, "Streamed serialization does not match element serialization!");
+    }
+
+    SECTION ("Round Trip")
+    {
+        juce::MemoryBlock block;
+        chowdsp::Serialization::serialize<chowdsp::BinarySerializer> (test, block);
+
+        Test actual;
+        chowdsp::Serialization::deserialize<chowdsp::BinarySerializer> (block, actual);
+
+        REQUIRE (actual.version == test.version);
+        REQUIRE (actual.bands.size() == test.bands.size());
+        REQUIRE (pfr::eq_fields (actual.bands[7], test.bands[7]));
+        REQUIRE (actual.wavetables.size() == test.wavetables.size());
+        for (size_t i = 0; i < test.wavetables.size(); ++i)
+        {
+            REQUIRE (actual.wavetables[i].name == test.wavetables[i].name);
+            REQUIRE (actual.wavetables[i].data == test.wavetables[i].data);
+        }
+        REQUIRE (actual.tags == test.tags);
+        REQUIRE (actual.custom.x == test.custom.x);
+    }
+
+    SECTION ("Missing Fields")
+    {
+        struct OldTest
+        {
+            int version = 2;
+            std::vector<Band> bands;
+        };
+
+        juce::MemoryBlock block;
+        chowdsp::Serialization::serialize<chowdsp::BinarySerializer> (OldTest { 2, { Band {} } }, block);
+
+        chowdsp::Serialization::deserialize<chowdsp::BinarySerializer> (block, test);
+        REQUIRE (test.version == 2);
+        REQUIRE (test.bands.size() == 1);
+        REQUIRE (test.wavetables.empty());
+        REQUIRE (test.tags.empty());
+    }
+
+    SECTION ("Corrupted Data")
+    {
+        // byte layout: file header | array tag | number of children | payload size | children...
+        static constexpr size_t headerSize = sizeof (chowdsp::BinarySerializer::magicNumber) + sizeof (chowdsp::BinarySerializer::formatVersion);
+        static constexpr auto numChildrenOffset = headerSize + 1;
+
+        {
+            juce::MemoryBlock block;
+            chowdsp::Serialization::serialize<chowdsp::BinarySerializer> (std::vector<float> { 1.0f, 2.0f, 3.0f }, block);
+            static_cast<uint8_t*> (block.getData())[numChildrenOffset] = 0x7f; // more children than the payload can hold
+
+            std::vector<float> actual { 4.0f };
+            chowdsp::Serialization::deserialize<chowdsp::BinarySerializer> (block, actual);
+            REQUIRE_MESSAGE (actual.empty(), "Corrupted array should not be loaded!");
+        }
+
+        {
+            juce::MemoryBlock block;
+            chowdsp::Serialization::serialize<chowdsp::BinarySerializer> (std::vector<std::vector<float>> { { 1.0f, 2.0f, 3.0f } }, block);
+            static_cast<uint8_t*> (block.getData())[numChildrenOffset + 3] = 0x7f; // the inner array's number of children
+
+            std::vector<std::vector<float>> actual;
+            chowdsp::Serialization::deserialize<chowdsp::BinarySerializer> (block, actual);
+            REQUIRE (actual.size() == 1);
+            REQUIRE_MESSAGE (actual[0].empty(), "Corrupted inner array should not be loaded!");
+        }
+
+        {
+            juce::MemoryBlock block;
+            chowdsp::Serialization::serialize<chowdsp::BinarySerializer> (test, block);
+            block.setSize (block.getSize() / 2); // truncated data
+
+            Test actual;
+            actual.bands.resize (2);
+            chowdsp::Serialization::deserialize<chowdsp::BinarySerializer> (block, actual);
+            REQUIRE_MESSAGE (actual.bands.empty(), "Truncated data should not be loaded!");
+        }
+    }
+}
@@ -0,0 +1,197 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
+
+namespace
+{
+template <typename T>
+void fillBuffer (chowdsp::Buffer<T>& buffer, int64_t startValue)
+{
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    {
+        auto* x = buffer.getWritePointer (ch);
+        for (int n = 0; n < buffer.getNumSamples(); ++n)
+            x[n] = T (startValue + n + 1000 * ch);
+    }
+}
+
+template <typename T>
+void checkRegion (const typename chowdsp::AudioRingBuffer<T>::ReadRegion& region, int numChannels, int64_t startValue)
+{
+    chowdsp::Buffer<T> result { numChannels, region.getNumSamples() };
+    region.copyTo (result);
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        const auto* x = result.getReadPointer (ch);
+        for (int n = 0; n < result.getNumSamples(); ++n)
+        {
+            const auto expected = startValue + n < 0 ? T (0) : T (startValue + n + 1000 * ch);
+            REQUIRE (x[n] == expected);
+        }
+    }
+}
+} // namespace
+
+TEMPLATE_TEST_CASE ("Audio Ring Buffer Test", "[dsp][buffers]", float, double)
+{
+    using RingBuffer = chowdsp::AudioRingBuffer<TestType>;
+    static constexpr int numChannels = 2;
+    static constexpr int capacity = 100;
+    static constexpr int blockSize = 30;
+
+    SECTION ("FIFO Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity, RingBuffer::OverrunPolicy::DropNewest };
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+
+        int64_t samplesWritten = 0;
+        int64_t samplesRead = 0;
+        for (int i = 0; i < 20; ++i)
+        {
+            fillBuffer (block, samplesWritten);
+            REQUIRE (ringBuffer.push (block) == blockSize);
+            samplesWritten += blockSize;
+            REQUIRE (ringBuffer.getNumSamplesAvailable() == blockSize);
+
+            // read in two chunks, so that the read regions wrap around the end of the buffer
+            for (auto numToRead : { 17, blockSize - 17 })
+            {
+                const auto region = ringBuffer.getReadRegion (numToRead);
+                REQUIRE (region.getNumSamples() == numToRead);
+                REQUIRE (region.startPosition == samplesRead);
+                checkRegion<TestType> (region, numChannels, samplesRead);
+                ringBuffer.finishedReading (numToRead);
+                samplesRead += numToRead;
+            }
+        }
+
+        REQUIRE (ringBuffer.getTotalNumSamplesPushed() == samplesWritten);
+        REQUIRE (ringBuffer.getNumLostSamples() == 0);
+    }
+
+    SECTION ("Drop Newest Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity, RingBuffer::OverrunPolicy::DropNewest };
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+
+        int64_t samplesWritten = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            fillBuffer (block, samplesWritten);
+            samplesWritten += ringBuffer.push (block);
+        }
+
+        REQUIRE (samplesWritten == capacity);
+        REQUIRE (ringBuffer.getNumLostSamples() == 4 * blockSize - capacity);
+        REQUIRE (ringBuffer.getNumSamplesAvailable() == capacity);
+
+        // the oldest data should still be there
+        const auto region = ringBuffer.getReadRegion (capacity);
+        REQUIRE (region.getNumSamples() == capacity);
+        checkRegion<TestType> (region, numChannels, 0);
+    }
+
+    SECTION ("Overwrite Oldest Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity };
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+
+        for (int i = 0; i < 5; ++i)
+        {
+            fillBuffer (block, i * blockSize);
+            REQUIRE (ringBuffer.push (block) == blockSize);
+        }
+
+        static constexpr int64_t numPushed = 5 * blockSize;
+        REQUIRE (ringBuffer.getNumSamplesAvailable() == capacity);
+        checkRegion<TestType> (ringBuffer.getLatestRegion (capacity), numChannels, numPushed - capacity);
+        checkRegion<TestType> (ringBuffer.getLatestRegion (10), numChannels, numPushed - 10);
+
+        // the overwritten samples should be skipped by the reader
+        const auto region = ringBuffer.getReadRegion (capacity);
+        REQUIRE (region.startPosition == numPushed - capacity);
+        checkRegion<TestType> (region, numChannels, numPushed - capacity);
+        REQUIRE (ringBuffer.getNumLostSamples() == numPushed - capacity);
+    }
+
+    SECTION ("Large Block Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity };
+        chowdsp::Buffer<TestType> block { numChannels, 2 * capacity + 10 };
+        fillBuffer (block, 0);
+
+        REQUIRE (ringBuffer.push (block) == capacity);
+        REQUIRE (ringBuffer.getTotalNumSamplesPushed() == block.getNumSamples());
+        checkRegion<TestType> (ringBuffer.getLatestRegion (capacity), numChannels, block.getNumSamples() - capacity);
+    }
+
+    SECTION ("Latest Region Before Start Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity };
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+        fillBuffer (block, 0);
+        ringBuffer.push (block);
+
+        // the region should start with silence, since only one block has been pushed
+        const auto region = ringBuffer.getLatestRegion (capacity);
+        REQUIRE (region.startPosition == blockSize - capacity);
+        checkRegion<TestType> (region, numChannels, blockSize - capacity);
+    }
+
+    SECTION ("Region Valid Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity };
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+        fillBuffer (block, 0);
+        ringBuffer.push (block);
+
+        const auto region = ringBuffer.getReadRegion (blockSize);
+        REQUIRE (ringBuffer.isRegionValid (region));
+
+        ringBuffer.push (block);
+        ringBuffer.push (block);
+        REQUIRE (ringBuffer.isRegionValid (region));
+
+        ringBuffer.push (block);
+        REQUIRE (! ringBuffer.isRegionValid (region));
+    }
+
+    SECTION ("Contiguous Region Test")
+    {
+        static constexpr int maxContiguousReadSize = 40;
+        RingBuffer ringBuffer { numChannels, capacity, RingBuffer::OverrunPolicy::OverwriteOldest, maxContiguousReadSize };
+        REQUIRE (ringBuffer.getCapacity() == capacity);
+
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+        int64_t numPushed = 0;
+        for (int i = 0; i < 20; ++i)
+        {
+            fillBuffer (block, numPushed);
+            ringBuffer.push (block);
+            numPushed += blockSize;
+
+            // regions up to the contiguous read size should never be split, even when they wrap around the end of the buffer
+            for (auto numSamples : { 1, 25, maxContiguousReadSize })
+            {
+                const auto region = ringBuffer.getLatestRegion (numSamples);
+                REQUIRE (region.block2.getNumSamples() == 0);
+                checkRegion<TestType> (region, numChannels, numPushed - numSamples);
+            }
+
+            checkRegion<TestType> (ringBuffer.getLatestRegion (capacity), numChannels, numPushed - capacity);
+        }
+    }
+
+    SECTION ("Reset Test")
+    {
+        RingBuffer ringBuffer { numChannels, capacity };
+        chowdsp::Buffer<TestType> block { numChannels, blockSize };
+        fillBuffer (block, 0);
+        ringBuffer.push (block);
+        ringBuffer.reset();
+
+        REQUIRE (ringBuffer.getTotalNumSamplesPushed() == 0);
+        REQUIRE (ringBuffer.getNumSamplesAvailable() == 0);
+        checkRegion<TestType> (ringBuffer.getLatestRegion (capacity), numChannels, -capacity);
+    }
+}
@@ -0,0 +1,90 @@
+#include <CatchUtils.h>
+#include <chowdsp_dsp_data_structures/chowdsp_dsp_data_structures.h>
+#include <mutex>
+#include <set>
+
+namespace
+{
+chowdsp::ForkJoinPool::Options getOptions (int numWorkers, std::chrono::microseconds deadline = std::chrono::seconds { 1 })
+{
+    chowdsp::ForkJoinPool::Options options;
+    options.numWorkers = numWorkers;
+    options.spinTime = std::chrono::microseconds { 20 };
+    options.deadline = deadline;
+    return options;
+}
+} // namespace
+
+TEST_CASE ("Fork Join Pool Test", "[dsp][data-structures]")
+{
+    SECTION ("Parallel For Test")
+    {
+        for (int numWorkers : { 0, 1, 3 })
+        {
+            chowdsp::ForkJoinPool pool { getOptions (numWorkers) };
+            REQUIRE (pool.getNumWorkers() == numWorkers);
+
+            std::vector<int> taskCounts (64, 0);
+            for (int numTasks = 0; numTasks <= (int) taskCounts.size(); ++numTasks)
+            {
+                std::fill (taskCounts.begin(), taskCounts.end(), 0);
+                pool.parallelFor (numTasks, [&taskCounts] (int taskIndex)
+                                  { taskCounts[(size_t) taskIndex]++; });
+
+                for (int taskIndex = 0; taskIndex < (int) taskCounts.size(); ++taskIndex)
+                    REQUIRE (taskCounts[(size_t) taskIndex] == (taskIndex < numTasks ? 1 : 0));
+            }
+        }
+    }
+
+    SECTION ("Uses Worker Threads Test")
+    {
+        chowdsp::ForkJoinPool pool { getOptions (3) };
+
+        std::mutex mutex;
+        std::set<std::thread::id> threadIDs;
+        pool.parallelFor (4, [&] (int)
+                          {
+                              std::this_thread::sleep_for (std::chrono::milliseconds { 20 });
+                              const std::lock_guard lock { mutex };
+                              threadIDs.insert (std::this_thread::get_id());
+                          });
+
+        REQUIRE (threadIDs.size() > 1);
+        REQUIRE (pool.getNumDeadlineMisses() == 0);
+    }
+
+    SECTION ("Nested Call Test")
+    {
+        chowdsp::ForkJoinPool pool { getOptions (2) };
+
+        std::atomic<int> numInnerTasks { 0 };
+        pool.parallelFor (4, [&] (int)
+                          { pool.parallelFor (4, [&] (int)
+                                              { numInnerTasks++; }); });
+
+        REQUIRE (numInnerTasks.load() == 16);
+    }
+
+    SECTION ("Serial Fallback Test")
+    {
+        auto options = getOptions (1, std::chrono::microseconds { 0 });
+        options.numSerialFallbackCalls = 2;
+        chowdsp::ForkJoinPool pool { options };
+
+        // the worker's task takes longer than the calling thread's, so the deadline will be missed
+        const auto callerThreadID = std::this_thread::get_id();
+        pool.parallelFor (2, [callerThreadID] (int)
+                          { std::this_thread::sleep_for (std::chrono::milliseconds { std::this_thread::get_id() == callerThreadID ? 10 : 50 }); });
+        REQUIRE (pool.getNumDeadlineMisses() == 1);
+        REQUIRE (pool.isUsingSerialFallback());
+
+        for (int i = 0; i < options.numSerialFallbackCalls; ++i)
+        {
+            REQUIRE (pool.isUsingSerialFallback());
+            pool.parallelFor (4, [callerThreadID] (int)
+                              { REQUIRE (std::this_thread::get_id() == callerThreadID); });
+        }
+        REQUIRE (! pool.isUsingSerialFallback());
+    }
+}
@@ -0,0 +1,98 @@
+#include <CatchUtils.h>
+#include <chowdsp_eq/chowdsp_eq.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int blockSize = 256;
+constexpr int numChannels = 3;
+constexpr int numBlocks = 20;
+} // namespace
+
+template <typename EQType>
+static void setEQParams (EQType& eq, float gainOffsetDB = 0.0f)
+{
+    eq.setCutoffFrequency (0, 100.0f);
+    eq.setFilterType (0, 2); // low shelf
+    eq.setGainDB (0, 4.0f + gainOffsetDB);
+    eq.setBandOnOff (0, true);
+
+    eq.setCutoffFrequency (1, 1000.0f);
+    eq.setQValue (1, 2.0f);
+    eq.setFilterType (1, 3); // bell
+    eq.setGainDB (1, -6.0f + gainOffsetDB);
+    eq.setBandOnOff (1, true);
+
+    eq.setCutoffFrequency (2, 15000.0f);
+    eq.setFilterType (2, 6); // 1st-order LPF
+    eq.setBandOnOff (2, true);
+
+    eq.setCutoffFrequency (3, 40.0f);
+    eq.setFilterType (3, 1); // 2nd-order HPF
+    eq.setBandOnOff (3, false);
+}
+
+template <typename EQType>
+static void processAndCompare (EQType& serialEQ, EQType& fusedEQ, const chowdsp::Buffer<float>& input, int startBlock, int endBlock, float margin)
+{
+    chowdsp::Buffer<float> serialBuffer (numChannels, blockSize);
+    chowdsp::Buffer<float> fusedBuffer (numChannels, blockSize);
+    for (int block = startBlock; block < endBlock; ++block)
+    {
+        chowdsp::BufferMath::copyBufferData (input, serialBuffer, block * blockSize, 0, blockSize);
+        chowdsp::BufferMath::copyBufferData (input, fusedBuffer, block * blockSize, 0, blockSize);
+
+        serialEQ.processBlock (serialBuffer);
+        fusedEQ.processBlock (fusedBuffer);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int n = 0; n < blockSize; ++n)
+                REQUIRE (fusedBuffer.getReadPointer (ch)[n] == Catch::Approx (serialBuffer.getReadPointer (ch)[n]).margin (margin));
+    }
+}
+
+TEST_CASE ("EQ Processor Test", "[dsp][EQ]")
+{
+    const auto input = test_utils::makeNoise<float> (numBlocks * blockSize, numChannels);
+
+    SECTION ("Fused Processing Test")
+    {
+        using EQType = chowdsp::EQ::EQProcessor<float, 4, chowdsp::EQ::DefaultEQBand<float>>;
+        EQType serialEQ, fusedEQ;
+        fusedEQ.setFusedProcessing (true);
+        REQUIRE (fusedEQ.isFusedProcessingEnabled());
+
+        for (auto* eq : { &serialEQ, &fusedEQ })
+        {
+            setEQParams (*eq);
+            eq->prepare ({ fs, (juce::uint32) blockSize, (juce::uint32) numChannels });
+        }
+
+        // the biquad and SVF structures have slightly different numerical behaviour
+        processAndCompare (serialEQ, fusedEQ, input, 0, numBlocks / 2, 1.0e-3f);
+
+        // with smoothed parameters, the fused EQ interpolates the coefficients, so it won't be exact
+        for (auto* eq : { &serialEQ, &fusedEQ })
+            setEQParams (*eq, 3.0f);
+        processAndCompare (serialEQ, fusedEQ, input, numBlocks / 2, numBlocks, 1.0e-2f);
+    }
+
+    SECTION ("Fused Processing Fallback Test")
+    {
+        using BandType = chowdsp::EQ::EQBand<float, chowdsp::SVFBell<float>, chowdsp::NthOrderFilter<float, 4>>;
+        using EQType = chowdsp::EQ::EQProcessor<float, 1, BandType>;
+        EQType serialEQ, fusedEQ;
+        fusedEQ.setFusedProcessing (true);
+
+        for (auto* eq : { &serialEQ, &fusedEQ })
+        {
+            eq->setCutoffFrequency (0, 2000.0f);
+            eq->setFilterType (0, 1);
+            eq->setBandOnOff (0, true);
+            eq->prepare ({ fs, (juce::uint32) blockSize, (juce::uint32) numChannels });
+        }
+
+        // NthOrderFilter is not biquad-compatible, so the fused EQ should fall back to serial processing
+        processAndCompare (serialEQ, fusedEQ, input, 0, numBlocks, 1.0e-6f);
+    }
+}
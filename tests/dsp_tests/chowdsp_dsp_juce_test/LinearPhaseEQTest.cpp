@@ -26,6 +26,27 @@ struct NotAFilter
     bool onOff = true;
 };
 
+struct ResonantFilter
+{
+    struct Params
+    {
+        float cutoff;
+    };
+
+    void prepare (const juce::dsp::ProcessSpec& spec)
+    {
+        fs = (float) spec.sampleRate;
+        filter.prepare ((int) spec.numChannels);
+    }
+
+    void reset() { filter.reset(); }
+
+    void processBlock (juce::AudioBuffer<float>& buffer) { filter.processBlock (buffer); }
+
+    chowdsp::SecondOrderLPF<float> filter;
+    float fs = 48000.0f;
+};
+
 TEST_CASE ("Linear Phase EQ Test", "[dsp][EQ]")
 {
     SECTION ("Process Test")
@@ -105,4 +126,100 @@ TEST_CASE ("Linear Phase EQ Test", "[dsp][EQ]")
             REQUIRE_MESSAGE (testEQ.getLatencySamples() == FIRLength, "Latency at 96 kHz is incorrect!");
         }
     }
+
+    SECTION ("Minimum Phase Test")
+    {
+        static constexpr int FIRLength = 128;
+        chowdsp::EQ::LinearPhaseEQ<NotAFilter, FIRLength> testEQ;
+        testEQ.updatePrototypeEQParameters = [] (auto& eq, auto& params)
+        { eq.onOff = params.onOff; };
+        testEQ.setPhaseMode (decltype (testEQ)::PhaseMode::Minimum);
+        testEQ.prepare ({ Constants::sampleRate, Constants::blockSize, 1 }, { true });
+        REQUIRE_MESSAGE (testEQ.getLatencySamples() == 0, "Reported latency is incorrect!");
+
+        juce::AudioBuffer<float> buffer (1, Constants::blockSize);
+        buffer.clear();
+        buffer.setSample (0, 0, 1.0f);
+        testEQ.processBlock (buffer);
+
+        REQUIRE_MESSAGE (buffer.getSample (0, 0) == Catch::Approx { 1.0f }.margin (1.0e-3f), "Minimum phase impulse is incorrect!");
+        REQUIRE_MESSAGE (buffer.getMagnitude (0, 1, FIRLength - 1) < 1.0e-3f, "Minimum phase IR should not have any delay!");
+    }
+
+    SECTION ("Mixed Phase Test")
+    {
+        static constexpr int FIRLength = 128;
+        chowdsp::EQ::LinearPhaseEQ<NotAFilter, FIRLength> testEQ;
+        testEQ.updatePrototypeEQParameters = [] (auto& eq, auto& params)
+        { eq.onOff = params.onOff; };
+        testEQ.setPhaseMode (decltype (testEQ)::PhaseMode::Mixed);
+        testEQ.prepare ({ Constants::sampleRate, Constants::blockSize, 1 }, { true });
+        REQUIRE_MESSAGE (testEQ.getLatencySamples() == FIRLength / 4, "Reported latency is incorrect!");
+
+        juce::AudioBuffer<float> buffer (1, Constants::blockSize);
+        buffer.clear();
+        buffer.setSample (0, 0, 1.0f);
+        testEQ.processBlock (buffer);
+
+        for (int i = 0; i < FIRLength; ++i)
+        {
+            const auto sample = buffer.getSample (0, i);
+
+            if (i == FIRLength / 4)
+                REQUIRE_MESSAGE (sample == Catch::Approx { 1.0f }.margin (1.0e-3f), "Shifted impulse is incorrect!");
+            else
+                REQUIRE_MESSAGE (std::abs (sample) < 1.0e-3f, "Signal other than the impulse was detected at index " + juce::String (i) + "!");
+        }
+    }
+
+    SECTION ("Mixed Phase Long Tail Test")
+    {
+        // the minimum phase part of this filter rings for longer than half the FIR length
+        static constexpr int FIRLength = 1024;
+        chowdsp::EQ::LinearPhaseEQ<ResonantFilter, FIRLength> testEQ;
+        testEQ.updatePrototypeEQParameters = [] (auto& eq, auto& params)
+        { eq.filter.calcCoefs (params.cutoff, 10.0f, eq.fs); };
+        testEQ.setPhaseMode (decltype (testEQ)::PhaseMode::Mixed);
+        testEQ.prepare ({ Constants::sampleRate, Constants::blockSize, 1 }, { 200.0f });
+
+        juce::AudioBuffer<float> buffer (1, FIRLength);
+        buffer.clear();
+        buffer.setSample (0, 0, 1.0f);
+        for (int start = 0; start < buffer.getNumSamples(); start += Constants::blockSize)
+            testEQ.processBlock (chowdsp::BufferView<float> { buffer, start, Constants::blockSize });
+
+        // the linear phase part is windowed to zero at the start of the IR, so if the convolution
+        // has not wrapped around, the first sample of the IR should be (very nearly) zero
+        const auto irPeak = buffer.getMagnitude (0, FIRLength);
+        REQUIRE (irPeak > 0.0f);
+        REQUIRE_MESSAGE (std::abs (buffer.getSample (0, 0)) < 1.0e-3f * irPeak, "Mixed phase IR has wrapped around!");
+    }
+
+    SECTION ("Non-Uniform Partitioning Test")
+    {
+        static constexpr int FIRLength = 256;
+        static constexpr int smallBlockSize = 16;
+        chowdsp::EQ::LinearPhaseEQ<NotAFilter, FIRLength> testEQ;
+        testEQ.updatePrototypeEQParameters = [] (auto& eq, auto& params)
+        { eq.onOff = params.onOff; };
+        testEQ.setTailPartitionSize (64);
+        testEQ.prepare ({ Constants::sampleRate, smallBlockSize, 1 }, { true });
+        REQUIRE_MESSAGE (testEQ.getLatencySamples() == FIRLength / 2, "Reported latency is incorrect!");
+
+        juce::AudioBuffer<float> buffer (1, 2 * FIRLength);
+        buffer.clear();
+        buffer.setSample (0, 0, 1.0f);
+        for (int start = 0; start < buffer.getNumSamples(); start += smallBlockSize)
+            testEQ.processBlock (chowdsp::BufferView<float> { buffer, start, smallBlockSize });
+
+        for (int i = 0; i < buffer.getNumSamples(); ++i)
+        {
+            const auto sample = buffer.getSample (0, i);
+
+            if (i == FIRLength / 2)
+                REQUIRE_MESSAGE (sample == Catch::Approx { 1.0f }.margin (1.0e-3f), "Shifted impulse is incorrect!");
+            else
+                REQUIRE_MESSAGE (std::abs (sample) < 1.0e-3f, "Signal other than the impulse was detected at index " + juce::String (i) + "!");
+        }
+    }
 }
@@ -0,0 +1,83 @@
+#include <CatchUtils.h>
+#include <chowdsp_filters/chowdsp_filters.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int numSamples = 2048;
+} // namespace
+
+template <typename FilterType, typename... Args>
+static void testBlockParallelFilter (typename FilterType::SampleType margin, Args... coefArgs)
+{
+    using T = typename FilterType::SampleType;
+
+    FilterType refFilter;
+    refFilter.prepare (1);
+    refFilter.calcCoefs (coefArgs...);
+
+    chowdsp::BlockParallelFilterWrapper<FilterType> filter;
+    filter.prepare (1);
+    filter.calcCoefs (coefArgs...);
+
+    auto refBuffer = test_utils::makeNoise<T> (numSamples);
+    chowdsp::Buffer<T> buffer { 1, numSamples };
+    chowdsp::BufferMath::copyBufferData (refBuffer, buffer);
+
+    refFilter.processBlock (refBuffer);
+
+    // use a variety of block sizes, including some that aren't a multiple of the SIMD width
+    for (int start = 0; start < numSamples;)
+    {
+        const auto blockSize = juce::jmin (numSamples - start, 1 + (start * 13) % 97);
+        filter.processBlock (chowdsp::BufferView<T> { buffer, start, blockSize });
+        start += blockSize;
+    }
+
+    for (int n = 0; n < numSamples; ++n)
+        REQUIRE (buffer.getReadPointer (0)[n] == Catch::Approx (refBuffer.getReadPointer (0)[n]).margin (margin));
+}
+
+TEMPLATE_TEST_CASE ("Block Parallel Filter Wrapper Test", "[dsp][filters]", float, double)
+{
+    using T = TestType;
+    const auto margin = std::is_same_v<T, float> ? (T) 1.0e-4 : (T) 1.0e-10;
+
+    SECTION ("First-Order LPF Test")
+    {
+        testBlockParallelFilter<chowdsp::FirstOrderLPF<T>> (margin, (T) 500, (T) fs);
+    }
+
+    SECTION ("Second-Order HPF Test")
+    {
+        testBlockParallelFilter<chowdsp::SecondOrderHPF<T>> (margin, (T) 100, (T) 0.7071, (T) fs);
+    }
+
+    SECTION ("Peaking Filter Test")
+    {
+        testBlockParallelFilter<chowdsp::PeakingFilter<T>> (margin, (T) 2000, (T) 4, (T) 2, (T) fs);
+    }
+
+    SECTION ("Third-Order IIR Test")
+    {
+        chowdsp::IIRFilter<3, T> refFilter;
+        chowdsp::BlockParallelFilterWrapper<chowdsp::IIRFilter<3, T>> filter;
+
+        // third-order Butterworth lowpass at fs / 8
+        const T b[] = { (T) 0.01809893, (T) 0.05429679, (T) 0.05429679, (T) 0.01809893 };
+        const T a[] = { (T) 1, (T) -1.76004188, (T) 1.18289326, (T) -0.27805992 };
+        refFilter.setCoefs (b, a);
+        filter.setCoefs (b, a);
+        filter.prepare (1);
+
+        auto refBuffer = test_utils::makeNoise<T> (numSamples);
+        chowdsp::Buffer<T> buffer { 1, numSamples };
+        chowdsp::BufferMath::copyBufferData (refBuffer, buffer);
+
+        refFilter.processBlock (refBuffer);
+        filter.processBlock (buffer);
+
+        for (int n = 0; n < numSamples; ++n)
+            REQUIRE (buffer.getReadPointer (0)[n] == Catch::Approx (refBuffer.getReadPointer (0)[n]).margin (margin));
+    }
+}
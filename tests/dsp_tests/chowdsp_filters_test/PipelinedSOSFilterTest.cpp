@@ -0,0 +1,119 @@
+#include <CatchUtils.h>
+#include <chowdsp_filters/chowdsp_filters.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int numSamples = 4096;
+} // namespace
+
+template <typename T, typename ReferenceFilter>
+static void compareWithReference (ReferenceFilter& refFilter, chowdsp::PipelinedSOSFilter<T>& filter, int numChannels, T margin)
+{
+    auto refBuffer = test_utils::makeNoise<T> (numSamples, numChannels);
+    chowdsp::Buffer<T> buffer { numChannels, numSamples };
+    chowdsp::BufferMath::copyBufferData (refBuffer, buffer);
+
+    refFilter.prepare (numChannels);
+    refFilter.reset();
+    refFilter.processBlock (refBuffer);
+
+    // use a variety of block sizes, including some smaller than the SIMD width
+    for (int start = 0; start < numSamples;)
+    {
+        const auto blockSize = juce::jmin (numSamples - start, 1 + (start * 7) % 301);
+        filter.processBlock (chowdsp::BufferView<T> { buffer, start, blockSize });
+        start += blockSize;
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < numSamples; ++n)
+            REQUIRE (buffer.getReadPointer (ch)[n] == Catch::Approx (refBuffer.getReadPointer (ch)[n]).margin (margin));
+}
+
+TEMPLATE_TEST_CASE ("Pipelined SOS Filter Test", "[dsp][filters]", float, double)
+{
+    using T = TestType;
+    const auto margin = std::is_same_v<T, float> ? (T) 1.0e-4 : (T) 1.0e-10;
+
+    SECTION ("Single Section Test")
+    {
+        chowdsp::ButterworthFilter<2, chowdsp::ButterworthFilterType::Lowpass, T> refFilter;
+        refFilter.calcCoefs ((T) 1000, (T) 1 / juce::MathConstants<T>::sqrt2, (T) fs);
+
+        chowdsp::PipelinedSOSFilter<T> filter;
+        filter.prepare (1, 2);
+        filter.setCoefs (refFilter);
+        REQUIRE (filter.getOrder() == 2);
+        REQUIRE (filter.getNumSections() == 1);
+
+        compareWithReference (refFilter, filter, 1, margin);
+    }
+
+    SECTION ("High Order Test")
+    {
+        chowdsp::ButterworthFilter<20, chowdsp::ButterworthFilterType::Highpass, T> refFilter;
+        refFilter.calcCoefs ((T) 500, (T) 1 / juce::MathConstants<T>::sqrt2, (T) fs);
+
+        chowdsp::PipelinedSOSFilter<T> filter;
+        filter.prepare (2, 20);
+        filter.setCoefs (refFilter);
+        REQUIRE (filter.getNumSections() == 10);
+
+        compareWithReference (refFilter, filter, 2, margin);
+    }
+
+    SECTION ("Odd Order Butterworth Test")
+    {
+        chowdsp::ButterworthFilter<7, chowdsp::ButterworthFilterType::Lowpass, T> refFilter;
+        refFilter.calcCoefs ((T) 2000, (T) 1 / juce::MathConstants<T>::sqrt2, (T) fs);
+
+        // the first-order section should be copied along with the second-order sections
+        chowdsp::PipelinedSOSFilter<T> filter;
+        filter.prepare (2, 7);
+        filter.setCoefs (refFilter);
+        REQUIRE (filter.getNumSections() == 4);
+
+        compareWithReference (refFilter, filter, 2, margin);
+    }
+
+    SECTION ("Odd Order Test")
+    {
+        struct OddOrderReference
+        {
+            chowdsp::ButterworthFilter<6, chowdsp::ButterworthFilterType::Lowpass, T> sos;
+            chowdsp::FirstOrderLPF<T> firstOrder;
+
+            void prepare (int numChannels)
+            {
+                sos.prepare (numChannels);
+                firstOrder.prepare (numChannels);
+            }
+
+            void reset()
+            {
+                sos.reset();
+                firstOrder.reset();
+            }
+
+            void processBlock (const chowdsp::BufferView<T>& buffer)
+            {
+                sos.processBlock (buffer);
+                firstOrder.processBlock (buffer);
+            }
+        } refFilter;
+        refFilter.sos.calcCoefs ((T) 2000, (T) 1 / juce::MathConstants<T>::sqrt2, (T) fs);
+        refFilter.firstOrder.calcCoefs ((T) 2000, (T) fs);
+
+        T bCoefs[2], aCoefs[2];
+        chowdsp::CoefficientCalculators::calcFirstOrderLPF (bCoefs, aCoefs, (T) 2000, (T) fs);
+
+        chowdsp::PipelinedSOSFilter<T> filter;
+        filter.prepare (1, 7);
+        filter.setCoefs (refFilter.sos);
+        filter.setFirstOrderCoefs (3, bCoefs, aCoefs);
+        REQUIRE (filter.getNumSections() == 4);
+
+        compareWithReference (refFilter, filter, 1, margin);
+    }
+}
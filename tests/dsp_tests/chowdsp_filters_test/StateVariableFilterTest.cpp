@@ -112,4 +112,47 @@ TEMPLATE_TEST_CASE ("State Variable Filter Test", "[dsp][filters][simd]", float,
         testFrequency<T> (filter, (NumericType) fc, (NumericType) gainDB * (NumericType) 0.5, maxError, "Incorrect gain at cutoff frequency.");
         testFrequency<T> (filter, (NumericType) fs * (NumericType) 0.498, (NumericType) gainDB, maxError, "Incorrect gain at high frequencies.");
     }
+
+    SECTION ("Biquad Coefficients Test")
+    {
+        using namespace Constants;
+        const auto testBiquadCoefficients = [] (auto& filter)
+        {
+            filter.prepare ({ (double) fs, 2048, 1 });
+            filter.setCutoffFrequency ((T) fc);
+            filter.setQValue ((T) Qval);
+            filter.setGainDecibels ((T) gainDB);
+
+            T b[3], a[3];
+            filter.getBiquadCoefficients (b, a);
+            chowdsp::IIRFilter<2, T> biquad;
+            biquad.setCoefs (b, a);
+
+            auto buffer = test_utils::makeNoise<T> (1000);
+            auto refBuffer = test_utils::makeNoise<T> (1000);
+            chowdsp::BufferMath::copyBufferData (buffer, refBuffer);
+
+            filter.processBlock (buffer);
+            biquad.processBlock (refBuffer);
+            for (int n = 0; n < buffer.getNumSamples(); ++n)
+                REQUIRE (buffer.getReadPointer (0)[n] == SIMDApprox<T> (refBuffer.getReadPointer (0)[n]).margin ((NumericType) 1.0e-4));
+        };
+
+        chowdsp::SVFLowpass<T> lpf;
+        testBiquadCoefficients (lpf);
+        chowdsp::SVFHighpass<T> hpf;
+        testBiquadCoefficients (hpf);
+        chowdsp::SVFBandpass<T> bpf;
+        testBiquadCoefficients (bpf);
+        chowdsp::SVFNotch<T> notch;
+        testBiquadCoefficients (notch);
+        chowdsp::SVFAllpass<T> apf;
+        testBiquadCoefficients (apf);
+        chowdsp::SVFBell<T> bell;
+        testBiquadCoefficients (bell);
+        chowdsp::SVFLowShelf<T> lowShelf;
+        testBiquadCoefficients (lowShelf);
+        chowdsp::SVFHighShelf<T> highShelf;
+        testBiquadCoefficients (highShelf);
+    }
 }
@@ -0,0 +1,173 @@
+#include <numeric>
+#include "CatchUtils.h"
+#include <chowdsp_sources/chowdsp_sources.h>
+
+namespace
+{
+constexpr int numTestSamples = 1 << 16;
+
+template <typename T>
+std::pair<T, T> getMeanAndVariance (const T* data, int numSamples)
+{
+    const auto mean = std::accumulate (data, data + numSamples, (T) 0) / (T) numSamples;
+    const auto variance = std::accumulate (data, data + numSamples, (T) 0, [mean] (T acc, T x)
+                                           { return acc + (x - mean) * (x - mean); })
+                          / (T) numSamples;
+    return { mean, variance };
+}
+} // namespace
+
+TEMPLATE_TEST_CASE ("Noise Generator Test", "[dsp][sources]", float, double)
+{
+    using Generator = chowdsp::NoiseGenerator<TestType>;
+
+    SECTION ("Uniform Distribution Test")
+    {
+        Generator noise;
+        noise.setNoiseType (Generator::NoiseType::Uniform);
+        noise.prepare (1, numTestSamples);
+
+        chowdsp::Buffer<TestType> buffer (1, numTestSamples);
+        buffer.clear();
+        noise.processBlock (buffer);
+
+        const auto* data = buffer.getReadPointer (0);
+        REQUIRE (*std::min_element (data, data + numTestSamples) >= (TestType) -1);
+        REQUIRE (*std::max_element (data, data + numTestSamples) < (TestType) 1);
+
+        const auto [mean, variance] = getMeanAndVariance (data, numTestSamples);
+        REQUIRE (mean == Catch::Approx (0.0).margin (0.02));
+        REQUIRE (variance == Catch::Approx (1.0 / 3.0).margin (0.02));
+    }
+
+    SECTION ("Normal Distribution Test")
+    {
+        Generator noise;
+        noise.setNoiseType (Generator::NoiseType::Normal);
+        noise.prepare (1, numTestSamples);
+
+        chowdsp::Buffer<TestType> buffer (1, numTestSamples);
+        buffer.clear();
+        noise.processBlock (buffer);
+
+        const auto [mean, variance] = getMeanAndVariance (buffer.getReadPointer (0), numTestSamples);
+        REQUIRE (mean == Catch::Approx (0.0).margin (0.02));
+        REQUIRE (variance == Catch::Approx (0.5).margin (0.02));
+    }
+
+    SECTION ("Pink Noise Test")
+    {
+        Generator noise;
+        noise.setNoiseType (Generator::NoiseType::Pink);
+        noise.prepare (1, numTestSamples);
+
+        chowdsp::Buffer<TestType> buffer (1, numTestSamples);
+        buffer.clear();
+        noise.processBlock (buffer);
+
+        const auto* data = buffer.getReadPointer (0);
+        REQUIRE (*std::min_element (data, data + numTestSamples) >= (TestType) -0.5);
+        REQUIRE (*std::max_element (data, data + numTestSamples) <= (TestType) 0.5);
+
+        // pink noise should be much more correlated from sample to sample than white noise
+        TestType lag1Corr = 0, energy = 0;
+        for (int n = 1; n < numTestSamples; ++n)
+        {
+            lag1Corr += data[n] * data[n - 1];
+            energy += data[n] * data[n];
+        }
+        REQUIRE (lag1Corr / energy > (TestType) 0.5);
+    }
+
+    SECTION ("Gain Test")
+    {
+        Generator noise;
+        noise.setGainLinear ((TestType) 0.5);
+        REQUIRE (noise.getGainLinear() == (TestType) 0.5);
+        noise.prepare (1, numTestSamples);
+
+        chowdsp::Buffer<TestType> buffer (1, numTestSamples);
+        buffer.clear();
+        noise.processBlock (buffer);
+
+        const auto* data = buffer.getReadPointer (0);
+        REQUIRE (*std::min_element (data, data + numTestSamples) >= (TestType) -0.5);
+        REQUIRE (*std::max_element (data, data + numTestSamples) < (TestType) 0.5);
+    }
+
+    SECTION ("Determinism Test")
+    {
+        for (auto noiseType : { Generator::NoiseType::Uniform, Generator::NoiseType::Normal, Generator::NoiseType::Pink })
+        {
+            static constexpr int numSamples = 1000;
+            chowdsp::Buffer<TestType> buffer1 (1, numSamples);
+            chowdsp::Buffer<TestType> buffer2 (1, numSamples);
+            buffer1.clear();
+            buffer2.clear();
+
+            // same seed, different block sizes
+            Generator noise1 { 1234 };
+            noise1.setNoiseType (noiseType);
+            noise1.prepare (1, numSamples);
+            noise1.processBlock (buffer1);
+
+            Generator noise2 { 1234 };
+            noise2.setNoiseType (noiseType);
+            noise2.prepare (1, numSamples);
+            for (int start = 0; start < numSamples;)
+            {
+                const auto blockSize = juce::jmin (numSamples - start, 1 + start % 37);
+                noise2.processBlock (chowdsp::BufferView<TestType> { buffer2, start, blockSize });
+                start += blockSize;
+            }
+
+            for (int n = 0; n < numSamples; ++n)
+                REQUIRE (buffer1.getReadPointer (0)[n] == buffer2.getReadPointer (0)[n]);
+
+            // reset should start the sequence over
+            buffer2.clear();
+            noise1.reset();
+            noise1.processBlock (buffer2);
+            for (int n = 0; n < numSamples; ++n)
+                REQUIRE (buffer1.getReadPointer (0)[n] == buffer2.getReadPointer (0)[n]);
+
+            // different seed should give a different sequence
+            buffer2.clear();
+            noise1.setSeed (4321);
+            noise1.processBlock (buffer2);
+            REQUIRE (buffer1.getReadPointer (0)[0] != buffer2.getReadPointer (0)[0]);
+        }
+    }
+
+    SECTION ("Multi-Channel Determinism Test")
+    {
+        for (auto noiseType : { Generator::NoiseType::Uniform, Generator::NoiseType::Normal, Generator::NoiseType::Pink })
+        {
+            static constexpr int numChannels = 2;
+            static constexpr int numSamples = 1000;
+            chowdsp::Buffer<TestType> buffer1 (numChannels, numSamples);
+            chowdsp::Buffer<TestType> buffer2 (numChannels, numSamples);
+            buffer1.clear();
+            buffer2.clear();
+
+            // same seed, one block vs. ten blocks
+            Generator noise1 { 42 };
+            noise1.setNoiseType (noiseType);
+            noise1.prepare (numChannels, numSamples);
+            noise1.processBlock (buffer1);
+
+            Generator noise2 { 42 };
+            noise2.setNoiseType (noiseType);
+            noise2.prepare (numChannels, numSamples / 10);
+            for (int start = 0; start < numSamples; start += numSamples / 10)
+                noise2.processBlock (chowdsp::BufferView<TestType> { buffer2, start, numSamples / 10 });
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                for (int n = 0; n < numSamples; ++n)
+                    REQUIRE (buffer1.getReadPointer (ch)[n] == buffer2.getReadPointer (ch)[n]);
+
+            // each channel should get a different noise sequence
+            REQUIRE (buffer1.getReadPointer (0)[0] != buffer1.getReadPointer (1)[0]);
+        }
+    }
+}
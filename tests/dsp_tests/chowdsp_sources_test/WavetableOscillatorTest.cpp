@@ -0,0 +1,238 @@
+#include "CatchUtils.h"
+#include <chowdsp_sources/chowdsp_sources.h>
+
+namespace
+{
+constexpr auto _sampleRate = 1000.0;
+constexpr auto _blockSize = 512;
+constexpr auto testFreq = 100.0f;
+constexpr int tableSize = 256;
+
+std::vector<float> makeSineFrame (float gain = 1.0f)
+{
+    std::vector<float> frame (tableSize);
+    for (auto [n, x] : chowdsp::enumerate (frame))
+        x = gain * std::sin (juce::MathConstants<float>::twoPi * (float) n / (float) tableSize);
+    return frame;
+}
+
+std::vector<float> makeSawFrame()
+{
+    std::vector<float> frame (tableSize);
+    for (auto [n, x] : chowdsp::enumerate (frame))
+        x = 2.0f * (float) n / (float) tableSize - 1.0f;
+    return frame;
+}
+
+/** Returns the magnitude of a harmonic in a single-cycle table */
+float getHarmonicMagnitude (const float* table, int harmonic)
+{
+    std::complex<double> sum {};
+    for (int n = 0; n < tableSize; ++n)
+        sum += (double) table[n] * std::polar (1.0, -juce::MathConstants<double>::twoPi * harmonic * n / (double) tableSize);
+    return (float) std::abs (sum) * 2.0f / (float) tableSize;
+}
+} // namespace
+
+TEST_CASE ("Wavetable Oscillator Test", "[dsp][sources]")
+{
+    SECTION ("Mip-Map Test")
+    {
+        const auto sawFrame = makeSawFrame();
+        chowdsp::Wavetable wavetable;
+        REQUIRE (wavetable.generate ({ sawFrame }));
+        REQUIRE_MESSAGE (! wavetable.generate ({ makeSawFrame() }), "Wavetable should only be generated once!");
+        REQUIRE (wavetable.isReady());
+        REQUIRE (wavetable.getNumLevels() == 8);
+
+        for (int level = 0; level < wavetable.getNumLevels(); ++level)
+        {
+            const auto* table = wavetable.getTable (level, 0);
+            const auto numHarmonics = wavetable.getNumHarmonics (level);
+
+            // harmonics below the limit should be unchanged
+            REQUIRE (getHarmonicMagnitude (table, 1) == Catch::Approx (getHarmonicMagnitude (sawFrame.data(), 1)).margin (1.0e-4f));
+            REQUIRE (getHarmonicMagnitude (table, numHarmonics) == Catch::Approx (getHarmonicMagnitude (sawFrame.data(), numHarmonics)).margin (1.0e-4f));
+            if (numHarmonics < tableSize / 2 - 1)
+                REQUIRE_MESSAGE (getHarmonicMagnitude (table, numHarmonics + 1) < 1.0e-4f, "Harmonics above the limit should be removed!");
+
+            REQUIRE_MESSAGE (table[tableSize] == table[0], "Incorrect guard sample!");
+        }
+    }
+
+    SECTION ("Wavetable Cache Test")
+    {
+        chowdsp::WavetableCache cache;
+        auto& wavetable = cache.addWavetable ("sine");
+        REQUIRE (&cache.addWavetable ("sine") == &wavetable);
+        REQUIRE (&cache.addWavetable ("saw") != &wavetable);
+
+        REQUIRE (wavetable.generateAsync ({ makeSineFrame() }));
+        REQUIRE_MESSAGE (! wavetable.generateAsync ({ makeSineFrame() }), "Wavetable should only be generated once!");
+        wavetable.waitUntilReady();
+        REQUIRE (wavetable.isReady());
+        REQUIRE (wavetable.getNumFrames() == 1);
+        REQUIRE (wavetable.getTableSize() == tableSize);
+
+        cache.clearCache();
+    }
+
+    SECTION ("Reference Test")
+    {
+        chowdsp::Wavetable wavetable;
+        wavetable.generate ({ makeSineFrame() });
+
+        chowdsp::WavetableOscillator<float> testOsc;
+        testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        testOsc.setWavetable (&wavetable);
+        testOsc.setFrequency (testFreq);
+        REQUIRE_MESSAGE (testOsc.getFrequency() == testFreq, "Set frequency is incorrect!");
+
+        for (int n = 0; n < 50; ++n)
+        {
+            const auto expected = std::sin (juce::MathConstants<float>::twoPi * testFreq * (float) n / (float) _sampleRate);
+            REQUIRE_MESSAGE (testOsc.processSample() == Catch::Approx (expected).margin (1.0e-3f), "Generated sample is incorrect!");
+        }
+    }
+
+    SECTION ("Negative Frequency Test")
+    {
+        chowdsp::Wavetable wavetable;
+        wavetable.generate ({ makeSineFrame() });
+
+        chowdsp::WavetableOscillator<float> testOsc;
+        testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        testOsc.setWavetable (&wavetable);
+        testOsc.setFrequency (-testFreq);
+
+        for (int n = 0; n < 50; ++n)
+        {
+            const auto expected = -std::sin (juce::MathConstants<float>::twoPi * testFreq * (float) n / (float) _sampleRate);
+            REQUIRE_MESSAGE (testOsc.processSample() == Catch::Approx (expected).margin (1.0e-3f), "Generated sample is incorrect!");
+        }
+    }
+
+    SECTION ("Above Sample Rate Test")
+    {
+        chowdsp::Wavetable wavetable;
+        wavetable.generate ({ makeSineFrame() });
+
+        // frequencies above the sample rate should alias back down, without the phase growing out of range
+        chowdsp::WavetableOscillator<float> testOsc;
+        testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        testOsc.setWavetable (&wavetable);
+        testOsc.setFrequency (3.0f * (float) _sampleRate + testFreq);
+
+        for (int n = 0; n < 1000; ++n)
+        {
+            const auto expected = std::sin (juce::MathConstants<float>::twoPi * testFreq * (float) n / (float) _sampleRate);
+            REQUIRE_MESSAGE (testOsc.processSample() == Catch::Approx (expected).margin (2.0e-3f), "Generated sample is incorrect!");
+        }
+    }
+
+    SECTION ("Mip Level Selection Test")
+    {
+        chowdsp::Wavetable wavetable;
+        wavetable.generate ({ makeSawFrame() });
+
+        // 8 samples per cycle, so only the first 4 harmonics can be used (mip level 5)
+        chowdsp::WavetableOscillator<float> testOsc;
+        testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        testOsc.setWavetable (&wavetable);
+        testOsc.setFrequency ((float) _sampleRate / 8.0f);
+
+        const auto* expectedTable = wavetable.getTable (5, 0);
+        for (int n = 0; n < 24; ++n)
+            REQUIRE_MESSAGE (testOsc.processSample() == Catch::Approx (expectedTable[(n * tableSize / 8) % tableSize]).margin (1.0e-6f), "Incorrect mip level!");
+    }
+
+    SECTION ("Frame Crossfade Test")
+    {
+        chowdsp::Wavetable wavetable;
+        wavetable.generate ({ makeSineFrame (1.0f), makeSineFrame (-1.0f), makeSineFrame (0.5f) });
+
+        chowdsp::WavetableOscillator<float> testOsc;
+        testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        testOsc.setWavetable (&wavetable);
+        testOsc.setFrequency (testFreq);
+
+        // (frame position, expected gain)
+        static constexpr std::array<std::pair<float, float>, 5> testCases { { { 0.0f, 1.0f }, { 0.25f, 0.0f }, { 0.5f, -1.0f }, { 0.75f, -0.25f }, { 1.0f, 0.5f } } };
+        for (auto [framePosition, gain] : testCases)
+        {
+            testOsc.setFramePosition (framePosition);
+            testOsc.reset();
+            for (int n = 0; n < 20; ++n)
+            {
+                const auto expected = gain * std::sin (juce::MathConstants<float>::twoPi * testFreq * (float) n / (float) _sampleRate);
+                REQUIRE_MESSAGE (testOsc.processSample() == Catch::Approx (expected).margin (1.0e-3f), "Incorrect frame crossfade!");
+            }
+        }
+    }
+
+    SECTION ("SIMD Test")
+    {
+        chowdsp::Wavetable wavetable;
+        wavetable.generate ({ makeSawFrame(), makeSineFrame() });
+
+        using Vec = xsimd::batch<float>;
+        alignas (xsimd::default_arch::alignment()) std::array<float, Vec::size> freqs {};
+        alignas (xsimd::default_arch::alignment()) std::array<float, Vec::size> framePositions {};
+        for (size_t i = 0; i < Vec::size; ++i)
+        {
+            freqs[i] = (i % 2 == 0 ? 20.0f : -20.0f) * std::pow (2.0f, (float) i * 0.5f);
+            framePositions[i] = (float) i / (float) Vec::size;
+        }
+
+        chowdsp::WavetableOscillator<Vec> simdOsc;
+        simdOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        simdOsc.setWavetable (&wavetable);
+        simdOsc.setFrequency (xsimd::load_aligned (freqs.data()));
+        simdOsc.setFramePosition (xsimd::load_aligned (framePositions.data()));
+
+        chowdsp::Buffer<Vec> simdBuffer (1, _blockSize);
+        simdBuffer.clear();
+        simdOsc.processBlock (simdBuffer);
+
+        for (size_t i = 0; i < Vec::size; ++i)
+        {
+            chowdsp::WavetableOscillator<float> testOsc;
+            testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+            testOsc.setWavetable (&wavetable);
+            testOsc.setFrequency (freqs[i]);
+            testOsc.setFramePosition (framePositions[i]);
+
+            chowdsp::Buffer<float> buffer (1, _blockSize);
+            buffer.clear();
+            testOsc.processBlock (buffer);
+
+            for (int n = 0; n < _blockSize; ++n)
+                REQUIRE_MESSAGE (simdBuffer.getReadPointer (0)[n].get (i) == Catch::Approx (buffer.getReadPointer (0)[n]).margin (1.0e-6f), "SIMD output is incorrect!");
+        }
+    }
+
+    SECTION ("Not Ready Test")
+    {
+        chowdsp::Wavetable wavetable;
+
+        chowdsp::WavetableOscillator<float> testOsc;
+        testOsc.prepare ({ _sampleRate, (juce::uint32) _blockSize, 1 });
+        testOsc.setWavetable (&wavetable);
+        testOsc.setFrequency (testFreq);
+
+        chowdsp::Buffer<float> buffer (1, _blockSize);
+        juce::FloatVectorOperations::fill (buffer.getWritePointer (0), 1.0f, _blockSize);
+        testOsc.processBlock (buffer);
+        for (int n = 0; n < _blockSize; ++n)
+            REQUIRE_MESSAGE (buffer.getReadPointer (0)[n] == 1.0f, "Oscillator should be silent until the wavetable is ready!");
+
+        // the oscillator should start once the wavetable has been generated
+        wavetable.generate ({ makeSineFrame() });
+        testOsc.reset();
+        for (int n = 0; n < 20; ++n)
+        {
+            const auto expected = std::sin (juce::MathConstants<float>::twoPi * testFreq * (float) n / (float) _sampleRate);
+            REQUIRE_MESSAGE (testOsc.processSample() == Catch::Approx (expected).margin (1.0e-3f), "Generated sample is incorrect!");
+        }
+    }
+}
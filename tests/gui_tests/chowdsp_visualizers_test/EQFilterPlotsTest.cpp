@@ -29,8 +29,41 @@ public:
                                        1.0e-2f,
                                        "Incorrect magnitude at frequency: " + juce::String (freq));
         }
+
+        // repeat the test values a few times, so that both the SIMD and scalar paths get tested
+        std::vector<float> frequencies;
+        std::vector<float> expectedMagsDB;
+        for (int i = 0; i < 5; ++i)
+        {
+            for (auto [freq, expectedMag] : config.testVals)
+            {
+                frequencies.push_back (freq);
+                expectedMagsDB.push_back (expectedMag);
+            }
+        }
+
+        std::vector<float> magsDB (frequencies.size(), 0.0f);
+        plot.accumulateMagnitudesDecibels (frequencies.data(), magsDB.data(), (int) magsDB.size());
+        for (size_t n = 0; n < magsDB.size(); ++n)
+        {
+            expectWithinAbsoluteError (magsDB[n],
+                                       expectedMagsDB[n],
+                                       1.0e-2f,
+                                       "Incorrect batch magnitude at frequency: " + juce::String (frequencies[n]));
+        }
     }
 
+    /** A custom plot that only overrides getMagnitudeForFrequency(), so it should use the default batch implementation. */
+    struct CustomPlot : chowdsp::EQ::EQFilterPlot
+    {
+        [[nodiscard]] float getMagnitudeForFrequency (float freqHz) const override
+        {
+            if (freqHz < 500.0f)
+                return 1.0f;
+            return freqHz < 5000.0f ? 0.5f : 0.0f;
+        }
+    };
+
     const float m3DB = juce::Decibels::gainToDecibels (1.0f / juce::MathConstants<float>::sqrt2);
     const float m6DB = juce::Decibels::gainToDecibels (0.5f);
 
@@ -74,6 +107,9 @@ public:
 
         beginTest ("High-Shelf Test");
         testFilterPlot<chowdsp::EQ::HighShelfPlot> ({ { { 1.0f, 0.0f }, { 1000.0f, 5.0f }, { 100000.0f, 10.0f } }, 10.0f });
+
+        beginTest ("Custom Plot Test");
+        testFilterPlot<CustomPlot> ({ { { 1.0f, 0.0f }, { 1000.0f, m6DB }, { 100000.0f, -200.0f } } });
     }
 };
 
@@ -0,0 +1,105 @@
+#include <TimedUnitTest.h>
+#include <chowdsp_visualizers/chowdsp_visualizers.h>
+
+class SpectrumAnalyserTest : public TimedUnitTest
+{
+public:
+    SpectrumAnalyserTest() : TimedUnitTest ("Spectrum Analyser Test") {}
+
+    static void pushSineWave (chowdsp::SpectrumAnalyserTask& task, float freqHz, float amplitude, double sampleRate, int numSamples)
+    {
+        juce::AudioBuffer<float> buffer { 2, numSamples };
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* x = buffer.getWritePointer (ch);
+            for (int n = 0; n < numSamples; ++n)
+                x[n] = amplitude * std::sin (juce::MathConstants<float>::twoPi * freqHz * (float) n / (float) sampleRate);
+        }
+
+        task.pushSamples (buffer);
+    }
+
+    template <typename Predicate>
+    static bool waitForSpectrum (chowdsp::SpectrumAnalyserTask& task, std::vector<float>& spectrumDB, std::vector<float>& peakHoldDB, Predicate&& isReady)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            if (task.getLatestSpectrum (spectrumDB, peakHoldDB) && isReady())
+                return true;
+            juce::Thread::sleep (10);
+        }
+        return false;
+    }
+
+    void sineWaveTest()
+    {
+        static constexpr double fs = 48000.0;
+
+        chowdsp::SpectrumAnalyserTask task {};
+        task.prepare (fs, 8192, 2);
+        task.setFrequencyGrid ({ 100.0f, 1000.0f, 10000.0f });
+        task.setShouldBeRunning (true);
+
+        pushSineWave (task, 1000.0f, 0.5f, fs, 8192);
+
+        std::vector<float> spectrumDB, peakHoldDB;
+        const auto gotSpectrum = waitForSpectrum (task, spectrumDB, peakHoldDB, [&]
+                                                  { return spectrumDB.size() == 3 && spectrumDB[1] > -10.0f; });
+        expect (gotSpectrum, "Spectrum was not computed!");
+
+        if (gotSpectrum)
+        {
+            expectWithinAbsoluteError (spectrumDB[1], juce::Decibels::gainToDecibels (0.5f), 1.0f, "Sine wave magnitude is incorrect!");
+            expectLessThan (spectrumDB[0], -60.0f, "Low frequency magnitude is too large!");
+            expectLessThan (spectrumDB[2], -60.0f, "High frequency magnitude is too large!");
+            for (size_t i = 0; i < spectrumDB.size(); ++i)
+                expectGreaterOrEqual (peakHoldDB[i], spectrumDB[i], "Peak hold should be greater than the spectrum!");
+        }
+
+        // after the sine wave stops, the spectrum should fall faster than the peak-hold spectrum
+        bool gotDecay = false;
+        for (int i = 0; i < 100 && ! gotDecay; ++i)
+        {
+            pushSineWave (task, 1000.0f, 0.0f, fs, 1024);
+            juce::Thread::sleep (10);
+            gotDecay = task.getLatestSpectrum (spectrumDB, peakHoldDB) && spectrumDB.size() == 3 && spectrumDB[1] < -20.0f;
+        }
+        expect (gotDecay, "Spectrum did not decay!");
+
+        if (gotDecay)
+            expectGreaterThan (peakHoldDB[1], spectrumDB[1], "Peak hold spectrum should decay slower than the spectrum!");
+
+        task.setShouldBeRunning (false);
+    }
+
+    void componentTest()
+    {
+        static constexpr double fs = 96000.0;
+
+        chowdsp::SpectrumAnalyserTask task {};
+        task.prepare (fs, 512, 1);
+
+        chowdsp::SpectrumAnalyser analyser { task };
+        analyser.setSize (500, 300);
+        expect (task.isTaskRunning(), "Analyser task should be running!");
+
+        pushSineWave (task, 2000.0f, 1.0f, fs, task.getFFTSize());
+        for (int i = 0; i < 50 && analyser.getSpectrumPath().isEmpty(); ++i)
+            juce::MessageManager::getInstance()->runDispatchLoopUntil (20);
+
+        expect (! analyser.getSpectrumPath().isEmpty(), "Spectrum path was not computed!");
+        expect (! analyser.getPeakHoldPath().isEmpty(), "Peak hold path was not computed!");
+        expectWithinAbsoluteError (analyser.getSpectrumPath().getBounds().getWidth(), 500.0f, 1.0f, "Spectrum path has the wrong width!");
+    }
+
+    void runTestTimed() override
+    {
+        beginTest ("Sine Wave Test");
+        sineWaveTest();
+
+        beginTest ("Component Test");
+        componentTest();
+    }
+};
+
+static SpectrumAnalyserTest spectrumAnalyserTest;
@@ -0,0 +1,170 @@
+#include <TimedUnitTest.h>
+#include <chowdsp_plugin_base/chowdsp_plugin_base.h>
+
+namespace
+{
+/** Test plugin that records the sub-blocks it is asked to process */
+class EventsTestPlugin : public chowdsp::PluginBase<EventsTestPlugin>
+{
+public:
+    EventsTestPlugin() = default;
+
+    static void addParameters (Parameters& params)
+    {
+        chowdsp::ParamUtils::createPercentParameter (params, "param1", "Param 1", 0.0f);
+        chowdsp::ParamUtils::createPercentParameter (params, "param2", "Param 2", 0.0f);
+    }
+
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override
+    {
+        setRateAndBufferSizeDetails (sampleRate, samplesPerBlock);
+        paramBuffer.resize ((size_t) samplesPerBlock);
+    }
+
+    void releaseResources() override {}
+
+    void processAudioBlock (juce::AudioBuffer<float>& buffer) override
+    {
+        auto& param = getParam (0);
+        subBlocks.push_back ({ buffer.getNumSamples(), param.getCurrentValue() });
+
+        if (renderParameterBuffer (param, paramBuffer.data(), buffer.getNumSamples()))
+            juce::FloatVectorOperations::copy (buffer.getWritePointer (0), paramBuffer.data(), buffer.getNumSamples());
+        else
+            juce::FloatVectorOperations::fill (buffer.getWritePointer (0), param.getCurrentValue(), buffer.getNumSamples());
+    }
+
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+
+    chowdsp::FloatParameter& getParam (int index)
+    {
+        return *dynamic_cast<chowdsp::FloatParameter*> (getParameters()[index]);
+    }
+
+    std::vector<std::pair<int, float>> subBlocks;
+    std::vector<float> paramBuffer;
+};
+} // namespace
+
+class ParameterEventListTest : public TimedUnitTest
+{
+public:
+    ParameterEventListTest() : TimedUnitTest ("Parameter Event List Test") {}
+
+    void sortingTest()
+    {
+        chowdsp::ParameterEventList events { 4 };
+        expect (events.addEvent ({ 10, 0 }));
+        expect (events.addEvent ({ 5, 1 }));
+        expect (events.addEvent ({ 10, 2 }));
+        expect (events.addEvent ({ 0, 3 }));
+        expect (! events.addEvent ({ 1, 4 }), "Event list should be full!");
+
+        expectEquals (events.size(), 4, "Incorrect number of events!");
+        const int expectedOffsets[] = { 0, 5, 10, 10 };
+        const int expectedParams[] = { 3, 1, 0, 2 }; // events at the same time should stay in order
+        for (int i = 0; i < events.size(); ++i)
+        {
+            expectEquals (events[i].sampleOffset, expectedOffsets[i], "Event offset is incorrect!");
+            expectEquals (events[i].parameterIndex, expectedParams[i], "Event parameter is incorrect!");
+        }
+
+        expect (events.hasEventsForParameter (2));
+        expect (! events.hasEventsForParameter (4));
+
+        events.clear();
+        expect (events.isEmpty(), "Event list should be empty after clearing!");
+    }
+
+    void subBlocksTest()
+    {
+        static constexpr int blockSize = 256;
+        EventsTestPlugin plugin;
+        plugin.setParameterEventMode (EventsTestPlugin::ParameterEventMode::SubBlocks, 8);
+        plugin.prepareToPlay (48000.0, blockSize);
+
+        plugin.addParameterEvent ({ 100, 0, chowdsp::ParameterEvent::Type::Value, 0.5f });
+        plugin.addParameterEvent ({ 50, 0, chowdsp::ParameterEvent::Type::Value, 0.25f });
+        plugin.addParameterEvent ({ 104, 0, chowdsp::ParameterEvent::Type::Modulation, 0.25f }); // should be merged with the event at 100
+        plugin.addParameterEvent ({ 200, 1, chowdsp::ParameterEvent::Type::Value, 1.0f });
+
+        juce::AudioBuffer<float> buffer { 2, blockSize };
+        juce::MidiBuffer midi;
+        plugin.processBlock (buffer, midi);
+
+        const std::vector<std::pair<int, float>> expectedSubBlocks { { 50, 0.0f }, { 50, 0.25f }, { 100, 0.75f }, { 56, 0.75f } };
+        expectEquals ((int) plugin.subBlocks.size(), (int) expectedSubBlocks.size(), "Incorrect number of sub-blocks!");
+        for (size_t i = 0; i < expectedSubBlocks.size(); ++i)
+        {
+            expectEquals (plugin.subBlocks[i].first, expectedSubBlocks[i].first, "Sub-block size is incorrect!");
+            expectWithinAbsoluteError (plugin.subBlocks[i].second, expectedSubBlocks[i].second, 1.0e-6f, "Sub-block parameter value is incorrect!");
+        }
+
+        expectWithinAbsoluteError (plugin.getParam (1).getCurrentValue(), 1.0f, 1.0e-6f, "Final parameter value is incorrect!");
+
+        // events should be cleared after each block
+        plugin.subBlocks.clear();
+        plugin.processBlock (buffer, midi);
+        expectEquals ((int) plugin.subBlocks.size(), 1, "Block without events should not be split!");
+    }
+
+    void perSampleBuffersTest()
+    {
+        static constexpr int blockSize = 128;
+        EventsTestPlugin plugin;
+        plugin.setParameterEventMode (EventsTestPlugin::ParameterEventMode::PerSampleBuffers);
+        plugin.prepareToPlay (48000.0, blockSize);
+
+        plugin.addParameterEvent ({ 32, 0, chowdsp::ParameterEvent::Type::Value, 0.5f });
+        plugin.addParameterEvent ({ 96, 0, chowdsp::ParameterEvent::Type::Modulation, 0.25f });
+        plugin.addParameterEvent ({ 64, 1, chowdsp::ParameterEvent::Type::Value, 1.0f });
+
+        juce::AudioBuffer<float> buffer { 2, blockSize };
+        juce::MidiBuffer midi;
+        plugin.processBlock (buffer, midi);
+
+        expectEquals ((int) plugin.subBlocks.size(), 1, "Block should not be split!");
+        const auto* data = buffer.getReadPointer (0);
+        for (int n = 0; n < blockSize; ++n)
+        {
+            const auto expected = n < 32 ? 0.0f : (n < 96 ? 0.5f : 0.75f);
+            expectWithinAbsoluteError (data[n], expected, 1.0e-6f, "Parameter buffer is incorrect!");
+        }
+
+        // events should be applied after the block
+        expectWithinAbsoluteError (plugin.getParam (0).getCurrentValue(), 0.75f, 1.0e-6f, "Final parameter value is incorrect!");
+        expectWithinAbsoluteError (plugin.getParam (1).getCurrentValue(), 1.0f, 1.0e-6f, "Final parameter value is incorrect!");
+
+        // with no events, the parameter buffer should not be rendered
+        juce::FloatVectorOperations::fill (plugin.paramBuffer.data(), -1.0f, blockSize);
+        plugin.processBlock (buffer, midi);
+        expectEquals (plugin.paramBuffer[0], -1.0f, "Parameter buffer should not be rendered without events!");
+    }
+
+    void disabledTest()
+    {
+        EventsTestPlugin plugin;
+        plugin.prepareToPlay (48000.0, 64);
+
+        plugin.addParameterEvent ({ 32, 0, chowdsp::ParameterEvent::Type::Value, 0.5f });
+        expect (plugin.getParameterEvents().isEmpty(), "Events should not be stored when disabled!");
+        expectWithinAbsoluteError (plugin.getParam (0).getCurrentValue(), 0.5f, 1.0e-6f, "Event should be applied immediately!");
+    }
+
+    void runTestTimed() override
+    {
+        beginTest ("Sorting Test");
+        sortingTest();
+
+        beginTest ("Sub-Blocks Test");
+        subBlocksTest();
+
+        beginTest ("Per-Sample Buffers Test");
+        perSampleBuffersTest();
+
+        beginTest ("Disabled Test");
+        disabledTest();
+    }
+};
+
+static ParameterEventListTest parameterEventListTest;
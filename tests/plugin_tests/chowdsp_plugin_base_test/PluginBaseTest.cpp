@@ -117,6 +117,51 @@ public:
         }
     }
 
+    void callbackTimingTest()
+    {
+        DummyPlugin dummy;
+        constexpr int blockSize = 512;
+        dummy.prepareToPlay (48000.0, blockSize);
+
+        juce::AudioBuffer<float> buffer (2, blockSize);
+        buffer.clear();
+        juce::MidiBuffer midi;
+
+        dummy.processBlock (buffer, midi);
+        auto& monitor = dummy.getCallbackTimingMonitor();
+        expectEquals ((int) monitor.getStats().numCallbacks, 0, "Callbacks should not be measured until timing is enabled!");
+
+        dummy.setCallbackTimingEnabled (true);
+        for (int i = 0; i < 100; ++i)
+            dummy.processBlock (buffer, midi);
+
+        auto stats = monitor.getStats();
+        expectEquals ((int) stats.numCallbacks, 100, "Incorrect number of measured callbacks!");
+        expectEquals ((int) stats.numOverruns, 0, "An empty callback should not overrun!");
+        expectLessOrEqual (stats.p50Utilisation, stats.p99Utilisation, "Percentiles out of order!");
+        expectLessOrEqual (stats.p99Utilisation, stats.p999Utilisation, "Percentiles out of order!");
+        expectLessOrEqual (stats.p999Utilisation, stats.maxUtilisation, "Percentiles out of order!");
+
+        // fake some slow callbacks (5 ms and 20 ms, with a 10 ms budget)
+        monitor.reset();
+        for (int i = 0; i < 990; ++i)
+            monitor.addMeasurement (0.005, 0.01);
+        for (int i = 0; i < 10; ++i)
+            monitor.addMeasurement (0.02, 0.01);
+
+        stats = monitor.getStats();
+        expectEquals ((int) stats.numCallbacks, 1000, "Incorrect number of measured callbacks!");
+        expectEquals ((int) stats.numOverruns, 10, "Incorrect number of overruns!");
+        expectWithinAbsoluteError (stats.meanUtilisation, 0.515, 1.0e-6, "Incorrect mean utilisation!");
+        expectWithinAbsoluteError (stats.p50Utilisation, 0.5, 0.01, "Incorrect p50 utilisation!");
+        expectWithinAbsoluteError (stats.p99Utilisation, 0.5, 0.01, "Incorrect p99 utilisation!");
+        expectWithinAbsoluteError (stats.p999Utilisation, 2.0, 1.0e-6, "Incorrect p99.9 utilisation!");
+        expectWithinAbsoluteError (stats.maxCallbackTimeMicroseconds, 20000.0, 1.0e-3, "Incorrect worst-case callback time!");
+
+        const auto diagString = chowdsp::PluginDiagnosticInfo::getDiagnosticsString (dummy);
+        expect (diagString.contains ("Audio Callbacks: 1000 callbacks, 10 overruns"), "Callback timing is missing from the diagnostics!");
+    }
+
     void programInterfaceTest()
     {
         using namespace test_utils;
@@ -196,6 +241,9 @@ public:
         beginTest ("Process Test");
         processTest();
 
+        beginTest ("Callback Timing Test");
+        callbackTimingTest();
+
         beginTest ("Program Interface Test");
         programInterfaceTest();
 
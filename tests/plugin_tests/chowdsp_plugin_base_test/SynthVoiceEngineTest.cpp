@@ -0,0 +1,309 @@
+#include <TimedUnitTest.h>
+#include <chowdsp_plugin_base/chowdsp_plugin_base.h>
+
+namespace
+{
+/** Test engine where each voice outputs its velocity, plus the modulation for parameter 0 */
+struct TestVoiceEngine : chowdsp::SynthVoiceEngine
+{
+    TestVoiceEngine (int numVoices, int voicesPerGroup) : chowdsp::SynthVoiceEngine (numVoices, voicesPerGroup) {}
+
+    void startVoice (int) override { numVoicesStarted++; }
+
+    void releaseVoice (int voiceIndex) override
+    {
+        // no release tail
+        voiceFinished (voiceIndex);
+    }
+
+    void stopVoice (int) override { numVoicesStopped++; }
+
+    void processVoiceGroup (int groupIndex, uint32_t voiceMask, juce::AudioBuffer<float>& buffer, int startSample, int numSamples) override
+    {
+        numGroupsProcessed++;
+        const auto groupSize = voiceAllocator.getNumVoicesPerGroup();
+        for (int i = 0; i < groupSize; ++i)
+        {
+            if ((voiceMask & (1u << i)) == 0)
+                continue;
+
+            const auto voiceIndex = groupIndex * groupSize + i;
+            auto* data = buffer.getWritePointer (0);
+            for (int n = startSample; n < startSample + numSamples; ++n)
+                data[n] += voiceAllocator.getVelocity (voiceIndex) + polyphonicModulation.getModulationAmount (0, voiceIndex, n);
+        }
+    }
+
+    int numVoicesStarted = 0;
+    int numVoicesStopped = 0;
+    int numGroupsProcessed = 0;
+};
+
+/** Test synth with one polyphonically modulated parameter */
+class PolySynthTestPlugin : public chowdsp::SynthBase<PolySynthTestPlugin>
+{
+public:
+    PolySynthTestPlugin()
+    {
+        setParameterEventMode (ParameterEventMode::PerSampleBuffers);
+        getModParam().setPolyphonicModulationEnabled (true);
+    }
+
+    static void addParameters (Parameters& params)
+    {
+        chowdsp::ParamUtils::createPercentParameter (params, "mod", "Mod", 0.0f);
+    }
+
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override
+    {
+        setRateAndBufferSizeDetails (sampleRate, samplesPerBlock);
+        voices.setPolyphonicModulationParameters ({ &getModParam() });
+    }
+
+    void releaseResources() override {}
+
+    void processSynth (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midi) override
+    {
+        voices.process (buffer, midi, &getParameterEvents());
+    }
+
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+
+    chowdsp::FloatParameter& getModParam()
+    {
+        return *dynamic_cast<chowdsp::FloatParameter*> (getParameters()[0]);
+    }
+
+    TestVoiceEngine voices { 8, 4 };
+};
+} // namespace
+
+class SynthVoiceEngineTest : public TimedUnitTest
+{
+public:
+    SynthVoiceEngineTest() : TimedUnitTest ("Synth Voice Engine Test") {}
+
+    void allocationTest()
+    {
+        chowdsp::VoiceAllocator allocator { 6, 4 };
+        expectEquals (allocator.getNumGroups(), 2, "Incorrect number of voice groups!");
+
+        bool stolen = false;
+        for (int i = 0; i < 6; ++i)
+        {
+            expectEquals (allocator.startNote (i, 0, (int16_t) (60 + i), 1.0f, stolen), i, "Voices should be allocated in order!");
+            expect (! stolen, "Voice should not be stolen!");
+        }
+        expectEquals ((int) allocator.getGroupMask (0), 0b1111, "Incorrect mask for the first group!");
+        expectEquals ((int) allocator.getGroupMask (1), 0b11, "Incorrect mask for the second group!");
+
+        // freed voices should be re-used, lowest first
+        allocator.freeVoice (4);
+        allocator.freeVoice (1);
+        expectEquals (allocator.getNumActiveVoices(), 4, "Incorrect number of active voices!");
+        expectEquals (allocator.startNote (10, 0, 70, 1.0f, stolen), 1, "Lowest free voice should be allocated!");
+
+        // the oldest released voice should be stolen before the oldest held voice
+        allocator.releaseVoice (3);
+        allocator.releaseVoice (5);
+        expectEquals (allocator.startNote (11, 0, 71, 1.0f, stolen), 4, "Free voice should be allocated!");
+        expectEquals (allocator.startNote (12, 0, 72, 1.0f, stolen), 3, "Oldest released voice should be stolen!");
+        expect (stolen, "Voice should be stolen!");
+        expectEquals (allocator.startNote (13, 0, 73, 1.0f, stolen), 5, "Oldest released voice should be stolen!");
+        expectEquals (allocator.startNote (14, 0, 74, 1.0f, stolen), 0, "Oldest held voice should be stolen!");
+
+        // voices are matched by note ID, or by channel and key
+        std::vector<int> matches;
+        allocator.forEachMatchingVoice (12, -1, -1, [&matches] (int v)
+                                        { matches.push_back (v); });
+        expect (matches == std::vector<int> { 3 }, "Incorrect voices matched by note ID!");
+
+        matches.clear();
+        allocator.forEachMatchingVoice (-1, 0, 73, [&matches] (int v)
+                                        { matches.push_back (v); });
+        expect (matches == std::vector<int> { 5 }, "Incorrect voices matched by key!");
+
+        matches.clear();
+        allocator.forEachMatchingVoice (-1, 1, -1, [&matches] (int v)
+                                        { matches.push_back (v); });
+        expect (matches.empty(), "No voices should match channel 1!");
+    }
+
+    void sampleAccurateMidiTest()
+    {
+        static constexpr int blockSize = 64;
+        TestVoiceEngine engine { 16, 4 };
+
+        const auto note1 = juce::MidiMessage::noteOn (1, 60, 0.5f);
+        const auto note2 = juce::MidiMessage::noteOn (1, 64, 0.25f);
+        juce::MidiBuffer midi;
+        midi.addEvent (note1, 10);
+        midi.addEvent (note2, 20);
+        midi.addEvent (juce::MidiMessage::noteOff (1, 60), 40);
+
+        juce::AudioBuffer<float> buffer { 1, blockSize };
+        buffer.clear();
+        engine.process (buffer, midi);
+
+        for (int n = 0; n < blockSize; ++n)
+        {
+            const auto expected = (n >= 10 && n < 40 ? note1.getFloatVelocity() : 0.0f) + (n >= 20 ? note2.getFloatVelocity() : 0.0f);
+            expectWithinAbsoluteError (buffer.getSample (0, n), expected, 1.0e-6f, "Incorrect output at sample " + juce::String (n));
+        }
+
+        expectEquals (engine.numVoicesStarted, 2, "Incorrect number of voices started!");
+        expectEquals (engine.getVoiceAllocator().getNumActiveVoices(), 1, "Incorrect number of active voices!");
+
+        // only the first group has active voices, and the block was split into 3 sub-blocks with active voices
+        expectEquals (engine.numGroupsProcessed, 3, "Idle voice groups should be skipped!");
+
+        engine.allNotesOff (false);
+        expectEquals (engine.getVoiceAllocator().getNumActiveVoices(), 0, "All voices should be stopped!");
+        expectEquals (engine.numVoicesStopped, 1, "Incorrect number of voices stopped!");
+    }
+
+    void modulationStoreTest()
+    {
+        PolySynthTestPlugin plugin;
+        auto& param = plugin.getModParam();
+        expect (param.supportsPolyphonicModulation(), "Parameter should support polyphonic modulation!");
+
+        chowdsp::PolyphonicModulationStore store;
+        store.prepare ({ &param }, 2);
+        const auto paramIndex = param.getParameterIndex();
+        expect (store.hasParameter (paramIndex), "Store should contain the parameter!");
+
+        store.addModulationEvent (0, paramIndex, 0.25f, 10);
+        store.addModulationEvent (0, paramIndex, 0.5f, 20);
+        expectEquals (store.getModulationAmount (paramIndex, 0, 5), 0.0f, "Incorrect modulation before the first event!");
+        expectEquals (store.getModulationAmount (paramIndex, 0, 15), 0.25f, "Incorrect modulation after the first event!");
+        expectEquals (store.getModulationAmount (paramIndex, 1, 15), 0.0f, "Other voices should not be modulated!");
+
+        std::vector<float> values (32);
+        expect (! store.renderModulatedValues (param, 0, values.data(), 0, 10), "Modulation should not change before the first event!");
+        expect (! store.renderModulatedValues (param, 1, values.data(), 0, 32), "Modulation should not change for the other voice!");
+        expect (store.renderModulatedValues (param, 0, values.data(), 0, 32), "Modulation should change during the block!");
+        for (int n = 0; n < 32; ++n)
+        {
+            const auto expected = n < 10 ? 0.0f : (n < 20 ? 0.25f : 0.5f);
+            expectWithinAbsoluteError (values[(size_t) n], expected, 1.0e-6f, "Incorrect modulated value at sample " + juce::String (n));
+        }
+
+        // the last event in each block should carry over to the next block
+        store.endBlock();
+        expectEquals (store.getModulationAmount (paramIndex, 0), 0.5f, "Modulation should carry over to the next block!");
+        expectEquals (store.getModulatedValue (param, 0), 0.5f, "Incorrect modulated value!");
+
+        store.resetVoice (0);
+        expectEquals (store.getModulationAmount (paramIndex, 0), 0.0f, "Modulation should be cleared when the voice is reset!");
+    }
+
+    void eventOverflowTest()
+    {
+        PolySynthTestPlugin plugin;
+        auto& param = plugin.getModParam();
+        const auto paramIndex = param.getParameterIndex();
+
+        chowdsp::PolyphonicModulationStore store;
+        store.prepare ({ &param }, 2, 1);
+
+        store.addModulationEvent (0, paramIndex, 0.25f, 10);
+        store.addModulationEvent (1, paramIndex, 0.5f, 5); // no room, and no previous event for this voice
+        store.addModulationEvent (0, paramIndex, 0.75f, 20); // no room, so this should replace the previous event
+        expectEquals (store.getModulationAmount (paramIndex, 0, 5), 0.0f, "Incorrect modulation before the first event!");
+        expectEquals (store.getModulationAmount (paramIndex, 0, 15), 0.75f, "Overflowing event should replace the previous event!");
+        expectEquals (store.getModulationAmount (paramIndex, 1, 0), 0.5f, "Overflowing event should apply from the start of the block!");
+
+        store.endBlock();
+        expectEquals (store.getModulationAmount (paramIndex, 0), 0.75f, "Overflowing event should carry over to the next block!");
+        expectEquals (store.getModulationAmount (paramIndex, 1), 0.5f, "Overflowing event should carry over to the next block!");
+    }
+
+    void polyphonicModulationTest()
+    {
+        static constexpr int blockSize = 32;
+        PolySynthTestPlugin plugin;
+        plugin.prepareToPlay (48000.0, blockSize);
+
+        juce::MidiBuffer midi;
+        midi.addEvent (juce::MidiMessage::noteOn (1, 60, (juce::uint8) 127), 0);
+        midi.addEvent (juce::MidiMessage::noteOn (2, 60, (juce::uint8) 127), 0);
+
+        chowdsp::ParameterEvent modEvent { 16, 0, chowdsp::ParameterEvent::Type::Modulation, 0.125f };
+        modEvent.channel = 1; // MIDI channel 2
+        modEvent.key = 60;
+        plugin.addParameterEvent (modEvent);
+
+        // monophonic modulation events should not be routed to the voices
+        plugin.addParameterEvent ({ 8, 0, chowdsp::ParameterEvent::Type::Modulation, 0.0f });
+
+        juce::AudioBuffer<float> buffer { 2, blockSize };
+        plugin.processBlock (buffer, midi);
+        for (int n = 0; n < blockSize; ++n)
+        {
+            const auto expected = n < 16 ? 2.0f : 2.125f;
+            expectWithinAbsoluteError (buffer.getSample (0, n), expected, 1.0e-6f, "Incorrect output at sample " + juce::String (n));
+        }
+        expect (plugin.getParameterEvents().isEmpty(), "Parameter events should be cleared after processing!");
+
+        // the modulation should still be applied in the next block
+        midi.clear();
+        plugin.processBlock (buffer, midi);
+        for (int n = 0; n < blockSize; ++n)
+            expectWithinAbsoluteError (buffer.getSample (0, n), 2.125f, 1.0e-6f, "Incorrect output in second block at sample " + juce::String (n));
+    }
+
+    void noteIDTest()
+    {
+        static constexpr int blockSize = 32;
+        PolySynthTestPlugin plugin;
+        plugin.prepareToPlay (48000.0, blockSize);
+
+        // two notes on the same channel and key, which can only be told apart by their note IDs
+        plugin.voices.startNote (10, 0, 60, 1.0f);
+        plugin.voices.startNote (11, 0, 60, 1.0f);
+
+        chowdsp::ParameterEvent modEvent { 16, 0, chowdsp::ParameterEvent::Type::Modulation, 0.125f };
+        modEvent.noteID = 11;
+        plugin.addParameterEvent (modEvent);
+
+        juce::MidiBuffer midi;
+        juce::AudioBuffer<float> buffer { 2, blockSize };
+        plugin.processBlock (buffer, midi);
+        for (int n = 0; n < blockSize; ++n)
+        {
+            const auto expected = n < 16 ? 2.0f : 2.125f;
+            expectWithinAbsoluteError (buffer.getSample (0, n), expected, 1.0e-6f, "Incorrect output at sample " + juce::String (n));
+        }
+
+        // releasing the unmodulated note should leave the modulated note playing
+        plugin.voices.releaseNote (10, -1, -1);
+        expectEquals (plugin.voices.getVoiceAllocator().getNumActiveVoices(), 1, "Only one voice should be released!");
+        plugin.processBlock (buffer, midi);
+        for (int n = 0; n < blockSize; ++n)
+            expectWithinAbsoluteError (buffer.getSample (0, n), 1.125f, 1.0e-6f, "Incorrect output in second block at sample " + juce::String (n));
+    }
+
+    void runTestTimed() override
+    {
+        beginTest ("Allocation Test");
+        allocationTest();
+
+        beginTest ("Sample-Accurate MIDI Test");
+        sampleAccurateMidiTest();
+
+        beginTest ("Modulation Store Test");
+        modulationStoreTest();
+
+        beginTest ("Event Overflow Test");
+        eventOverflowTest();
+
+        beginTest ("Polyphonic Modulation Test");
+        polyphonicModulationTest();
+
+        beginTest ("Note ID Test");
+        noteIDTest();
+    }
+};
+
+static SynthVoiceEngineTest synthVoiceEngineTest;
@@ -66,6 +66,94 @@ TEST_CASE ("State Listeners Test", "[plugin][state][listeners]")
         REQUIRE_MESSAGE (listenerCount == Catch::Approx (numIters).margin (2), "Incorrect number of listener callbacks!");
     }
 
+    SECTION ("Polling Listeners Test")
+    {
+        chowdsp::ParamHolder params {};
+        chowdsp::PercentParameter::Ptr pct { "percent", "Percent", 1.0f };
+        params.add (pct);
+        chowdsp::ParameterListeners listeners { params, 10, chowdsp::ParameterListeners::ChangeDetectionMode::Polling };
+
+        int listenerCount = 0;
+        chowdsp::ScopedCallback listener = listeners.addParameterListener (
+            pct,
+            chowdsp::ParameterListenerThread::MessageThread,
+            [&listenerCount]
+            { listenerCount++; });
+
+        // setValue() does not notify the parameter's listeners, so this change can only be detected by polling
+        pct->setValue (0.25f);
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (100);
+        REQUIRE_MESSAGE (listenerCount == 1, "Polling listener was not called!");
+    }
+
+    SECTION ("Push Notification Listeners Test")
+    {
+        static constexpr int numParams = 150;
+        chowdsp::ParamHolder params {};
+        std::vector<chowdsp::PercentParameter::Ptr> pcts;
+        for (int i = 0; i < numParams; ++i)
+        {
+            pcts.emplace_back ("percent" + juce::String (i), "Percent", 1.0f);
+            params.add (pcts.back());
+        }
+        chowdsp::ParameterListeners listeners { params, 10, chowdsp::ParameterListeners::ChangeDetectionMode::PushNotifications };
+
+        std::vector<int> listenerCounts ((size_t) numParams, 0);
+        std::vector<chowdsp::ScopedCallback> callbacks;
+        for (int i = 0; i < numParams; ++i)
+        {
+            callbacks.push_back (listeners.addParameterListener (
+                pcts[(size_t) i],
+                chowdsp::ParameterListenerThread::MessageThread,
+                [&listenerCounts, i]
+                { listenerCounts[(size_t) i]++; }));
+        }
+
+        // change a few parameters, across different words of the changed flags
+        const std::vector<int> paramsToChange { 0, 63, 64, 100, numParams - 1 };
+        for (auto index : paramsToChange)
+            static_cast<juce::AudioParameterFloat&> (pcts[(size_t) index]) = 0.5f;
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (100);
+
+        for (int i = 0; i < numParams; ++i)
+        {
+            const auto shouldHaveChanged = std::find (paramsToChange.begin(), paramsToChange.end(), i) != paramsToChange.end();
+            REQUIRE_MESSAGE (listenerCounts[(size_t) i] == (shouldHaveChanged ? 1 : 0), "Incorrect listener count for parameter " << i);
+        }
+    }
+
+    SECTION ("Parameters Destroyed Before Listeners Test")
+    {
+        struct Params : chowdsp::ParamHolder
+        {
+            Params()
+            {
+                add (pct, subParams);
+                subParams.add (gain);
+            }
+
+            chowdsp::PercentParameter::Ptr pct { "percent", "Percent", 1.0f };
+            chowdsp::ParamHolder subParams { "sub" };
+            chowdsp::GainDBParameter::Ptr gain { "gain", "Gain", juce::NormalisableRange { -12.0f, 12.0f }, 0.0f };
+        };
+
+        auto params = std::make_unique<Params>();
+        chowdsp::ParameterListeners listeners { *params, 10, chowdsp::ParameterListeners::ChangeDetectionMode::PushNotifications };
+
+        int listenerCount = 0;
+        chowdsp::ScopedCallback listener = listeners.addParameterListener (
+            params->pct,
+            chowdsp::ParameterListenerThread::MessageThread,
+            [&listenerCount]
+            { listenerCount++; });
+
+        // the listeners should detach themselves from the parameters, before the parameters are destroyed
+        params.reset();
+        listeners.updateBroadcastersFromMessageThread();
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (50);
+        REQUIRE_MESSAGE (listenerCount == 0, "Listener should not be called after the parameters are destroyed!");
+    }
+
     SECTION ("Non Parameter Listeners Test")
     {
         struct Params : chowdsp::ParamHolder
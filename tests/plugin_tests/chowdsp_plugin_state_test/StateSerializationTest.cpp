@@ -268,4 +268,38 @@ TEST_CASE ("State Serialization Test", "[plugin][state]")
         REQUIRE_MESSAGE (state.nonParams.editorHeight.get() == height, "Editor height is incorrect");
         REQUIRE_MESSAGE (state.nonParams.randomString.get() == juce::String { "default" }, "Added field is incorrect");
     }
+
+    SECTION ("Binary Serializer Test")
+    {
+        using BinaryState = chowdsp::PluginStateImpl<PluginParameterState, PluginNonParameterStateNewField, chowdsp::BinarySerializer>;
+
+        static constexpr float percentVal = 0.25f;
+        static constexpr int choiceVal = 0;
+        static constexpr int width = 200;
+        const juce::String stringVal { "binary" };
+
+        juce::MemoryBlock block;
+        {
+            BinaryState state;
+            static_cast<juce::AudioParameterFloat&> (state.params.levelParams.percent) = percentVal;
+            static_cast<juce::AudioParameterChoice&> (state.params.mode) = choiceVal;
+            state.nonParams.editorWidth = width;
+            state.nonParams.randomString = stringVal;
+            state.serialize (block);
+        }
+
+        juce::MemoryBlock jsonBlock;
+        chowdsp::PluginStateImpl<PluginParameterState, PluginNonParameterStateNewField> {}.serialize (jsonBlock);
+        REQUIRE_MESSAGE (block.getSize() < jsonBlock.getSize(), "Binary state should be smaller than JSON state!");
+
+        BinaryState state;
+        state.deserialize (block);
+        REQUIRE_MESSAGE (state.params.levelParams.percent->get() == percentVal, "Percent value is incorrect");
+        REQUIRE_MESSAGE (state.params.levelParams.gain->get() == 0.0f, "Gain value is incorrect");
+        REQUIRE_MESSAGE (state.params.mode->getIndex() == choiceVal, "Choice value is incorrect");
+        REQUIRE_MESSAGE (state.params.onOff->get() == true, "Bool value is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.editorWidth.get() == width, "Editor width is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.editorHeight.get() == 500, "Editor height is incorrect");
+        REQUIRE_MESSAGE (state.nonParams.randomString.get() == stringVal, "String value is incorrect");
+    }
 }
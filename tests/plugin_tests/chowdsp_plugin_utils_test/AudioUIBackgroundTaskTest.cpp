@@ -47,6 +47,35 @@ struct SimpleTask : Task
     float mag = 0.0f;
     std::atomic_bool wasReset { false };
 };
+
+template <typename Task>
+struct OverwritingTask : Task
+{
+    static constexpr int taskBlockSize = 256;
+
+    OverwritingTask() : Task ("Overwriting Task") {}
+
+    void prepareTask (double, int, int& requestedBlockSize, int& /*waitMs*/) override
+    {
+        requestedBlockSize = taskBlockSize;
+    }
+
+    void runTask (const juce::AudioBuffer<float>& buffer) override
+    {
+        if (numRuns == 0)
+        {
+            // simulate the audio thread pushing enough data to overwrite the data that's being read
+            std::vector<float> newData ((size_t) taskBlockSize * 4, 1.0f);
+            this->pushSamples (0, newData.data(), (int) newData.size());
+        }
+
+        mag = buffer.getMagnitude (0, buffer.getNumSamples());
+        numRuns++;
+    }
+
+    std::atomic_int numRuns { 0 };
+    std::atomic<float> mag { -1.0f };
+};
 } // namespace
 
 template <typename TaskType>
@@ -61,6 +90,8 @@ public:
     {
         if constexpr (std::is_same<TaskType, chowdsp::SingleThreadAudioUIBackgroundTask>::value)
             return "Single Thread Audio/UI Background Task Test";
+        else if constexpr (std::is_same<TaskType, chowdsp::ScheduledAudioUIBackgroundTask>::value)
+            return "Scheduled Audio/UI Background Task Test";
         else
             return "Time Slice Audio/UI Background Task Test";
     }
@@ -173,6 +204,23 @@ public:
         task.setShouldBeRunning (false);
     }
 
+    void overwrittenDataTest()
+    {
+        OverwritingTask<TaskType> task;
+        task.prepare (48.0e3, OverwritingTask<TaskType>::taskBlockSize, 1);
+
+        std::vector<float> data ((size_t) OverwritingTask<TaskType>::taskBlockSize, 0.0f);
+        task.setShouldBeRunning (true);
+        task.pushSamples (0, data.data(), (int) data.size());
+
+        for (int i = 0; i < 1000 && task.numRuns < 2; ++i)
+            juce::Thread::sleep (1);
+        task.setShouldBeRunning (false);
+
+        expectGreaterOrEqual (task.numRuns.load(), 2, "Task should be run again when its data is overwritten!");
+        expectEquals (task.mag.load(), 1.0f, "Task should have been re-run with the latest data!");
+    }
+
     void runTestTimed() override
     {
         beginTest ("Audio Thread Test");
@@ -181,6 +229,9 @@ public:
         beginTest ("GUI Thread Test");
         guiThreadTest();
 
+        beginTest ("Overwritten Data Test");
+        overwrittenDataTest();
+
         if constexpr (std::is_same<TaskType, chowdsp::TimeSliceAudioUIBackgroundTask>::value)
         {
             beginTest ("Custom TimeSliceThread Test");
@@ -191,3 +242,4 @@ public:
 
 static AudioUIBackgroundTaskTest<chowdsp::SingleThreadAudioUIBackgroundTask> singleThreadAudioUiBackgroundTaskTest;
 static AudioUIBackgroundTaskTest<chowdsp::TimeSliceAudioUIBackgroundTask> timeSliceAudioUiBackgroundTaskTest;
+static AudioUIBackgroundTaskTest<chowdsp::ScheduledAudioUIBackgroundTask> scheduledAudioUiBackgroundTaskTest;
@@ -0,0 +1,108 @@
+#include <TimedUnitTest.h>
+#include <chowdsp_plugin_utils/chowdsp_plugin_utils.h>
+
+class BackgroundTaskSchedulerTest : public TimedUnitTest
+{
+public:
+    BackgroundTaskSchedulerTest() : TimedUnitTest ("Background Task Scheduler Test", "Threads")
+    {
+    }
+
+    struct CountingTask : chowdsp::BackgroundTaskScheduler::Task
+    {
+        int runScheduledTask() override
+        {
+            isRunning = true;
+            juce::Thread::sleep (runTimeMs);
+            numRuns.fetch_add (1);
+            isRunning = false;
+            return refreshTimeMs;
+        }
+
+        std::atomic<int> numRuns { 0 };
+        std::atomic_bool isRunning { false };
+        int refreshTimeMs = 10;
+        int runTimeMs = 1;
+    };
+
+    void newDataTest()
+    {
+        chowdsp::BackgroundTaskScheduler scheduler { 2 };
+        CountingTask task;
+        scheduler.addTask (task);
+        expect (scheduler.containsTask (task), "Task was not added!");
+
+        juce::Thread::sleep (100);
+        expectEquals (task.numRuns.load(), 0, "Task should not run without new data!");
+
+        task.markNewData();
+        juce::Thread::sleep (100);
+        expectEquals (task.numRuns.load(), 1, "Task should run once for new data!");
+
+        scheduler.removeTask (task);
+        expect (! scheduler.containsTask (task), "Task was not removed!");
+    }
+
+    void coalescingTest()
+    {
+        chowdsp::BackgroundTaskScheduler scheduler { 2 };
+        CountingTask task;
+        task.refreshTimeMs = 50;
+        scheduler.addTask (task);
+
+        // pushing data much faster than the refresh rate should only run the task once per refresh
+        const auto startTime = juce::Time::getMillisecondCounter();
+        while (juce::Time::getMillisecondCounter() - startTime < 500)
+        {
+            task.markNewData();
+            juce::Thread::sleep (1);
+        }
+
+        scheduler.removeTask (task);
+        expectGreaterThan (task.numRuns.load(), 2, "Task did not run often enough!");
+        expectLessOrEqual (task.numRuns.load(), 12, "Task ran more often than its refresh rate!");
+    }
+
+    void manyTasksTest()
+    {
+        static constexpr int numTasks = 150;
+        chowdsp::BackgroundTaskScheduler scheduler { 3 };
+        std::vector<std::unique_ptr<CountingTask>> tasks;
+        for (int i = 0; i < numTasks; ++i)
+        {
+            tasks.push_back (std::make_unique<CountingTask>());
+            scheduler.addTask (*tasks.back());
+        }
+
+        for (int i = 0; i < 30; ++i)
+        {
+            for (auto& task : tasks)
+                task->markNewData();
+            juce::Thread::sleep (10);
+        }
+
+        // removing a task should wait until it is no longer running
+        for (auto& task : tasks)
+        {
+            scheduler.removeTask (*task);
+            expect (! task->isRunning, "Task is still running after being removed!");
+        }
+
+        for (auto& task : tasks)
+            expectGreaterThan (task->numRuns.load(), 0, "All tasks should have run at least once!");
+    }
+
+    void runTestTimed() override
+    {
+        beginTest ("New Data Test");
+        newDataTest();
+
+        beginTest ("Coalescing Test");
+        coalescingTest();
+
+        beginTest ("Many Tasks Test");
+        manyTasksTest();
+    }
+};
+
+static BackgroundTaskSchedulerTest backgroundTaskSchedulerTest;
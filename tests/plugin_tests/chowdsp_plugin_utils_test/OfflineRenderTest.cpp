@@ -0,0 +1,180 @@
+#include <DummyPlugin.h>
+#include <TimedUnitTest.h>
+#include <chowdsp_plugin_utils/chowdsp_plugin_utils.h>
+
+namespace
+{
+constexpr double fs = 48000.0;
+constexpr int numSamples = 10000;
+
+juce::AudioBuffer<float> createNoiseBuffer (int numChannels)
+{
+    juce::Random rand { 0x1234 };
+    juce::AudioBuffer<float> buffer { numChannels, numSamples };
+    for (int ch = 0; ch < numChannels; ++ch)
+        for (int n = 0; n < numSamples; ++n)
+            buffer.setSample (ch, n, rand.nextFloat() * 2.0f - 1.0f);
+    return buffer;
+}
+
+/** A plugin with some internal state, so that the output depends on the order of the blocks. */
+struct FilterPlugin : DummyPlugin
+{
+    explicit FilterPlugin (float filterCoef) : coef (filterCoef) {}
+
+    void prepareToPlay (double sampleRate, int samplesPerBlock) override
+    {
+        DummyPlugin::prepareToPlay (sampleRate, samplesPerBlock);
+        std::fill (std::begin (z), std::end (z), 0.0f);
+    }
+
+    void processAudioBlock (juce::AudioBuffer<float>& buffer) override
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer (ch);
+            for (int n = 0; n < buffer.getNumSamples(); ++n)
+            {
+                z[ch] = coef * z[ch] + (1.0f - coef) * std::tanh (data[n]);
+                data[n] = z[ch];
+            }
+        }
+    }
+
+    const float coef;
+    float z[2] {};
+};
+} // namespace
+
+class OfflineRenderTest : public TimedUnitTest
+{
+public:
+    OfflineRenderTest() : TimedUnitTest ("Offline Render Test") {}
+
+    void passThroughTest (int blockSize)
+    {
+        const auto input = createNoiseBuffer (2);
+
+        DummyPlugin plugin;
+        const auto results = chowdsp::OfflineRender::render (plugin, input, { fs, blockSize });
+
+        expectEquals (results.output.getNumChannels(), 2, "Incorrect number of output channels!");
+        expectEquals (results.output.getNumSamples(), numSamples, "Incorrect number of output samples!");
+        expectEquals (results.numBlocks, (numSamples + blockSize - 1) / blockSize, "Incorrect number of blocks!");
+        expectEquals (results.blockSize, blockSize, "Incorrect block size!");
+        expectWithinAbsoluteError (results.audioLengthSeconds, (double) numSamples / fs, 1.0e-9, "Incorrect audio length!");
+        expectGreaterThan (results.realTimeFactor, 0.0, "Real-time factor should be positive!");
+
+        expectLessOrEqual (results.p50BlockMicroseconds, results.p90BlockMicroseconds, "Percentiles out of order!");
+        expectLessOrEqual (results.p90BlockMicroseconds, results.p99BlockMicroseconds, "Percentiles out of order!");
+        expectLessOrEqual (results.p99BlockMicroseconds, results.maxBlockMicroseconds, "Percentiles out of order!");
+
+        // the dummy plugin doesn't change the audio, so the output should be bit-identical to the input
+        expect (results.checksum == chowdsp::OfflineRender::getChecksum (input), "Output should be identical to the input!");
+    }
+
+    void channelLayoutTest()
+    {
+        DummyPlugin plugin;
+        expect (! chowdsp::OfflineRender::setMainBusChannels (plugin, 4), "Quad layout should not be supported!");
+        expectEquals (plugin.getTotalNumOutputChannels(), 2, "Layout should not be changed!");
+
+        expect (chowdsp::OfflineRender::setMainBusChannels (plugin, 1), "Mono layout should be supported!");
+        const auto input = createNoiseBuffer (1);
+        const auto results = chowdsp::OfflineRender::render (plugin, input, { fs, 256 });
+        expectEquals (results.output.getNumChannels(), 1, "Incorrect number of output channels!");
+        expect (results.checksum == chowdsp::OfflineRender::getChecksum (input), "Output should be identical to the input!");
+
+        // mono input should be repeated for a stereo plugin
+        DummyPlugin stereoPlugin;
+        const auto stereoResults = chowdsp::OfflineRender::render (stereoPlugin, input, { fs, 256 });
+        expectEquals (stereoResults.output.getNumChannels(), 2, "Incorrect number of output channels!");
+        for (int n = 0; n < numSamples; n += 97)
+            expectEquals (stereoResults.output.getSample (1, n), input.getSample (0, n), "Mono input was not repeated!");
+    }
+
+    void checksumTest()
+    {
+        auto buffer = createNoiseBuffer (2);
+        const auto checksum = chowdsp::OfflineRender::getChecksum (buffer);
+        expect (checksum == chowdsp::OfflineRender::getChecksum (createNoiseBuffer (2)), "Checksum should be deterministic!");
+
+        buffer.setSample (1, 1234, std::nextafter (buffer.getSample (1, 1234), 2.0f));
+        expect (checksum != chowdsp::OfflineRender::getChecksum (buffer), "Checksum should change when a sample changes!");
+    }
+
+    void channelGroupsTest (int channelsPerGroup, int numThreads)
+    {
+        constexpr int numChannels = 6;
+        const auto input = createNoiseBuffer (numChannels);
+        const auto results = chowdsp::OfflineRender::renderChannelGroups ([]
+                                                                          { return std::make_unique<FilterPlugin> (0.9f); },
+                                                                          input,
+                                                                          channelsPerGroup,
+                                                                          { fs, 64 },
+                                                                          numThreads);
+        expectEquals (results.output.getNumChannels(), numChannels, "Incorrect number of output channels!");
+
+        // render each group serially, for comparison
+        juce::AudioBuffer<float> expectedOutput { numChannels, numSamples };
+        for (int startChannel = 0; startChannel < numChannels; startChannel += channelsPerGroup)
+        {
+            juce::AudioBuffer<float> groupInput { channelsPerGroup, numSamples };
+            for (int ch = 0; ch < channelsPerGroup; ++ch)
+                groupInput.copyFrom (ch, 0, input, startChannel + ch, 0, numSamples);
+
+            FilterPlugin plugin { 0.9f };
+            chowdsp::OfflineRender::setMainBusChannels (plugin, channelsPerGroup);
+            const auto groupResults = chowdsp::OfflineRender::render (plugin, groupInput, { fs, 64 });
+            for (int ch = 0; ch < channelsPerGroup; ++ch)
+                expectedOutput.copyFrom (startChannel + ch, 0, groupResults.output, ch, 0, numSamples);
+        }
+
+        expect (results.checksum == chowdsp::OfflineRender::getChecksum (expectedOutput), "Parallel render is not identical to serial render!");
+    }
+
+    void chainTest (int blockSize, int pipelineDepth)
+    {
+        const auto input = createNoiseBuffer (2);
+
+        // render each stage serially, for comparison
+        auto expectedOutput = input;
+        for (auto coef : { 0.5f, 0.9f, 0.7f })
+        {
+            FilterPlugin plugin { coef };
+            expectedOutput = chowdsp::OfflineRender::render (plugin, expectedOutput, { fs, blockSize }).output;
+        }
+
+        FilterPlugin stage1 { 0.5f }, stage2 { 0.9f }, stage3 { 0.7f };
+        const auto results = chowdsp::OfflineRender::renderChain ({ &stage1, &stage2, &stage3 }, input, { fs, blockSize }, pipelineDepth);
+
+        expectEquals (results.output.getNumChannels(), 2, "Incorrect number of output channels!");
+        expectEquals (results.numBlocks, 3 * ((numSamples + blockSize - 1) / blockSize), "Incorrect number of blocks!");
+        expect (results.checksum == chowdsp::OfflineRender::getChecksum (expectedOutput), "Pipelined render is not identical to serial render!");
+    }
+
+    void runTestTimed() override
+    {
+        beginTest ("Pass-Through Test");
+        passThroughTest (512);
+
+        beginTest ("Pass-Through Odd Block Size Test");
+        passThroughTest (37);
+
+        beginTest ("Channel Layout Test");
+        channelLayoutTest();
+
+        beginTest ("Checksum Test");
+        checksumTest();
+
+        beginTest ("Channel Groups Test");
+        channelGroupsTest (2, 2);
+        channelGroupsTest (1, 4);
+
+        beginTest ("Chain Test");
+        chainTest (64, 4);
+        chainTest (37, 1);
+    }
+};
+
+static OfflineRenderTest offlineRenderTest;
@@ -35,6 +35,41 @@ public:
         expect (! logString.contains (testNonLogString), "Test non-log string WAS found in the log file!");
     }
 
+    void audioThreadLogTest()
+    {
+        juce::File logFile;
+        {
+            chowdsp::PluginLogger logger { logFileSubDir, logFileNameRoot };
+            logFile = logger.getLogFile();
+
+            expect (logger.logFromAudioThread ("Block {} has {} invalid samples! Gain: {}, bypassed: {}", 12, 3, 0.5f, true), "Log message was dropped!");
+            expect (logger.logFromAudioThread ("Processor: {}, extra:", "Test Processor", 44), "Log message was dropped!");
+        }
+
+        auto logString = logFile.loadFileAsString();
+        expect (logString.contains ("Block 12 has 3 invalid samples! Gain: 0.5, bypassed: true"), "Audio thread log message was not found in the log file!");
+        expect (logString.contains ("Processor: Test Processor, extra: 44"), "Audio thread log message with extra arguments was not found in the log file!");
+    }
+
+    void logFileRotationTest()
+    {
+        chowdsp::PluginLogger::LoggerParams params { logFileSubDir, logFileNameRoot };
+        params.maxLogFileSizeBytes = 256;
+
+        chowdsp::PluginLogger logger { params };
+        const auto firstLogFile = logger.getLogFile();
+
+        juce::Logger::writeToLog (juce::String::repeatedString ("This log message is pretty long... ", 10));
+        logger.flush();
+
+        const auto secondLogFile = logger.getLogFile();
+        expect (firstLogFile != secondLogFile, "Log file was not rotated!");
+        expect (secondLogFile.loadFileAsString().contains (firstLogFile.getFileName()), "Rotated log file does not reference the previous log file!");
+
+        juce::Logger::writeToLog ("This message should be in the new log file");
+        expect (secondLogFile.loadFileAsString().contains ("This message should be in the new log file"), "Log message was not written to the new log file!");
+    }
+
     void limitNumLogFilesTest()
     {
         constexpr int numLoggersAtOnce = 5;
@@ -112,6 +147,12 @@ public:
         beginTest ("Basic Log Test");
         basicLogTest();
 
+        beginTest ("Audio Thread Log Test");
+        audioThreadLogTest();
+
+        beginTest ("Log File Rotation Test");
+        logFileRotationTest();
+
         beginTest ("Limit Num Log Files Test");
         limitNumLogFilesTest();
 
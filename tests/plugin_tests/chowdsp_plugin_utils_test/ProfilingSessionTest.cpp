@@ -0,0 +1,175 @@
+#include <TimedUnitTest.h>
+#include <chowdsp_plugin_utils/chowdsp_plugin_utils.h>
+
+#include <set>
+
+namespace
+{
+// The CHOWDSP_PROFILE_ZONE() macro is compiled out unless profiling is enabled, so we use the zones directly here
+constexpr chowdsp::Profiler::Zone outerZone { "Outer Zone", __FILE__, __LINE__ };
+constexpr chowdsp::Profiler::Zone innerZone { "Inner Zone", __FILE__, __LINE__ };
+
+void runZones (int numIterations)
+{
+    for (int i = 0; i < numIterations; ++i)
+    {
+        const chowdsp::Profiler::ScopedZone outer { outerZone };
+        juce::Thread::sleep (1);
+
+        {
+            const chowdsp::Profiler::ScopedZone inner { innerZone };
+            volatile float x = 0.0f;
+            for (int j = 0; j < 100; ++j)
+                x = x + (float) j;
+        }
+    }
+}
+} // namespace
+
+class ProfilingSessionTest : public TimedUnitTest
+{
+public:
+    ProfilingSessionTest() : TimedUnitTest ("Profiling Session Test", "Threads") {}
+
+    void zoneStatsTest()
+    {
+        chowdsp::ProfilingSession session;
+        runZones (10);
+
+        const auto zoneStats = session.getZoneStats();
+        expectEquals ((int) zoneStats.size(), 2, "Incorrect number of zones!");
+
+        // the outer zone should come first, since it takes longer
+        expectEquals (zoneStats[0].name, juce::String { outerZone.name }, "Incorrect zone name!");
+        expectEquals (zoneStats[1].name, juce::String { innerZone.name }, "Incorrect zone name!");
+        expectEquals (zoneStats[0].line, outerZone.line, "Incorrect zone line!");
+
+        for (const auto& stats : zoneStats)
+        {
+            expectEquals ((int) stats.count, 10, "Incorrect zone count!");
+            expectLessOrEqual (stats.p50Microseconds, stats.p90Microseconds, "Percentiles out of order!");
+            expectLessOrEqual (stats.p90Microseconds, stats.p99Microseconds, "Percentiles out of order!");
+            expectLessOrEqual (stats.p99Microseconds, stats.maxMicroseconds, "Percentiles out of order!");
+            expectLessOrEqual (stats.meanMicroseconds, stats.maxMicroseconds, "Mean is larger than max!");
+        }
+        expectGreaterOrEqual (zoneStats[0].meanMicroseconds, 1000.0, "Outer zone mean is too short!");
+        expectEquals ((int) session.getNumDroppedRecords(), 0, "Records should not be dropped!");
+
+        session.clear();
+        expect (session.getZoneStats().empty(), "Zones should be empty after clearing!");
+    }
+
+    void multiThreadedTraceTest()
+    {
+        chowdsp::ProfilingSession session;
+        runZones (5);
+
+        auto thread = std::thread ([] { runZones (5); });
+        thread.join();
+
+        const auto trace = session.getChromeTrace();
+        const auto& events = trace["traceEvents"];
+
+        int numZoneEvents = 0;
+        std::set<size_t> threadIndexes;
+        for (const auto& event : events)
+        {
+            if (event["ph"] != "X")
+                continue;
+
+            numZoneEvents++;
+            threadIndexes.insert (event["tid"].get<size_t>());
+            expectGreaterOrEqual (event["dur"].get<double>(), 0.0, "Event duration should not be negative!");
+            expectGreaterOrEqual (event["ts"].get<double>(), 0.0, "Event should not start before the session!");
+        }
+
+        expectEquals (numZoneEvents, 20, "Incorrect number of trace events!");
+        expectEquals ((int) threadIndexes.size(), 2, "Events should be recorded from two threads!");
+
+        const auto traceFile = juce::File::getSpecialLocation (juce::File::tempDirectory).getChildFile ("profiling_test_trace.json");
+        session.exportChromeTrace (traceFile);
+        expect (traceFile.existsAsFile(), "Trace file was not written!");
+        expectEquals ((int) chowdsp::JSONUtils::fromFile (traceFile)["traceEvents"].size(), (int) events.size(), "Incorrect trace file contents!");
+        traceFile.deleteFile();
+    }
+
+    void threadBufferReuseTest()
+    {
+        chowdsp::ProfilingSession session;
+
+        // each thread should return its buffer when it exits, so more threads than buffers can record over time
+        constexpr int numThreads = (int) chowdsp::Profiler::maxNumThreads + 8;
+        for (int i = 0; i < numThreads; ++i)
+        {
+            auto thread = std::thread ([] { runZones (1); });
+            thread.join();
+        }
+
+        const auto zoneStats = session.getZoneStats();
+        expectEquals ((int) zoneStats.size(), 2, "Incorrect number of zones!");
+        for (const auto& stats : zoneStats)
+            expectEquals ((int) stats.count, numThreads, "Incorrect zone count!");
+        expectEquals ((int) session.getNumDroppedRecords(), 0, "Records should not be dropped!");
+    }
+
+    void tooManyThreadsTest()
+    {
+        chowdsp::ProfilingSession session;
+
+        // keep all the threads alive until they've all recorded, so that some of them can't get a buffer
+        constexpr int numThreads = (int) chowdsp::Profiler::maxNumThreads + 2;
+        std::atomic<int> numThreadsDone { 0 };
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; ++i)
+        {
+            threads.emplace_back (
+                [&numThreadsDone]
+                {
+                    runZones (1);
+                    numThreadsDone.fetch_add (1);
+                    while (numThreadsDone.load() < numThreads)
+                        std::this_thread::yield();
+                });
+        }
+        for (auto& thread : threads)
+            thread.join();
+
+        const auto zoneStats = session.getZoneStats();
+        size_t numRecorded = 0;
+        for (const auto& stats : zoneStats)
+            numRecorded += stats.count;
+
+        const auto numDropped = session.getNumDroppedRecords();
+        expectGreaterOrEqual ((int) numDropped, 2 * 2, "Records from threads without a buffer should be counted as dropped!");
+        expectEquals ((int) (numRecorded + numDropped), 2 * numThreads, "Incorrect number of records!");
+    }
+
+    void noSessionTest()
+    {
+        runZones (5);
+        expect (! chowdsp::Profiler::getInstance().isRecording(), "Profiler should not be recording without a session!");
+
+        chowdsp::ProfilingSession session;
+        expect (session.getZoneStats().empty(), "Zones should not be recorded without a session!");
+    }
+
+    void runTestTimed() override
+    {
+        beginTest ("Zone Stats Test");
+        zoneStatsTest();
+
+        beginTest ("Multi-Threaded Trace Test");
+        multiThreadedTraceTest();
+
+        beginTest ("Thread Buffer Reuse Test");
+        threadBufferReuseTest();
+
+        beginTest ("Too Many Threads Test");
+        tooManyThreadsTest();
+
+        beginTest ("No Session Test");
+        noSessionTest();
+    }
+};
+
+static ProfilingSessionTest profilingSessionTest;
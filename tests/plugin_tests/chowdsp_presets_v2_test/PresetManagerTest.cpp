@@ -307,4 +307,176 @@ TEST_CASE ("Preset Manager Test", "[plugin][presets][state]")
         REQUIRE (! presetMgr->getIsPresetDirty());
         REQUIRE (presetMgr.getFloatParam() == testValue2);
     }
+
+    SECTION ("Indexed User Presets")
+    {
+        static constexpr float testValue = 0.35f;
+        auto preset = saveUserPreset ("test.preset", testValue);
+
+        test_utils::ScopedFile userPresetsDir { "user_presets_indexed" };
+        userPresetsDir.file.createDirectory();
+        preset.toFile (userPresetsDir.file.getChildFile ("test.preset"));
+
+        {
+            ScopedPresetManager presetMgr { userPresetsDir };
+            const auto* userPreset = presetMgr->getPresetTree().getPresetByIndex (0);
+            REQUIRE_MESSAGE (! userPreset->isStateLoaded(), "User preset state should not be loaded until needed!");
+
+            presetMgr.loadPreset (0);
+            REQUIRE (userPreset->isStateLoaded());
+            REQUIRE_MESSAGE (presetMgr.getFloatParam() == testValue, "Preset value is incorrect!");
+        }
+
+        chowdsp::PresetIndex index;
+        REQUIRE_MESSAGE (index.loadFromFile (chowdsp::PresetFolderScanner::getIndexFile (userPresetsDir)), "Preset index was not saved!");
+        REQUIRE (index.size() == 1);
+
+        // the second scan should use the index
+        ScopedPresetManager presetMgr { userPresetsDir };
+        REQUIRE_MESSAGE (*presetMgr->getPresetTree().getPresetByIndex (0) == preset, "Indexed user preset is incorrect!");
+
+        bool presetsLoaded = false;
+        auto presetsLoadedCallback = presetMgr->userPresetsLoadedBroadcaster.connect ([&presetsLoaded]
+                                                                                     { presetsLoaded = true; });
+        presetMgr->loadUserPresetsFromFolder (userPresetsDir);
+        REQUIRE_MESSAGE (presetsLoaded, "Synchronous user preset loading should notify the listeners!");
+    }
+
+    SECTION ("Async User Presets")
+    {
+        static constexpr int numPresets = 20;
+        test_utils::ScopedFile userPresetsDir { "user_presets_async" };
+        userPresetsDir.file.createDirectory();
+        for (int i = 0; i < numPresets; ++i)
+        {
+            chowdsp::Preset preset { "Preset " + juce::String (i), "User", { { "float", 0.5f } } };
+            preset.toFile (userPresetsDir.file.getChildFile ("preset_" + juce::String (i) + ".preset"));
+        }
+
+        ScopedPresetManager presetMgr {};
+        int numListUpdates = 0;
+        bool scanFinished = false;
+        auto listUpdatedCallback = presetMgr->presetListUpdatedBroadcaster.connect ([&numListUpdates]
+                                                                                   { numListUpdates++; });
+        auto scanFinishedCallback = presetMgr->userPresetsLoadedBroadcaster.connect ([&scanFinished]
+                                                                                    { scanFinished = true; });
+
+        presetMgr->setUserPresetPath (userPresetsDir, true);
+        REQUIRE (presetMgr->isLoadingUserPresets());
+
+        for (int i = 0; i < 100 && ! scanFinished; ++i)
+            juce::MessageManager::getInstance()->runDispatchLoopUntil (20);
+
+        REQUIRE_MESSAGE (scanFinished, "Async user preset scan did not finish!");
+        REQUIRE (! presetMgr->isLoadingUserPresets());
+        REQUIRE (numListUpdates > 1);
+        REQUIRE (presetMgr->getPresetTree().getTotalNumberOfPresets() == numPresets);
+    }
+
+    SECTION ("Async Preset Loading")
+    {
+        test_utils::ScopedFile userPresetsDir { "user_presets_async_load" };
+        userPresetsDir.file.createDirectory();
+        chowdsp::Preset { "Bright", "User", { { "float", 0.8f } } }.toFile (userPresetsDir.file.getChildFile ("bright.preset"));
+        chowdsp::Preset { "Dark", "User", { { "float", 0.2f } } }.toFile (userPresetsDir.file.getChildFile ("dark.preset"));
+
+        ScopedPresetManager presetMgr { userPresetsDir };
+        int numPresetChanges = 0;
+        auto presetAboutToChangeCallback = presetMgr->presetAboutToChangeBroadcaster.connect ([&numPresetChanges]
+                                                                                             { numPresetChanges++; });
+
+        const auto& presetTree = presetMgr->getPresetTree();
+        const auto* brightPreset = presetTree.searchPresets ("bright")[0];
+        const auto* darkPreset = presetTree.searchPresets ("dark")[0];
+        REQUIRE (! brightPreset->isStateLoaded());
+        REQUIRE (! darkPreset->isStateLoaded());
+
+        const auto waitForPresetLoad = [&presetMgr]
+        {
+            for (int i = 0; i < 100 && presetMgr->isLoadingPreset(); ++i)
+                juce::MessageManager::getInstance()->runDispatchLoopUntil (20);
+        };
+
+        presetMgr->loadPresetAsync (*brightPreset);
+        REQUIRE (presetMgr->isLoadingPreset());
+        waitForPresetLoad();
+
+        REQUIRE_MESSAGE (! presetMgr->isLoadingPreset(), "Async preset load did not finish!");
+        REQUIRE (brightPreset->isStateLoaded());
+        REQUIRE (presetMgr->getCurrentPreset() == brightPreset);
+        REQUIRE (presetMgr.getFloatParam() == 0.8f);
+        REQUIRE (numPresetChanges == 1);
+
+        // the second request should replace the first one
+        presetMgr->loadPresetAsync (*darkPreset);
+        presetMgr->loadPresetAsync (*brightPreset);
+        REQUIRE (! presetMgr->isLoadingPreset());
+        juce::MessageManager::getInstance()->runDispatchLoopUntil (100);
+
+        REQUIRE (presetMgr->getCurrentPreset() == brightPreset);
+        REQUIRE (presetMgr.getFloatParam() == 0.8f);
+        REQUIRE (numPresetChanges == 2);
+
+        presetMgr->loadPresetAsync (*darkPreset);
+        waitForPresetLoad();
+        REQUIRE (presetMgr->getCurrentPreset() == darkPreset);
+        REQUIRE (presetMgr.getFloatParam() == 0.2f);
+        REQUIRE (numPresetChanges == 3);
+    }
+
+    SECTION ("Background Work Cancelled On Destruction")
+    {
+        struct SlowPresetManager : chowdsp::PresetManager
+        {
+            SlowPresetManager (chowdsp::PluginStateImpl<Params<false>>& state, std::atomic_int& numLoaded)
+                : chowdsp::PresetManager (state),
+                  numPresetsLoaded (numLoaded)
+            {
+            }
+
+            chowdsp::PresetFolderScanner::PresetLoader getUserPresetLoader() const override
+            {
+                return [&numLoaded = numPresetsLoaded] (const juce::File& file)
+                {
+                    juce::Thread::sleep (5);
+                    numLoaded++;
+                    return chowdsp::Preset { file };
+                };
+            }
+
+            void loadUserPresetsFromFolder (const juce::File& file) override
+            {
+                numFolderLoads++;
+                chowdsp::PresetManager::loadUserPresetsFromFolder (file);
+            }
+
+            std::atomic_int& numPresetsLoaded;
+            int numFolderLoads = 0;
+        };
+
+        static constexpr int numPresets = 50;
+        test_utils::ScopedFile userPresetsDir { "user_presets_async_destroy" };
+        userPresetsDir.file.createDirectory();
+        for (int i = 0; i < numPresets; ++i)
+        {
+            chowdsp::Preset preset { "Preset " + juce::String (i), "User", { { "float", 0.5f } } };
+            preset.toFile (userPresetsDir.file.getChildFile ("preset_" + juce::String (i) + ".preset"));
+        }
+
+        std::atomic_int numPresetsLoaded { 0 };
+        {
+            chowdsp::PluginStateImpl<Params<false>> state;
+            SlowPresetManager presetMgr { state, numPresetsLoaded };
+            presetMgr.setUserPresetPath (userPresetsDir, true);
+            REQUIRE (presetMgr.isLoadingUserPresets());
+            REQUIRE_MESSAGE (presetMgr.numFolderLoads == 1, "Async user preset loading should go through loadUserPresetsFromFolder()!");
+            juce::Thread::sleep (20);
+        }
+
+        // the scan should have been stopped before the derived class was destroyed
+        const auto numLoadedAtDestruction = numPresetsLoaded.load();
+        REQUIRE (numLoadedAtDestruction < numPresets);
+        juce::Thread::sleep (50);
+        REQUIRE_MESSAGE (numPresetsLoaded.load() == numLoadedAtDestruction, "Preset scan should not continue after the preset manager is destroyed!");
+    }
 }
@@ -111,6 +111,75 @@ TEST_CASE ("Preset Tree Test", "[plugin][presets]")
         REQUIRE (treeItems[1].subtree[0].subtree[1].preset->getName() == "Gtr2");
     }
 
+    SECTION ("Batch Insertion Test")
+    {
+        const std::vector<chowdsp::Preset> presets {
+            chowdsp::Preset { "Gtr2", "Steve", {}, "Gtr" },
+            chowdsp::Preset { "Bass2", "Jatin", {}, "Bass" },
+            chowdsp::Preset { "Blah", "Jatin", {}, "" },
+            chowdsp::Preset { "Gtr1", "Steve", {}, "Gtr" },
+            chowdsp::Preset { "Bass1", "Jatin", {}, "Bass" },
+        };
+
+        chowdsp::PresetTree sequentialTree;
+        sequentialTree.treeInserter = &chowdsp::PresetTreeInserters::vendorCategoryInserter;
+        for (const auto& preset : presets)
+            sequentialTree.insertPreset (chowdsp::Preset { preset });
+
+        chowdsp::PresetTree batchTree;
+        batchTree.treeInserter = &chowdsp::PresetTreeInserters::vendorCategoryInserter;
+        batchTree.insertPresets (std::vector<chowdsp::Preset> { presets });
+
+        REQUIRE (batchTree.getTotalNumberOfPresets() == sequentialTree.getTotalNumberOfPresets());
+        for (int i = 0; i < sequentialTree.getTotalNumberOfPresets(); ++i)
+            REQUIRE (*batchTree.getPresetByIndex (i) == *sequentialTree.getPresetByIndex (i));
+    }
+
+    SECTION ("Search Test")
+    {
+        chowdsp::PresetTree presetTree;
+        presetTree.treeInserter = &chowdsp::PresetTreeInserters::vendorCategoryInserter;
+        presetTree.insertPresets ({
+            chowdsp::Preset { "Deep Bass", "Jatin", {}, "Bass" },
+            chowdsp::Preset { "Bassoon", "Jatin", {}, "Winds" },
+            chowdsp::Preset { "Drum Kit", "Jatin", {}, "Drums" },
+            chowdsp::Preset { "Clean Guitar", "Steve", {}, "Gtr" },
+            chowdsp::Preset { "Crunchy Guitar", "Steve", {}, "Gtr" },
+        });
+
+        const auto getNames = [] (const std::vector<const chowdsp::Preset*>& presets)
+        {
+            std::vector<juce::String> names;
+            for (const auto* preset : presets)
+                names.push_back (preset->getName());
+            return names;
+        };
+
+        // exact matches come before prefix matches
+        REQUIRE (getNames (presetTree.searchPresets ("bass")) == std::vector<juce::String> { "Deep Bass", "Bassoon" });
+        REQUIRE (getNames (presetTree.searchPresets ("BASS", 1)) == std::vector<juce::String> { "Deep Bass" });
+
+        // prefix match
+        REQUIRE (getNames (presetTree.searchPresets ("crun")) == std::vector<juce::String> { "Crunchy Guitar" });
+
+        // approximate match
+        REQUIRE (getNames (presetTree.searchPresets ("gutiar")) == std::vector<juce::String> { "Clean Guitar", "Crunchy Guitar" });
+
+        // all words must match
+        REQUIRE (getNames (presetTree.searchPresets ("steve clean")) == std::vector<juce::String> { "Clean Guitar" });
+        REQUIRE (presetTree.searchPresets ("jatin guitar").empty());
+
+        REQUIRE (presetTree.searchPresets ("").empty());
+        REQUIRE (presetTree.searchPresets ("  ").empty());
+
+        const auto presetToRemove = *presetTree.searchPresets ("clean")[0];
+        presetTree.removePreset (presetToRemove);
+        REQUIRE (getNames (presetTree.searchPresets ("guitar")) == std::vector<juce::String> { "Crunchy Guitar" });
+
+        presetTree.insertPreset (chowdsp::Preset { "Acoustic Guitar", "Steve", {}, "Gtr" });
+        REQUIRE (getNames (presetTree.searchPresets ("guitar")) == std::vector<juce::String> { "Acoustic Guitar", "Crunchy Guitar" });
+    }
+
     SECTION ("Get Preset By Index")
     {
         chowdsp::PresetTree presetTree;